@@ -136,7 +136,8 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("shell")};
 
 /* Full names for matrix types */
 
@@ -144,7 +145,8 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("matrix-free operator")};
 
 /* Fill type names for matrices */
 
@@ -4889,6 +4891,125 @@ _variant_add(const char                        *name,
   *n_variants += 1;
 }
 
+/*----------------------------------------------------------------------------
+ * Create shell matrix coefficients.
+ *
+ * returns:
+ *   pointer to allocated shell coefficients structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_coeff_shell_t *
+_create_coeff_shell(void)
+{
+  cs_matrix_coeff_shell_t  *mc;
+
+  /* Allocate */
+
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_shell_t);
+
+  /* Initialize */
+
+  mc->product = NULL;
+  mc->input = NULL;
+  mc->d_val = NULL;
+
+  return mc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy shell matrix coefficients.
+ *
+ * parameters:
+ *   coeff  <->  Pointer to shell matrix coefficients pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_coeff_shell(cs_matrix_coeff_shell_t  **coeff)
+{
+  if (coeff != NULL && *coeff !=NULL)
+    BFT_FREE(*coeff);
+}
+
+/*----------------------------------------------------------------------------
+ * Release shell matrix coefficients.
+ *
+ * The product function and its input are owned by the caller, so
+ * only the references are cleared.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_coeffs_shell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_shell_t  *mc = matrix->coeffs;
+
+  if (mc != NULL) {
+    mc->product = NULL;
+    mc->input = NULL;
+    mc->d_val = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy diagonal of shell matrix.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   da     --> diagonal (pre-allocated, size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_diagonal_shell(const cs_matrix_t  *matrix,
+                     cs_real_t          *restrict da)
+{
+  const cs_matrix_coeff_shell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = matrix->n_rows;
+
+  if (mc->d_val != NULL) {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      da[ii] = mc->d_val[ii];
+  }
+  else {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      da[ii] = 0.0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with shell matrix.
+ *
+ * The product is delegated to the user-provided function, and the
+ * diagonal contribution is removed afterwards if required.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_shell(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t    *restrict x,
+                   cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_shell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = matrix->n_rows;
+
+  mc->product(mc->input, x, y);
+
+  if (exclude_diag && mc->d_val != NULL) {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      y[ii] -= mc->d_val[ii] * x[ii];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Select the sparse matrix-vector product function to be used by a
  * matrix or variant for a given fill type.
@@ -5416,6 +5537,9 @@ _matrix_create(cs_matrix_type_t  type)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SHELL:
+    m->coeffs = _create_coeff_shell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5466,6 +5590,13 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SHELL:
+    m->release_coefficients = _release_coeffs_shell;
+    m->copy_diagonal = _copy_diagonal_shell;
+    for (mft = 0; mft < CS_MATRIX_N_FILL_TYPES; mft++)
+      m->vector_multiply[mft][0] = _mat_vec_p_l_shell;
+    break;
+
   default:
     assert(0);
     break;
@@ -5954,6 +6085,9 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SHELL:
+    m->coeffs = _create_coeff_shell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5967,6 +6101,57 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   return m;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a matrix-free (shell) matrix.
+ *
+ * Such a matrix has no stored coefficients: its product with a vector is
+ * delegated to a user-provided function, and its diagonal is shared with
+ * the caller. It may be used by iterative solvers relying only on
+ * matrix-vector products and diagonal (Jacobi or polynomial)
+ * preconditioning. The matrix has no halo, so the product function is
+ * responsible for the parallel synchronization.
+ *
+ * \param[in]  n_rows     local number of rows
+ * \param[in]  symmetric  indicates if the operator is symmetric
+ * \param[in]  diag       diagonal of the operator (shared, size n_rows)
+ * \param[in]  product    function computing y = A.x
+ * \param[in]  input      pointer to data used by the product function
+ *
+ * \return  pointer to created matrix structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_matrix_create_shell(cs_lnum_t                    n_rows,
+                       bool                         symmetric,
+                       const cs_real_t             *diag,
+                       cs_matrix_shell_product_t   *product,
+                       const void                  *input)
+{
+  assert(product != NULL);
+
+  cs_matrix_t *m = _matrix_create(CS_MATRIX_SHELL);
+
+  m->n_rows = n_rows;
+  m->n_cols_ext = n_rows;
+  m->symmetric = symmetric;
+
+  for (int i = 0; i < 4; i++) {
+    m->db_size[i] = 1;
+    m->eb_size[i] = 1;
+  }
+  m->fill_type = (symmetric) ? CS_MATRIX_SCALAR_SYM : CS_MATRIX_SCALAR;
+
+  cs_matrix_coeff_shell_t  *mc = m->coeffs;
+
+  mc->product = product;
+  mc->input = input;
+  mc->d_val = diag;
+
+  return m;
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a matrix structure.
  *
@@ -6011,6 +6196,13 @@ cs_matrix_destroy(cs_matrix_t **matrix)
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_SHELL:
+      {
+        cs_matrix_coeff_shell_t *coeffs = m->coeffs;
+        _destroy_coeff_shell(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
     default:
       assert(0);
       break;
@@ -6731,6 +6923,13 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     }
     break;
 
+  case CS_MATRIX_SHELL:
+    {
+      cs_matrix_coeff_shell_t *mc = matrix->coeffs;
+      diag = mc->d_val;
+    }
+    break;
+
   default:
     assert(0);
     break;
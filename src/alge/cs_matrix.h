@@ -58,6 +58,7 @@ typedef enum {
   CS_MATRIX_CSR,        /* Compressed Sparse Row storage format */
   CS_MATRIX_CSR_SYM,    /* Compressed Symmetric Sparse Row storage format */
   CS_MATRIX_MSR,        /* Modified Compressed Sparse Row storage format */
+  CS_MATRIX_SHELL,      /* Matrix-free operator (product function only) */
   CS_MATRIX_N_TYPES     /* Number of known matrix types */
 
 } cs_matrix_type_t;
@@ -93,6 +94,15 @@ typedef struct _cs_matrix_t cs_matrix_t;
 
 typedef struct _cs_matrix_variant_t cs_matrix_variant_t;
 
+/* Function computing the product y = A.x of a matrix-free (shell) operator.
+   x and y are local (non-synchronized) arrays of size n_rows; the function
+   is responsible for the handling of parallel synchronization */
+
+typedef void
+(cs_matrix_shell_product_t) (const void       *input,
+                             const cs_real_t  *x,
+                             cs_real_t        *y);
+
 /* Information structure for extraction of matrix row */
 
 typedef struct {
@@ -335,6 +345,34 @@ cs_matrix_create_from_assembler(cs_matrix_type_t        type,
 cs_matrix_t *
 cs_matrix_create_by_copy(cs_matrix_t   *src);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a matrix-free (shell) matrix.
+ *
+ * Such a matrix has no stored coefficients: its product with a vector is
+ * delegated to a user-provided function, and its diagonal is shared with
+ * the caller. It may be used by iterative solvers relying only on
+ * matrix-vector products and diagonal (Jacobi or polynomial)
+ * preconditioning. The matrix has no halo, so the product function is
+ * responsible for the parallel synchronization.
+ *
+ * \param[in]  n_rows     local number of rows
+ * \param[in]  symmetric  indicates if the operator is symmetric
+ * \param[in]  diag       diagonal of the operator (shared, size n_rows)
+ * \param[in]  product    function computing y = A.x
+ * \param[in]  input      pointer to data used by the product function
+ *
+ * \return  pointer to created matrix structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_matrix_create_shell(cs_lnum_t                    n_rows,
+                       bool                         symmetric,
+                       const cs_real_t             *diag,
+                       cs_matrix_shell_product_t   *product,
+                       const void                  *input);
+
 /*----------------------------------------------------------------------------
  * Destroy a matrix structure.
  *
@@ -235,6 +235,18 @@ typedef struct _cs_matrix_coeff_msr_t {
 
 } cs_matrix_coeff_msr_t;
 
+/* Matrix-free (shell) operator representation */
+/*----------------------------------------------*/
+
+typedef struct _cs_matrix_coeff_shell_t {
+
+  cs_matrix_shell_product_t  *product;  /* Operator product function */
+  const void                 *input;    /* Data used by the product function */
+
+  const cs_real_t            *d_val;    /* Pointer to shared diagonal */
+
+} cs_matrix_coeff_shell_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
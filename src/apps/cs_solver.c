@@ -69,8 +69,10 @@
 #include "cs_gui_particles.h"
 #include "cs_gui_radiative_transfer.h"
 #include "cs_io.h"
+#include "cs_io_server.h"
 #include "cs_join.h"
 #include "cs_lagr.h"
+#include "cs_lagr_benchmark.h"
 #include "cs_lagr_tracking.h"
 #include "cs_les_inflow.h"
 #include "cs_log.h"
@@ -342,7 +344,10 @@ cs_run(void)
 
   if (opts.benchmark > 0) {
     int mpi_trace_mode = (opts.benchmark == 2) ? 1 : 0;
-    cs_benchmark(mpi_trace_mode);
+    if (opts.benchmark_lagr)
+      cs_lagr_benchmark(mpi_trace_mode);
+    else
+      cs_benchmark(mpi_trace_mode);
   }
 
   if (check_mask && cs_syr_coupling_n_couplings())
@@ -552,6 +557,7 @@ cs_run(void)
 
   cs_timer_stats_finalize();
 
+  cs_io_server_finalize();
   cs_file_free_defaults();
 
   cs_base_time_summary();
@@ -626,6 +632,13 @@ main(int    argc,
 
   cs_base_error_init(opts.sig_defaults);
 
+  /* Dedicated I/O server ranks only handle forwarded output */
+
+  if (cs_io_server_is_server()) {
+    cs_io_server_run();
+    cs_exit(EXIT_SUCCESS);
+  }
+
   /* Open 'listing' (log) files */
 
   cs_base_fortran_bft_printf_set("listing", opts.ilisr0, opts.ilisrp);
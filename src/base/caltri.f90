@@ -885,6 +885,14 @@ if (iale.eq.1 .and. inpdt0.eq.0) then
 
 endif
 
+!===============================================================================
+! Load balance check (may define a new partitioning and stop)
+!===============================================================================
+
+if (itrale.gt.0) then
+  call cs_load_balance_update
+endif
+
 !===============================================================================
 ! Stop tests
 !===============================================================================
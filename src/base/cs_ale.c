@@ -61,6 +61,10 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Optional function called after mesh quantities are updated */
+
+static cs_ale_geometry_update_t  *_geometry_update_hook = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -95,6 +99,9 @@ CS_PROCF (algrma, ALGRMA)(cs_real_t  *min_vol,
   cs_mesh_quantities_compute(m, mq);
   cs_mesh_bad_cells_detect(m, mq);
 
+  if (_geometry_update_hook != NULL)
+    _geometry_update_hook();
+
   *min_vol = mq->min_vol;
   *max_vol = mq->max_vol;
   *tot_vol = mq->tot_vol;
@@ -335,6 +342,24 @@ CS_PROCF (aledis, ALEDIS)(const cs_int_t      ialtyb[],
   BFT_FREE(vtx_interior_indicator);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set a function to be called after mesh quantities are updated
+ *        by an ALE displacement.
+ *
+ * This allows modules caching geometric data (such as Lagrangian particle
+ * tracking) to refresh it without the ALE module depending on them.
+ *
+ * \param[in]  hook  pointer to update function, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ale_set_geometry_update_hook(cs_ale_geometry_update_t  *hook)
+{
+  _geometry_update_hook = hook;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -41,6 +41,15 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Function called after mesh quantities are updated by ALE */
+
+typedef void
+(cs_ale_geometry_update_t) (void);
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -89,6 +98,21 @@ CS_PROCF (aledis, ALEDIS)(const cs_int_t      ialtyb[],
                           const cs_real_t    *dt,
                           cs_real_3_t        *disp_proj);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set a function to be called after mesh quantities are updated
+ *        by an ALE displacement.
+ *
+ * This allows modules caching geometric data (such as Lagrangian particle
+ * tracking) to refresh it without the ALE module depending on them.
+ *
+ * \param[in]  hook  pointer to update function, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ale_set_geometry_update_hook(cs_ale_geometry_update_t  *hook);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
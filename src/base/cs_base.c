@@ -66,6 +66,7 @@
 
 #include "cs_file.h"
 #include "cs_fp_exception.h"
+#include "cs_io_server.h"
 #include "cs_log.h"
 #include "cs_timer.h"
 
@@ -256,7 +257,13 @@ _cs_base_err_vprintf(const char  *format,
     int i;
     int n_dec = 1;
 
-    if (cs_glob_rank_id < 1)
+    /* I/O server ranks have their own communicator, so their rank ids
+       would clash with those of compute ranks */
+
+    if (cs_io_server_is_server())
+      sprintf(err_file_name, "error_io_r%d", CS_MAX(cs_glob_rank_id, 0));
+
+    else if (cs_glob_rank_id < 1)
       strcpy(err_file_name, "error");
 
     else {
@@ -1163,6 +1170,7 @@ cs_base_mpi_init(int    *argc,
 
   int arg_id = 0, flag = 0;
   int use_mpi = false;
+  int n_io_servers = 0;
 
 #if   defined(__bg__) || defined(__CRAYXT_COMPUTE_LINUX_TARGET)
 
@@ -1222,6 +1230,13 @@ cs_base_mpi_init(int    *argc,
     if (strcmp(s, "--mpi") == 0)
       use_mpi = true;
 
+    /* Dedicated I/O server ranks */
+
+    else if (strcmp(s, "--io-servers") == 0) {
+      if (arg_id + 1 < *argc)
+        n_io_servers = atoi((*argv)[arg_id + 1]);
+    }
+
   } /* End of loop on command line arguments */
 
   if (use_mpi == true) {
@@ -1247,6 +1262,9 @@ cs_base_mpi_init(int    *argc,
     _cs_base_mpi_setup(app_name);
 
     BFT_FREE(app_name);
+
+    if (n_io_servers > 0)
+      cs_io_server_mpi_init(n_io_servers);
   }
 
 #endif
@@ -848,6 +848,16 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function checking load balance
+
+    subroutine cs_load_balance_update()  &
+      bind(C, name='cs_load_balance_update')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_load_balance_update
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function mapping field pointers
 
     subroutine cs_field_pointer_map_base()  &
@@ -53,6 +53,8 @@
 #include "fvm_nodal_extract.h"
 #include "fvm_point_location.h"
 
+#include "cs_io_server.h"
+
 #include "cs_coupling.h"
 
 /*----------------------------------------------------------------------------*/
@@ -187,7 +189,7 @@ cs_coupling_discover_mpi_apps(const char  *app_name)
 
   MPI_Comm_size(MPI_COMM_WORLD, &world_size);
 
-  if (cs_glob_n_ranks < world_size) {
+  if (cs_glob_n_ranks + cs_io_server_get_n_ranks() < world_size) {
 
     int i, n_apps, app_id;
 
@@ -84,6 +84,7 @@
 #include "bft_mem.h"
 #include "bft_error.h"
 #include "bft_printf.h"
+#include "cs_io_server.h"
 #include "cs_log.h"
 
 /*----------------------------------------------------------------------------
@@ -195,6 +196,7 @@ struct _cs_file_t {
 #if defined(HAVE_MPI)
   MPI_Comm           comm;         /* Associated MPI communicator */
   MPI_Comm           io_comm;      /* Associated MPI-IO communicator */
+  cs_io_server_file_t  *ios;       /* Associated I/O server file, or NULL */
 #endif
 #if defined(HAVE_MPI_IO)
   MPI_File           fh;           /* MPI file handle */
@@ -513,6 +515,62 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a file's output is forwarded to an I/O server rank.
+ *
+ * parameters:
+ *   f <-- pointer to file handler
+ *
+ * returns:
+ *   true if output is forwarded, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_io_server(const cs_file_t  *f)
+{
+#if defined(HAVE_MPI)
+  return (f->ios != NULL) ? true : false;
+#else
+  CS_UNUSED(f);
+  return false;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Post data to be written by an I/O server rank.
+ *
+ * parameters:
+ *   f      <-- cs_file_t descriptor
+ *   offset <-- file offset at which data is written
+ *   buf    <-- pointer to location containing data
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to write
+ *
+ * returns:
+ *   the (local) number of items (not bytes) posted for writing.
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_io_server_write(cs_file_t      *f,
+                 cs_file_off_t   offset,
+                 const void     *buf,
+                 size_t          size,
+                 size_t          ni)
+{
+#if defined(HAVE_MPI)
+  if (ni > 0)
+    cs_io_server_file_write(f->ios, offset, buf, size*ni);
+  return ni;
+#else
+  CS_UNUSED(f);
+  CS_UNUSED(offset);
+  CS_UNUSED(buf);
+  CS_UNUSED(size);
+  CS_UNUSED(ni);
+  return 0;
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -1808,6 +1866,7 @@ cs_file_open(const char        *name,
 #if defined(HAVE_MPI)
   f->comm = MPI_COMM_NULL;
   f->io_comm = MPI_COMM_NULL;
+  f->ios = NULL;
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
@@ -1860,6 +1919,16 @@ cs_file_open(const char        *name,
               name);
 #endif
 
+  /* Forward output to I/O server ranks if available */
+
+#if defined(HAVE_MPI)
+  if (f->mode != CS_FILE_MODE_READ) {
+    f->ios = cs_io_server_file_open(f->name, f->mode, f->comm);
+    if (f->ios != NULL)
+      return f;
+  }
+#endif
+
   /* Open file. In case of failure, destroy the allocated structure;
      this is only useful with a non-default error handler,
      as the program is terminated by default */
@@ -1988,6 +2057,11 @@ cs_file_free(cs_file_t  *f)
 {
   cs_file_t  *_f = f;
 
+#if defined(HAVE_MPI)
+  if (_f->ios != NULL)
+    cs_io_server_file_close(&(_f->ios));
+#endif
+
   if (_f->sh != NULL)
     _file_close(_f);
 
@@ -2218,7 +2292,8 @@ cs_file_write_global(cs_file_t   *f,
 
   if (   f->rank == 0
       && (   (f->swap_endian == true && size > 1)
-          || (f->method > CS_FILE_STDIO_PARALLEL))) {
+          || (   f->method > CS_FILE_STDIO_PARALLEL
+              && _io_server(f) == false))) {
 
     if (size*ni > sizeof(_copybuf))
       BFT_MALLOC(copybuf, size*ni, unsigned char);
@@ -2230,7 +2305,12 @@ cs_file_write_global(cs_file_t   *f,
     _buf = copybuf;
   }
 
-  if (f->rank == 0 && f->sh != NULL && f->method <= CS_FILE_STDIO_PARALLEL) {
+  if (_io_server(f)) {
+    if (f->rank == 0)
+      _io_server_write(f, f->offset, _buf, size, ni);
+  }
+
+  else if (f->rank == 0 && f->sh != NULL && f->method <= CS_FILE_STDIO_PARALLEL) {
     if (f->method == CS_FILE_STDIO_PARALLEL) {
       if (_file_seek(f, f->offset, CS_FILE_SEEK_SET) != 0)
         retval = 0;
@@ -2293,7 +2373,7 @@ cs_file_write_global(cs_file_t   *f,
     BFT_FREE(copybuf);
 
 #if defined(HAVE_MPI)
-  if (f->comm != MPI_COMM_NULL) {
+  if (f->comm != MPI_COMM_NULL && _io_server(f) == false) {
     long _retval = retval;
     MPI_Bcast(&_retval, 1, MPI_LONG, 0, f->comm);
     retval = _retval;
@@ -2463,7 +2543,8 @@ cs_file_write_block(cs_file_t   *f,
   /* Copy contents to ensure buffer constedness if necessary */
 
   if (   (f->swap_endian == true && size > 1)
-      || (f->n_ranks > 1 && f->method != CS_FILE_STDIO_PARALLEL)) {
+      || (   f->n_ranks > 1 && f->method != CS_FILE_STDIO_PARALLEL
+          && _io_server(f) == false)) {
 
     unsigned char *copybuf = NULL;
 
@@ -2491,7 +2572,14 @@ cs_file_write_block(cs_file_t   *f,
     const cs_gnum_t _global_num_start = (global_num_start-1)*stride + 1;
     const cs_gnum_t _global_num_end = (global_num_end-1)*stride + 1;
 
-    if (_global_num_end > _global_num_start) {
+    if (_io_server(f))
+      retval = _io_server_write(f,
+                                f->offset + (_global_num_start - 1)*size,
+                                buf,
+                                size,
+                                (_global_num_end - _global_num_start));
+
+    else if (_global_num_end > _global_num_start) {
 
       if (f->sh == NULL)
         _file_open(f);
@@ -2573,54 +2661,65 @@ cs_file_write_block_buffer(cs_file_t  *f,
 
   /* Write to file using chosen method */
 
-  switch(f->method) {
+  if (_io_server(f))
+    retval = _io_server_write(f,
+                              f->offset + (_global_num_start - 1)*size,
+                              buf,
+                              size,
+                              (_global_num_end - _global_num_start));
 
-  case CS_FILE_STDIO_SERIAL:
-    retval = _file_write_block_s(f,
-                                 buf,
-                                 size,
-                                 _global_num_start,
-                                 _global_num_end);
-    break;
+  else {
 
-  case CS_FILE_STDIO_PARALLEL:
-    retval = _file_write_block_p(f,
-                                 buf,
-                                 size,
-                                 _global_num_start,
-                                 _global_num_end);
-    break;
+    switch(f->method) {
 
-#if defined(HAVE_MPI_IO)
+    case CS_FILE_STDIO_SERIAL:
+      retval = _file_write_block_s(f,
+                                   buf,
+                                   size,
+                                   _global_num_start,
+                                   _global_num_end);
+      break;
 
-  case CS_FILE_MPI_INDEPENDENT:
-  case CS_FILE_MPI_NON_COLLECTIVE:
-      retval = _mpi_file_write_block_noncoll(f,
-                                             buf,
-                                             size,
-                                             _global_num_start,
-                                             _global_num_end);
+    case CS_FILE_STDIO_PARALLEL:
+      retval = _file_write_block_p(f,
+                                   buf,
+                                   size,
+                                   _global_num_start,
+                                   _global_num_end);
       break;
 
-  case CS_FILE_MPI_COLLECTIVE:
-    if (_mpi_io_positionning == CS_FILE_MPI_EXPLICIT_OFFSETS)
-      retval = _mpi_file_write_block_eo(f,
-                                        buf,
-                                        size,
-                                        _global_num_start,
-                                        _global_num_end);
-    else
-      retval = _mpi_file_write_block_ip(f,
-                                        buf,
-                                        size,
-                                        _global_num_start,
-                                        _global_num_end);
-    break;
+#if defined(HAVE_MPI_IO)
+
+    case CS_FILE_MPI_INDEPENDENT:
+    case CS_FILE_MPI_NON_COLLECTIVE:
+        retval = _mpi_file_write_block_noncoll(f,
+                                               buf,
+                                               size,
+                                               _global_num_start,
+                                               _global_num_end);
+        break;
+
+    case CS_FILE_MPI_COLLECTIVE:
+      if (_mpi_io_positionning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+        retval = _mpi_file_write_block_eo(f,
+                                          buf,
+                                          size,
+                                          _global_num_start,
+                                          _global_num_end);
+      else
+        retval = _mpi_file_write_block_ip(f,
+                                          buf,
+                                          size,
+                                          _global_num_start,
+                                          _global_num_end);
+      break;
 
 #endif /* defined(HAVE_MPI_IO) */
 
-  default:
-    assert(0);
+    default:
+      assert(0);
+    }
+
   }
 
   /* Update offset */
@@ -3336,6 +3435,13 @@ cs_file_defaults_info(void)
                     _("  I/O rank step:        %d\n"), block_rank_step);
   }
 
+  if (cs_io_server_get_n_ranks() > 0) {
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O server ranks:     %d\n"),
+                    cs_io_server_get_n_ranks());
+  }
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -0,0 +1,879 @@
+/*============================================================================
+ * Dedicated I/O server ranks for asynchronous file output.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_io_server.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_io_server.c
+        Dedicated I/O server ranks for asynchronous file output.
+
+  When activated (using the "--io-servers <n>" command-line option),
+  the last n ranks of the main communicator are set aside as I/O servers.
+  Files opened for writing through \ref cs_file_open on compute ranks
+  are then forwarded to one of these servers (based on the file name):
+  data which would be written to file is copied and posted using
+  non-blocking sends, so compute ranks may proceed without waiting for
+  the actual file writes, which are done by the servers.
+
+  As post-processing writers such as EnSight or checkpoint files use
+  \ref cs_file for output, this allows overlapping their output with
+  computation. Data is still redistributed among compute ranks
+  (using the usual block distribution), so output files are identical
+  to those obtained without I/O servers.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* MPI tag for I/O server messages */
+
+#define _CS_IO_SERVER_TAG  (int)('C'+'S'+'_'+'I'+'O'+'_'+'S')
+
+/* Maximum size of data chunk in a single message */
+
+#define _CS_IO_SERVER_CHUNK_SIZE  (1024*1024*1024)
+
+/* Maximum size of pending sends before we wait for completion */
+
+#define _CS_IO_SERVER_MAX_PENDING_SIZE  (1024*1024*512)
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Message types */
+
+typedef enum {
+
+  _IO_OPEN,
+  _IO_WRITE,
+  _IO_CLOSE,
+  _IO_EXIT
+
+} _msg_type_t;
+
+/* Message header (followed by file name or data) */
+
+typedef struct {
+
+  int            type;        /* message type */
+  int            id[2];       /* file id: rank of creator in I/O
+                                 communicator and creation counter */
+  int            mode;        /* file mode (for open) */
+  int            n_ranks;     /* number of ranks sharing file (for open) */
+
+  cs_file_off_t  offset;      /* file offset (for write) */
+  cs_file_off_t  size;        /* size of data following header */
+
+} _msg_header_t;
+
+/* Forwarded file descriptor */
+
+struct _cs_io_server_file_t {
+
+  int  id[2];    /* file id */
+  int  server;   /* associated server rank in I/O communicator */
+
+};
+
+/* File descriptor on server */
+
+typedef struct {
+
+  int            id[2];       /* file id */
+  char          *name;        /* file name */
+  FILE          *sh;          /* serial file handle */
+  int            n_ranks;     /* number of ranks sharing file */
+  int            n_closed;    /* number of ranks having closed file */
+  cs_file_off_t  base_offset; /* base offset (non-zero in append mode) */
+
+} _server_file_t;
+
+/* Server state */
+
+typedef struct {
+
+  int               n_files;          /* number of open files */
+  int               n_files_max;      /* size of files array */
+  _server_file_t   *files;            /* open files */
+
+  int               n_deferred;       /* number of deferred messages */
+  int               n_deferred_max;   /* size of deferred array */
+  unsigned char   **deferred;         /* deferred messages, in order
+                                         of arrival */
+
+  int               n_exit;           /* number of compute ranks done */
+
+} _server_t;
+
+#endif /* defined(HAVE_MPI) */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int   _n_servers = 0;
+static bool  _is_server = false;
+
+#if defined(HAVE_MPI)
+
+static MPI_Comm  _io_comm = MPI_COMM_NULL;  /* compute and server ranks */
+static int       _io_rank = 0;              /* rank in _io_comm */
+static int       _n_compute_ranks = 0;      /* number of compute ranks */
+static int       _n_files_created = 0;      /* file creation counter */
+
+/* Pending sends on compute ranks, oldest first */
+
+static int             _n_pending = 0;
+static int             _n_pending_max = 0;
+static MPI_Request    *_pending_req = NULL;
+static unsigned char **_pending_buf = NULL;
+static size_t         *_pending_size = NULL;
+static size_t          _pending_total = 0;
+
+#endif /* defined(HAVE_MPI) */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Choose the server associated with a given file name.
+ *
+ * Using the name rather than the file id ensures successive instances
+ * of a given file are handled by the same server.
+ *
+ * parameters:
+ *   name <-- file name
+ *
+ * returns:
+ *   server rank in I/O communicator
+ *----------------------------------------------------------------------------*/
+
+static int
+_server_rank(const char  *name)
+{
+  unsigned long h = 5381;
+
+  for (const unsigned char *c = (const unsigned char *)name; *c != '\0'; c++)
+    h = h*33 + *c;
+
+  return _n_compute_ranks + (int)(h % (unsigned long)_n_servers);
+}
+
+/*----------------------------------------------------------------------------
+ * Free buffers associated with completed sends.
+ *----------------------------------------------------------------------------*/
+
+static void
+_compact_sends(void)
+{
+  int j = 0;
+
+  for (int i = 0; i < _n_pending; i++) {
+    if (_pending_req[i] == MPI_REQUEST_NULL) {
+      BFT_FREE(_pending_buf[i]);
+      _pending_total -= _pending_size[i];
+    }
+    else {
+      _pending_req[j] = _pending_req[i];
+      _pending_buf[j] = _pending_buf[i];
+      _pending_size[j] = _pending_size[i];
+      j++;
+    }
+  }
+
+  _n_pending = j;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending sends, waiting for the oldest ones if needed.
+ *
+ * parameters:
+ *   max_size <-- maximum size of remaining pending sends
+ *----------------------------------------------------------------------------*/
+
+static void
+_complete_sends(size_t  max_size)
+{
+  if (_n_pending == 0)
+    return;
+
+  int n_done = 0;
+  int *done_idx = NULL;
+
+  BFT_MALLOC(done_idx, _n_pending, int);
+
+  MPI_Testsome(_n_pending, _pending_req, &n_done, done_idx,
+               MPI_STATUSES_IGNORE);
+
+  BFT_FREE(done_idx);
+
+  _compact_sends();
+
+  while (_pending_total > max_size) {
+    MPI_Wait(_pending_req, MPI_STATUS_IGNORE);
+    _compact_sends();
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Post a message to a server.
+ *
+ * parameters:
+ *   server <-- server rank in I/O communicator
+ *   h      <-- message header
+ *   data   <-- data following header, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_post_message(int                   server,
+              const _msg_header_t  *h,
+              const void           *data)
+{
+  _complete_sends(_CS_IO_SERVER_MAX_PENDING_SIZE);
+
+  size_t msg_size = sizeof(_msg_header_t) + h->size;
+
+  unsigned char *buf = NULL;
+  BFT_MALLOC(buf, msg_size, unsigned char);
+
+  memcpy(buf, h, sizeof(_msg_header_t));
+  if (h->size > 0)
+    memcpy(buf + sizeof(_msg_header_t), data, h->size);
+
+  if (_n_pending >= _n_pending_max) {
+    _n_pending_max = CS_MAX(16, _n_pending_max*2);
+    BFT_REALLOC(_pending_req, _n_pending_max, MPI_Request);
+    BFT_REALLOC(_pending_buf, _n_pending_max, unsigned char *);
+    BFT_REALLOC(_pending_size, _n_pending_max, size_t);
+  }
+
+  MPI_Isend(buf, msg_size, MPI_BYTE, server, _CS_IO_SERVER_TAG, _io_comm,
+            _pending_req + _n_pending);
+
+  _pending_buf[_n_pending] = buf;
+  _pending_size[_n_pending] = msg_size;
+  _pending_total += msg_size;
+  _n_pending++;
+}
+
+/*----------------------------------------------------------------------------
+ * Set the position of a file on a server.
+ *
+ * parameters:
+ *   f      <-- server file descriptor
+ *   offset <-- offset from beginning of file
+ *   whence <-- SEEK_SET or SEEK_END
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_seek(_server_file_t  *f,
+             cs_file_off_t    offset,
+             int              whence)
+{
+  int retval = 0;
+
+#if (SIZEOF_LONG < 8) && defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+  retval = fseeko(f->sh, (off_t)offset, whence);
+#else
+  retval = fseek(f->sh, (long)offset, whence);
+#endif
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error setting position in file \"%s\":\n\n  %s"),
+              f->name, strerror(errno));
+}
+
+/*----------------------------------------------------------------------------
+ * Find a file on a server.
+ *
+ * parameters:
+ *   s  <-- server state
+ *   id <-- file id
+ *
+ * returns:
+ *   id of file in server's files array, or -1 if not present.
+ *----------------------------------------------------------------------------*/
+
+static int
+_server_find_file(const _server_t  *s,
+                  const int         id[2])
+{
+  for (int i = 0; i < s->n_files; i++) {
+    if (s->files[i].id[0] == id[0] && s->files[i].id[1] == id[1])
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Open a file on a server.
+ *
+ * parameters:
+ *   s    <-> server state
+ *   h    <-- open message header
+ *   name <-- file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_open_file(_server_t            *s,
+                  const _msg_header_t  *h,
+                  const char           *name)
+{
+  if (s->n_files >= s->n_files_max) {
+    s->n_files_max = CS_MAX(4, s->n_files_max*2);
+    BFT_REALLOC(s->files, s->n_files_max, _server_file_t);
+  }
+
+  _server_file_t *f = s->files + s->n_files;
+
+  f->id[0] = h->id[0];
+  f->id[1] = h->id[1];
+  BFT_MALLOC(f->name, strlen(name) + 1, char);
+  strcpy(f->name, name);
+  f->n_ranks = h->n_ranks;
+  f->n_closed = 0;
+  f->base_offset = 0;
+
+  if (h->mode == CS_FILE_MODE_APPEND) {
+    f->sh = fopen(name, "r+b");
+    if (f->sh != NULL) {
+      _server_seek(f, 0, SEEK_END);
+#if (SIZEOF_LONG < 8) && defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+      f->base_offset = ftello(f->sh);
+#else
+      f->base_offset = ftell(f->sh);
+#endif
+    }
+    else
+      f->sh = fopen(name, "w+b");
+  }
+  else
+    f->sh = fopen(name, "wb");
+
+  if (f->sh == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file \"%s\":\n\n"
+                "  %s"), name, strerror(errno));
+
+  s->n_files += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Process a message on a server.
+ *
+ * A message may not be processed if it relates to a file which is not
+ * open yet, or to a file whose previous instance (with the same name)
+ * is not closed yet by all ranks. In this case, it should be deferred.
+ *
+ * parameters:
+ *   s   <-> server state
+ *   msg <-- message buffer
+ *
+ * returns:
+ *   true if the message was processed, false if it must be deferred
+ *----------------------------------------------------------------------------*/
+
+static bool
+_server_process(_server_t            *s,
+                const unsigned char  *msg)
+{
+  const _msg_header_t *h = (const _msg_header_t *)msg;
+  const unsigned char *data = msg + sizeof(_msg_header_t);
+
+  if (h->type == _IO_EXIT) {
+    s->n_exit += 1;
+    return true;
+  }
+
+  int f_id = _server_find_file(s, h->id);
+
+  if (h->type == _IO_OPEN) {
+    if (f_id < 0) {
+      const char *name = (const char *)data;
+      for (int i = 0; i < s->n_files; i++) {
+        if (strcmp(s->files[i].name, name) == 0)
+          return false;
+      }
+      _server_open_file(s, h, name);
+    }
+    return true;
+  }
+
+  if (f_id < 0)
+    return false;
+
+  _server_file_t *f = s->files + f_id;
+
+  if (h->type == _IO_WRITE) {
+    _server_seek(f, f->base_offset + h->offset, SEEK_SET);
+    if (fwrite(data, 1, h->size, f->sh) != (size_t)(h->size))
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error writing file \"%s\":\n\n  %s"),
+                f->name, strerror(ferror(f->sh)));
+  }
+
+  else if (h->type == _IO_CLOSE) {
+    f->n_closed += 1;
+    if (f->n_closed >= f->n_ranks) {
+      if (fclose(f->sh) != 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Error closing file \"%s\":\n\n"
+                    "  %s"), f->name, strerror(errno));
+      BFT_FREE(f->name);
+      s->n_files -= 1;
+      s->files[f_id] = s->files[s->n_files];
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Process deferred messages on a server, as long as progress is made.
+ *
+ * parameters:
+ *   s <-> server state
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_process_deferred(_server_t  *s)
+{
+  bool progress = true;
+
+  while (progress) {
+
+    progress = false;
+
+    int j = 0;
+    for (int i = 0; i < s->n_deferred; i++) {
+      if (_server_process(s, s->deferred[i])) {
+        BFT_FREE(s->deferred[i]);
+        progress = true;
+      }
+      else
+        s->deferred[j++] = s->deferred[i];
+    }
+    s->n_deferred = j;
+
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set aside the last ranks of the main communicator as I/O servers.
+ *
+ * This function must be called just after the main communicator has been
+ * defined, before it is used for anything else. On compute ranks, the main
+ * communicator (cs_glob_mpi_comm) and associated global variables are
+ * replaced by those restricted to compute ranks. On server ranks, the main
+ * communicator is restricted to server ranks.
+ *
+ * \param[in]  n_servers  number of I/O server ranks
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_io_server_mpi_init(int  n_servers)
+{
+  int rank, n_ranks, world_size;
+
+  if (n_servers < 1 || cs_glob_mpi_comm == MPI_COMM_NULL)
+    return;
+
+  MPI_Comm_size(cs_glob_mpi_comm, &n_ranks);
+  MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+  if (n_servers >= n_ranks)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%d I/O server ranks were requested,\n"
+                "but only %d ranks are available."),
+              n_servers, n_ranks);
+
+  if (n_ranks < world_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("I/O server ranks are not available when coupling\n"
+                "several MPI applications."));
+
+  MPI_Comm_dup(cs_glob_mpi_comm, &_io_comm);
+
+  _n_servers = n_servers;
+  _n_compute_ranks = n_ranks - n_servers;
+  _io_rank = rank;
+  _is_server = (rank >= _n_compute_ranks) ? true : false;
+
+  MPI_Comm comm;
+  MPI_Comm_split(cs_glob_mpi_comm, (_is_server) ? 1 : 0, rank, &comm);
+
+  if (cs_glob_mpi_comm != MPI_COMM_WORLD)
+    MPI_Comm_free(&cs_glob_mpi_comm);
+
+  cs_glob_mpi_comm = comm;
+
+  MPI_Comm_size(cs_glob_mpi_comm, &n_ranks);
+  MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+  /* Global rank values are consistent with cs_glob_mpi_comm; the rank in
+     the initial communicator is kept in _io_rank */
+
+  cs_glob_n_ranks = n_ranks;
+  cs_glob_rank_id = (n_ranks > 1) ? rank : -1;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return number of I/O server ranks.
+ *
+ * \return  number of ranks dedicated to I/O (0 if inactive)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_io_server_get_n_ranks(void)
+{
+  return _n_servers;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the local rank is an I/O server.
+ *
+ * \return  true if the local rank is an I/O server, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_io_server_is_server(void)
+{
+  return _is_server;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run the I/O server loop.
+ *
+ * This function returns once all compute ranks have called
+ * \ref cs_io_server_finalize and all pending writes have been completed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_io_server_run(void)
+{
+#if defined(HAVE_MPI)
+
+  if (_is_server == false)
+    return;
+
+  _server_t s = {.n_files = 0,
+                 .n_files_max = 0,
+                 .files = NULL,
+                 .n_deferred = 0,
+                 .n_deferred_max = 0,
+                 .deferred = NULL,
+                 .n_exit = 0};
+
+  while (s.n_exit < _n_compute_ranks) {
+
+    MPI_Status status;
+    int msg_size = 0;
+
+    MPI_Probe(MPI_ANY_SOURCE, _CS_IO_SERVER_TAG, _io_comm, &status);
+    MPI_Get_count(&status, MPI_BYTE, &msg_size);
+
+    unsigned char *msg = NULL;
+    BFT_MALLOC(msg, msg_size, unsigned char);
+
+    MPI_Recv(msg, msg_size, MPI_BYTE, status.MPI_SOURCE, _CS_IO_SERVER_TAG,
+             _io_comm, MPI_STATUS_IGNORE);
+
+    if (_server_process(&s, msg)) {
+      BFT_FREE(msg);
+      _server_process_deferred(&s);
+    }
+    else {
+      if (s.n_deferred >= s.n_deferred_max) {
+        s.n_deferred_max = CS_MAX(16, s.n_deferred_max*2);
+        BFT_REALLOC(s.deferred, s.n_deferred_max, unsigned char *);
+      }
+      s.deferred[s.n_deferred++] = msg;
+    }
+
+  }
+
+  /* Files not closed by all ranks are closed now */
+
+  for (int i = 0; i < s.n_deferred; i++)
+    BFT_FREE(s.deferred[i]);
+  BFT_FREE(s.deferred);
+
+  for (int i = 0; i < s.n_files; i++) {
+    fclose(s.files[i].sh);
+    BFT_FREE(s.files[i].name);
+  }
+  BFT_FREE(s.files);
+
+  MPI_Comm_free(&_io_comm);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete pending sends and release I/O servers.
+ *
+ * This function should be called on all compute ranks, after the last
+ * forwarded file has been closed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_io_server_finalize(void)
+{
+#if defined(HAVE_MPI)
+
+  if (_n_servers < 1 || _is_server)
+    return;
+
+  _complete_sends(0);
+
+  BFT_FREE(_pending_req);
+  BFT_FREE(_pending_buf);
+  BFT_FREE(_pending_size);
+  _n_pending_max = 0;
+
+  _msg_header_t h = {.type = _IO_EXIT,
+                     .id = {-1, -1},
+                     .mode = 0,
+                     .n_ranks = 0,
+                     .offset = 0,
+                     .size = 0};
+
+  for (int i = 0; i < _n_servers; i++)
+    MPI_Send(&h, sizeof(_msg_header_t), MPI_BYTE, _n_compute_ranks + i,
+             _CS_IO_SERVER_TAG, _io_comm);
+
+  MPI_Comm_free(&_io_comm);
+
+  _n_servers = 0;
+
+#endif /* defined(HAVE_MPI) */
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open a file through an I/O server.
+ *
+ * This function is collective on the given communicator (which may be
+ * MPI_COMM_NULL for a file opened by the local rank only).
+ *
+ * \param[in]  name  file name
+ * \param[in]  mode  file access mode: write or append
+ * \param[in]  comm  communicator associated with file
+ *
+ * \return  pointer to forwarded file descriptor, or NULL if no I/O servers
+ *          are available.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_io_server_file_t *
+cs_io_server_file_open(const char      *name,
+                       cs_file_mode_t   mode,
+                       MPI_Comm         comm)
+{
+  if (_n_servers < 1 || _is_server || mode == CS_FILE_MODE_READ)
+    return NULL;
+
+  int rank = 0, n_ranks = 1;
+
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &n_ranks);
+  }
+
+  cs_io_server_file_t *sf = NULL;
+  BFT_MALLOC(sf, 1, cs_io_server_file_t);
+
+  /* File ids are defined by the first rank sharing the file */
+
+  sf->id[0] = _io_rank;
+  sf->id[1] = _n_files_created;
+
+  if (n_ranks > 1)
+    MPI_Bcast(sf->id, 2, MPI_INT, 0, comm);
+
+  if (rank == 0)
+    _n_files_created += 1;
+
+  sf->server = _server_rank(name);
+
+  _msg_header_t h = {.type = _IO_OPEN,
+                     .id = {sf->id[0], sf->id[1]},
+                     .mode = mode,
+                     .n_ranks = n_ranks,
+                     .offset = 0,
+                     .size = strlen(name) + 1};
+
+  _post_message(sf->server, &h, name);
+
+  return sf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Post data to be written to a forwarded file.
+ *
+ * Data is copied, so the caller may reuse or free the buffer as soon as
+ * this function returns; the send itself is non-blocking.
+ *
+ * In append mode, offsets are relative to the end of file at the time
+ * it was opened.
+ *
+ * \param[in]  sf       forwarded file descriptor
+ * \param[in]  offset   offset (in bytes) at which data is written
+ * \param[in]  buf      pointer to data
+ * \param[in]  n_bytes  size of data, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_io_server_file_write(cs_io_server_file_t  *sf,
+                        cs_file_off_t         offset,
+                        const void           *buf,
+                        size_t                n_bytes)
+{
+  const unsigned char *_buf = buf;
+
+  _msg_header_t h = {.type = _IO_WRITE,
+                     .id = {sf->id[0], sf->id[1]},
+                     .mode = 0,
+                     .n_ranks = 0,
+                     .offset = offset,
+                     .size = 0};
+
+  /* Split large writes so that message sizes fit in an int */
+
+  for (size_t i = 0; i < n_bytes; i += _CS_IO_SERVER_CHUNK_SIZE) {
+    h.offset = offset + i;
+    h.size = CS_MIN(n_bytes - i, _CS_IO_SERVER_CHUNK_SIZE);
+    _post_message(sf->server, &h, _buf + i);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close a forwarded file.
+ *
+ * \param[in, out]  sf  pointer to forwarded file descriptor (set to NULL)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_io_server_file_close(cs_io_server_file_t  **sf)
+{
+  cs_io_server_file_t *_sf = *sf;
+
+  if (_sf == NULL)
+    return;
+
+  _msg_header_t h = {.type = _IO_CLOSE,
+                     .id = {_sf->id[0], _sf->id[1]},
+                     .mode = 0,
+                     .n_ranks = 0,
+                     .offset = 0,
+                     .size = 0};
+
+  _post_message(_sf->server, &h, NULL);
+
+  BFT_FREE(*sf);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
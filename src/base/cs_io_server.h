@@ -0,0 +1,187 @@
+#ifndef __CS_IO_SERVER_H__
+#define __CS_IO_SERVER_H__
+
+/*============================================================================
+ * Dedicated I/O server ranks for asynchronous file output.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_file.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Opaque descriptor for a file forwarded to an I/O server */
+
+typedef struct _cs_io_server_file_t cs_io_server_file_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Set aside the last ranks of the main communicator as I/O servers.
+ *
+ * This function must be called just after the main communicator has been
+ * defined, before it is used for anything else. On compute ranks, the main
+ * communicator (cs_glob_mpi_comm) and associated global variables are
+ * replaced by those restricted to compute ranks. On server ranks, the main
+ * communicator is restricted to server ranks.
+ *
+ * parameters:
+ *   n_servers <-- number of I/O server ranks
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_server_mpi_init(int  n_servers);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Return number of I/O server ranks.
+ *
+ * returns:
+ *   number of ranks dedicated to I/O (0 if inactive)
+ *----------------------------------------------------------------------------*/
+
+int
+cs_io_server_get_n_ranks(void);
+
+/*----------------------------------------------------------------------------
+ * Indicate if the local rank is an I/O server.
+ *
+ * returns:
+ *   true if the local rank is an I/O server, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_server_is_server(void);
+
+/*----------------------------------------------------------------------------
+ * Run the I/O server loop.
+ *
+ * This function returns once all compute ranks have called
+ * cs_io_server_finalize() and all pending writes have been completed.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_server_run(void);
+
+/*----------------------------------------------------------------------------
+ * Complete pending sends and release I/O servers.
+ *
+ * This function should be called on all compute ranks, after the last
+ * forwarded file has been closed.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_server_finalize(void);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Open a file through an I/O server.
+ *
+ * This function is collective on the given communicator (which may be
+ * MPI_COMM_NULL for a file opened by the local rank only).
+ *
+ * parameters:
+ *   name <-- file name
+ *   mode <-- file access mode: write or append
+ *   comm <-- communicator associated with file
+ *
+ * returns:
+ *   pointer to forwarded file descriptor, or NULL if no I/O servers are
+ *   available.
+ *----------------------------------------------------------------------------*/
+
+cs_io_server_file_t *
+cs_io_server_file_open(const char      *name,
+                       cs_file_mode_t   mode,
+                       MPI_Comm         comm);
+
+/*----------------------------------------------------------------------------
+ * Post data to be written to a forwarded file.
+ *
+ * Data is copied, so the caller may reuse or free the buffer as soon as
+ * this function returns; the send itself is non-blocking.
+ *
+ * In append mode, offsets are relative to the end of file at the time
+ * it was opened.
+ *
+ * parameters:
+ *   sf      <-- forwarded file descriptor
+ *   offset  <-- offset (in bytes) at which data is written
+ *   buf     <-- pointer to data
+ *   n_bytes <-- size of data, in bytes
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_server_file_write(cs_io_server_file_t  *sf,
+                        cs_file_off_t         offset,
+                        const void           *buf,
+                        size_t                n_bytes);
+
+/*----------------------------------------------------------------------------
+ * Close a forwarded file.
+ *
+ * parameters:
+ *   sf <-> pointer to forwarded file descriptor (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_server_file_close(cs_io_server_file_t  **sf);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_IO_SERVER_H__ */
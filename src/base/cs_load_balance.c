@@ -0,0 +1,319 @@
+/*============================================================================
+ * Runtime load imbalance monitoring and weighted repartitioning.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_parall.h"
+#include "cs_partition.h"
+#include "cs_time_step.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_load_balance.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_load_balance.c
+        Runtime load imbalance monitoring and weighted repartitioning.
+
+  Cell weights are estimated periodically, based on a unit weight per cell,
+  the cost of Lagrangian particles (calibrated using the "lagrangian_stage"
+  timer statistic), and optional user-defined weights. When the estimated
+  imbalance exceeds a given threshold, a new partitioning based on these
+  weights is written to "partition_output", and the computation may be
+  stopped with a checkpoint. As checkpoint files are independent of the
+  partitioning, restarting the computation using this partitioning as
+  input migrates all fields, time moments, and particles.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int     _interval = -1;
+static double  _imbalance_tol = 1.2;
+static bool    _stop_for_restart = false;
+
+static cs_load_balance_cell_weight_t  *_cell_weight_func = NULL;
+static void                           *_cell_weight_input = NULL;
+
+/* Reference values at previous check */
+
+static int     _nt_prev = -1;
+static double  _wt_prev = 0.;
+static double  _lagr_wt_prev = 0.;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return elapsed Lagrangian module wall-clock time on this rank.
+ *----------------------------------------------------------------------------*/
+
+static double
+_lagr_wtime(void)
+{
+  double retval = 0.;
+
+  int stats_id = cs_timer_stats_id_by_name("lagrangian_stage");
+
+  if (stats_id > -1) {
+    cs_timer_counter_t t = cs_timer_stats_get_total(stats_id);
+    retval = t.wall_nsec*1e-9;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Add estimated cost of Lagrangian particles to cell weights.
+ *
+ * The cost of a particle relative to that of a cell is estimated from
+ * the time spent in the Lagrangian module and in other stages since
+ * the previous check.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   wt          <-- elapsed wall-clock time since previous check
+ *   lagr_wt     <-- elapsed Lagrangian time since previous check
+ *   cell_weight <-> cell weights
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_particle_weights(const cs_mesh_t  *mesh,
+                      double            wt,
+                      double            lagr_wt,
+                      double            cell_weight[])
+{
+  if (cs_glob_lagr_time_scheme == NULL)
+    return;
+  if (cs_glob_lagr_time_scheme->iilagr < 1)
+    return;
+
+  const cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+
+  if (p_set == NULL)
+    return;
+
+  /* Global times and counts */
+
+  double s[3] = {p_set->n_particles, lagr_wt, wt - lagr_wt};
+
+  cs_parall_sum(3, CS_DOUBLE, s);
+
+  if (s[0] < 1 || s[1] <= 0 || s[2] <= 0)
+    return;
+
+  double p_cost = (s[1] / s[0]) / (s[2] / mesh->n_g_cells);
+
+  for (cs_lnum_t i = 0; i < p_set->n_particles; i++) {
+    cs_lnum_t c_num = cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_NUM);
+    cs_lnum_t c_id = CS_ABS(c_num) - 1;
+    if (c_id > -1 && c_id < mesh->n_cells)
+      cell_weight[c_id] += p_cost;
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define load balancing options.
+ *
+ * \param[in]  interval          number of time steps between load
+ *                               imbalance checks (< 1 to deactivate)
+ * \param[in]  imbalance_tol     estimated imbalance (maximum rank load
+ *                               over mean rank load) above which a new
+ *                               partitioning is computed
+ * \param[in]  stop_for_restart  if true, stop computation (with a checkpoint)
+ *                               after a new partitioning has been written
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_options(int     interval,
+                            double  imbalance_tol,
+                            bool    stop_for_restart)
+{
+  _interval = interval;
+  _imbalance_tol = imbalance_tol;
+  _stop_for_restart = stop_for_restart;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a function used to define or adjust cell weights.
+ *
+ * \param[in]       func   pointer to cell weight definition function
+ * \param[in, out]  input  pointer to optional (untyped) value or structure
+ *                         passed to func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_cell_weight_func(cs_load_balance_cell_weight_t  *func,
+                                     void                           *input)
+{
+  _cell_weight_func = func;
+  _cell_weight_input = input;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check load balance, and compute a new partitioning if required.
+ *
+ * This function should be called once per time step; it does nothing
+ * unless activated through \ref cs_load_balance_set_options.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_update(void)
+{
+  if (_interval < 1 || cs_glob_n_ranks < 2)
+    return;
+
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  double wt = cs_timer_wtime();
+  double lagr_wt = _lagr_wtime();
+
+  /* Initialize reference on first call */
+
+  if (_nt_prev < 0) {
+    _nt_prev = ts->nt_cur;
+    _wt_prev = wt;
+    _lagr_wt_prev = lagr_wt;
+    return;
+  }
+
+  if (ts->nt_cur - _nt_prev < _interval)
+    return;
+
+  const cs_mesh_t *mesh = cs_glob_mesh;
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  /* Estimate cell weights */
+
+  double *cell_weight = NULL;
+  BFT_MALLOC(cell_weight, n_cells, double);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_weight[i] = 1.;
+
+  _add_particle_weights(mesh,
+                        wt - _wt_prev,
+                        lagr_wt - _lagr_wt_prev,
+                        cell_weight);
+
+  if (_cell_weight_func != NULL)
+    _cell_weight_func(mesh, _cell_weight_input, cell_weight);
+
+  /* Estimated imbalance */
+
+  double r_load[2] = {0., 0.};
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    r_load[0] += cell_weight[i];
+  r_load[1] = r_load[0];
+
+  cs_parall_max(1, CS_DOUBLE, r_load);
+  cs_parall_sum(1, CS_DOUBLE, r_load + 1);
+
+  double imbalance = 1.;
+  if (r_load[1] > 0)
+    imbalance = r_load[0] * cs_glob_n_ranks / r_load[1];
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  " Estimated load imbalance: %.3g (threshold: %.3g)\n"),
+                imbalance, _imbalance_tol);
+
+  if (imbalance > _imbalance_tol) {
+
+    cs_partition_write_weighted(mesh, cell_weight, cs_glob_n_ranks, NULL);
+
+    if (_stop_for_restart && (ts->nt_max < 0 || ts->nt_max > ts->nt_cur)) {
+      cs_time_step_define_nt_max(ts->nt_cur);
+      bft_printf(_("\n"
+                   " Computation will stop at the end of this time step\n"
+                   " to allow restarting with the rebalanced partitioning\n"
+                   " (using \"partition_output\" as partitioning input).\n"));
+    }
+
+  }
+
+  BFT_FREE(cell_weight);
+
+  /* Reset references (excluding time spent here) */
+
+  _nt_prev = ts->nt_cur;
+  _wt_prev = cs_timer_wtime();
+  _lagr_wt_prev = _lagr_wtime();
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,123 @@
+#ifndef __CS_LOAD_BALANCE_H__
+#define __CS_LOAD_BALANCE_H__
+
+/*============================================================================
+ * Runtime load imbalance monitoring and weighted repartitioning.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function pointer for definition of cell computational weights.
+ *
+ * Weights are initialized by the caller (using a unit weight per cell,
+ * to which the estimated cost of particles is added when the Lagrangian
+ * module is active), and may be modified or replaced by this function.
+ *
+ * \param[in]       mesh         pointer to mesh structure
+ * \param[in, out]  input        pointer to optional (untyped) value
+ *                               or structure
+ * \param[in, out]  cell_weight  cell weights (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_load_balance_cell_weight_t) (const cs_mesh_t  *mesh,
+                                 void             *input,
+                                 double            cell_weight[]);
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define load balancing options.
+ *
+ * \param[in]  interval          number of time steps between load
+ *                               imbalance checks (< 1 to deactivate)
+ * \param[in]  imbalance_tol     estimated imbalance (maximum rank load
+ *                               over mean rank load) above which a new
+ *                               partitioning is computed
+ * \param[in]  stop_for_restart  if true, stop computation (with a checkpoint)
+ *                               after a new partitioning has been written
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_options(int     interval,
+                            double  imbalance_tol,
+                            bool    stop_for_restart);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a function used to define or adjust cell weights.
+ *
+ * \param[in]       func   pointer to cell weight definition function
+ * \param[in, out]  input  pointer to optional (untyped) value or structure
+ *                         passed to func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_cell_weight_func(cs_load_balance_cell_weight_t  *func,
+                                     void                           *input);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check load balance, and compute a new partitioning if required.
+ *
+ * This function should be called once per time step; it does nothing
+ * unless activated through \ref cs_load_balance_set_options.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_update(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LOAD_BALANCE_H__ */
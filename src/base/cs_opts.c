@@ -118,10 +118,16 @@ _arg_env_help(const char  *name)
   fprintf
     (e, _(" --benchmark       elementary operations performance\n"
           "                   [--mpitrace] operations done only once\n"
-          "                                for light MPI traces\n"));
+          "                                for light MPI traces\n"
+          "                   [--lagr]     Lagrangian particle transport\n"
+          "                                instead of linear algebra\n"));
   fprintf
     (e, _(" -h, --help        this help message\n\n"));
 
+  fprintf
+    (e, _(" --io-servers      <n> number of ranks dedicated to\n"
+          "                   asynchronous file output\n"));
+
   fprintf
     (e, _(" --mpi             force use of MPI for parallelism or coupling\n"
           "                   (usually automatic, only required for\n"
@@ -255,6 +261,7 @@ cs_opts_define(int         argc,
   opts->preprocess = false;
   opts->verif = false;
   opts->benchmark = 0;
+  opts->benchmark_lagr = false;
 
   opts->yacs_module = NULL;
 
@@ -274,11 +281,14 @@ cs_opts_define(int         argc,
 
     else if (strcmp(s, "--benchmark") == 0) {
       opts->benchmark = 1;
-      if (arg_id + 1 < argc) {
-        if (strcmp(argv[arg_id + 1], "--mpitrace") == 0) {
+      while (arg_id + 1 < argc) {
+        if (strcmp(argv[arg_id + 1], "--mpitrace") == 0)
           opts->benchmark = 2;
-          arg_id++;
-        }
+        else if (strcmp(argv[arg_id + 1], "--lagr") == 0)
+          opts->benchmark_lagr = true;
+        else
+          break;
+        arg_id++;
       }
     }
 
@@ -330,6 +340,11 @@ cs_opts_define(int         argc,
       /* Handled in pre-reading stage */
     }
 
+    else if (strcmp(s, "--io-servers") == 0) {
+      /* Handled in pre-reading stage */
+      _arg_to_int(++arg_id, argc, argv, &argerr);
+    }
+
 #else /* !defined(HAVE_MPI) */
 
     else if (strcmp(s, "--mpi") == 0) {
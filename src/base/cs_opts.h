@@ -75,6 +75,8 @@ typedef struct {
                                    0: not used;
                                    1: timing (CPU + Walltime) mode
                                    2: MPI trace-friendly mode */
+  bool           benchmark_lagr; /* Benchmark Lagrangian module instead
+                                    of elementary operations */
 
   /* Connection with YACS */
 
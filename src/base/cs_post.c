@@ -3386,6 +3386,7 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
  * - \c \b plot (comma or whitespace separated 2d plot files)
  * - \c \b time_plot (comma or whitespace separated time plot files)
+ * - \c \b XDMF (XML metadata with raw binary data, written in parallel)
  *
  * The format name is case-sensitive, so \c \b ensight or \c \b cgns are also valid.
  *
@@ -236,16 +236,35 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   cs_preprocessor_data_read_mesh(cs_glob_mesh,
                                  cs_glob_mesh_builder);
 
+  /* When the preprocessed mesh cache is used, joining, boundary insertion,
+     modification, smoothing and partitioning have already been applied */
+
+  bool use_cache = cs_preprocessor_data_cache_is_used();
+
+  if (use_cache) {
+    for (int i = 0; i < cs_internal_coupling_n_couplings(); i++) {
+      const cs_internal_coupling_t *cpl = cs_internal_coupling_by_id(i);
+      if (cpl->cells_criteria != NULL && cpl->faces_criteria == NULL)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Volume-based internal coupling requires boundary\n"
+                    "insertion and is not compatible with the use of\n"
+                    "a preprocessed mesh cache."));
+    }
+  }
+
   /* Join meshes / build periodicity links if necessary */
 
-  cs_join_all(true);
+  if (! use_cache)
+    cs_join_all(true);
 
   /* Insert boundaries if necessary */
 
-  cs_gui_mesh_boundary(cs_glob_mesh);
-  cs_user_mesh_boundary(cs_glob_mesh);
+  if (! use_cache) {
+    cs_gui_mesh_boundary(cs_glob_mesh);
+    cs_user_mesh_boundary(cs_glob_mesh);
 
-  cs_internal_coupling_preprocess(cs_glob_mesh);
+    cs_internal_coupling_preprocess(cs_glob_mesh);
+  }
 
   /* Initialize extended connectivity, ghost cells and other remaining
      parallelism-related structures */
@@ -255,8 +274,10 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   /* Possible geometry modification */
 
-  cs_gui_mesh_extrude(cs_glob_mesh);
-  cs_user_mesh_modify(cs_glob_mesh);
+  if (! use_cache) {
+    cs_gui_mesh_extrude(cs_glob_mesh);
+    cs_user_mesh_modify(cs_glob_mesh);
+  }
 
   /* Discard isolated faces if present */
 
@@ -265,12 +286,14 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   /* Smoothe mesh if required */
 
-  cs_gui_mesh_smoothe(cs_glob_mesh);
-  cs_user_mesh_smoothe(cs_glob_mesh);
+  if (! use_cache) {
+    cs_gui_mesh_smoothe(cs_glob_mesh);
+    cs_user_mesh_smoothe(cs_glob_mesh);
+  }
 
   /* Triangulate warped faces if necessary */
 
-  {
+  if (! use_cache) {
     double  cwf_threshold = -1.0;
     int  cwf_post = 0;
 
@@ -292,6 +315,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   cs_user_mesh_save(cs_glob_mesh); /* Disable or force */
 
   bool partition_preprocess = cs_partition_get_preprocess();
+  if (use_cache)
+    partition_preprocess = false;
   if (cs_glob_mesh->modified > 0 || partition_preprocess) {
     if (partition_preprocess) {
       if (cs_glob_mesh->modified > 0)
@@ -307,6 +332,10 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
       cs_mesh_save(cs_glob_mesh, NULL, NULL, "mesh_output");
   }
 
+  /* Save preprocessed and partitioned mesh to cache if required */
+
+  cs_preprocessor_data_write_cache(cs_glob_mesh);
+
   /* Destroy the temporary structure used to build the main mesh */
 
   cs_mesh_builder_destroy(&cs_glob_mesh_builder);
@@ -55,9 +55,13 @@
 #include "cs_block_dist.h"
 #include "cs_file.h"
 #include "cs_interface.h"
+#include "cs_join_util.h"
 #include "cs_mesh.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
+#include "cs_mesh_save.h"
+#include "cs_mesh_to_builder.h"
+#include "cs_mesh_warping.h"
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_io.h"
@@ -143,6 +147,18 @@ int _n_mesh_files = 0;
 int _n_max_mesh_files = 0;
 _mesh_file_info_t  *_mesh_file_info = NULL;
 
+/* Preprocessed mesh cache */
+
+static cs_preprocessor_data_cache_mode_t  _cache_mode
+  = CS_PREPROCESSOR_DATA_CACHE_NONE;
+
+static bool       _cache_used = false;
+static bool       _cache_full_check = false;
+static cs_gnum_t  _cache_checksum = 0;
+
+static const char _cache_dir[] = "mesh_cache";
+static const char _cache_magic_string[] = "Mesh cache partitioning, R0";
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -283,6 +299,420 @@ _mesh_reader_destroy(_mesh_reader_t  **mr)
   BFT_FREE(*mr);
 }
 
+/*----------------------------------------------------------------------------
+ * Update a checksum (32-bit FNV-1a hash) with a given array of bytes.
+ *
+ * parameters:
+ *   checksum <-- initial checksum value
+ *   data     <-- pointer to data
+ *   size     <-- data size, in bytes
+ *
+ * returns:
+ *   updated checksum value
+ *----------------------------------------------------------------------------*/
+
+static uint32_t
+_checksum_update(uint32_t     checksum,
+                 const void  *data,
+                 size_t       size)
+{
+  const unsigned char *p = (const unsigned char *)data;
+
+  for (size_t i = 0; i < size; i++) {
+    checksum ^= p[i];
+    checksum *= 16777619u;
+  }
+
+  return checksum;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a checksum (32-bit FNV-1a hash) with a sample of a file.
+ *
+ * The file name, its size, its header and a few blocks spread over its
+ * contents are used, so that a regenerated mesh is detected without
+ * reading the whole file. If full_check is true (or the file is small),
+ * the whole file contents are used.
+ *
+ * The file is read by rank 0 only, and the result is broadcast to
+ * other ranks. If the file is not found, only its name is used.
+ *
+ * parameters:
+ *   checksum   <-- initial checksum value
+ *   path       <-- file path
+ *   full_check <-- if true, use whole file contents
+ *
+ * returns:
+ *   updated checksum value
+ *----------------------------------------------------------------------------*/
+
+static uint32_t
+_checksum_update_file(uint32_t     checksum,
+                      const char  *path,
+                      bool         full_check)
+{
+  const size_t  header_size = 65536;
+  const size_t  sample_size = 4096;
+  const int     n_samples = 8;
+
+  checksum = _checksum_update(checksum, path, strlen(path));
+
+  if (cs_glob_rank_id < 1 && cs_file_isreg(path)) {
+
+    cs_file_off_t  f_size = cs_file_size(path);
+    checksum = _checksum_update(checksum, &f_size, sizeof(cs_file_off_t));
+
+    cs_file_off_t  min_sampled_size
+      = header_size + (n_samples + 1)*sample_size;
+    if (f_size <= min_sampled_size)
+      full_check = true;
+
+    const size_t  buf_size = (full_check) ? 1 << 20 : header_size;
+    unsigned char  *buf = NULL;
+    BFT_MALLOC(buf, buf_size, unsigned char);
+
+    cs_file_t  *f = cs_file_open_serial(path, CS_FILE_MODE_READ);
+
+    if (full_check) {
+      for (cs_file_off_t n_done = 0; n_done < f_size; ) {
+        size_t  n_read = buf_size;
+        if (f_size - n_done < (cs_file_off_t)buf_size)
+          n_read = f_size - n_done;
+        cs_file_read_global(f, buf, 1, n_read);
+        checksum = _checksum_update(checksum, buf, n_read);
+        n_done += n_read;
+      }
+    }
+    else {
+
+      /* Header */
+
+      cs_file_read_global(f, buf, 1, header_size);
+      checksum = _checksum_update(checksum, buf, header_size);
+
+      /* Evenly spaced blocks, the last one ending at the end of file */
+
+      for (int i = 1; i <= n_samples; i++) {
+        cs_file_off_t  offset
+          = header_size + (f_size - header_size - sample_size)*i/n_samples;
+        cs_file_seek(f, offset, CS_FILE_SEEK_SET);
+        cs_file_read_global(f, buf, 1, sample_size);
+        checksum = _checksum_update(checksum, buf, sample_size);
+      }
+
+    }
+
+    f = cs_file_free(f);
+    BFT_FREE(buf);
+
+  }
+
+  cs_parall_bcast(0, 1, CS_UINT32, &checksum);
+
+  return checksum;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute checksum of inputs and options defining the preprocessed mesh.
+ *
+ * This must be called before the mesh file info is transferred to
+ * the mesh reader.
+ *
+ * returns:
+ *   checksum value
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_cache_compute_checksum(void)
+{
+  uint32_t c = 2166136261u;
+
+  /* Input files and associated transformations */
+
+  for (int i = 0; i < _n_mesh_files; i++) {
+
+    const _mesh_file_info_t  *f = _mesh_file_info + i;
+
+    c = _checksum_update_file(c, f->filename, _cache_full_check);
+
+    if (f->matrix != NULL)
+      c = _checksum_update(c, f->matrix, 12*sizeof(double));
+
+    for (size_t j = 0; j < f->n_group_renames; j++) {
+      c = _checksum_update(c, f->old_group_names[j],
+                           strlen(f->old_group_names[j]));
+      if (f->new_group_names[j] != NULL)
+        c = _checksum_update(c, f->new_group_names[j],
+                             strlen(f->new_group_names[j]));
+    }
+
+  }
+
+  /* Partitioning is only valid for a given number of ranks */
+
+  c = _checksum_update(c, &cs_glob_n_ranks, sizeof(int));
+
+  /* Preprocessing joinings and periodicities
+     (fields are handled individually so as to ignore padding) */
+
+  for (int i = 0; i < cs_glob_n_joinings; i++) {
+
+    const cs_join_t  *join = cs_glob_join_array[i];
+    const cs_join_param_t  *p = &(join->param);
+
+    if (p->preprocessing == false)
+      continue;
+
+    if (join->criteria != NULL)
+      c = _checksum_update(c, join->criteria, strlen(join->criteria));
+
+    c = _checksum_update(c, &(p->perio_type), sizeof(int));
+    c = _checksum_update(c, p->perio_matrix, 12*sizeof(double));
+    c = _checksum_update(c, &(p->fraction), sizeof(float));
+    c = _checksum_update(c, &(p->plane), sizeof(float));
+    c = _checksum_update(c, &(p->merge_tol_coef), sizeof(float));
+    c = _checksum_update(c, &(p->pre_merge_factor), sizeof(float));
+    c = _checksum_update(c, &(p->n_max_equiv_breaks), sizeof(int));
+    c = _checksum_update(c, &(p->tcm), sizeof(int));
+    c = _checksum_update(c, &(p->icm), sizeof(int));
+    c = _checksum_update(c, &(p->max_sub_faces), sizeof(int));
+
+  }
+
+  /* Warped faces cutting */
+
+  {
+    double  cwf_threshold = -1.0;
+    int  cwf_post = 0;
+
+    cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
+
+    c = _checksum_update(c, &cwf_threshold, sizeof(double));
+  }
+
+  return (cs_gnum_t)c;
+}
+
+/*----------------------------------------------------------------------------
+ * Build name of a mesh cache file for the current number of ranks.
+ *
+ * parameters:
+ *   prefix    <-- file name prefix
+ *   file_name --> file name (size: 64)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_file_name(const char  *prefix,
+                 char         file_name[64])
+{
+  snprintf(file_name, 64, "%s%c%s_%d",
+           _cache_dir, _dir_separator, prefix, cs_glob_n_ranks);
+  file_name[63] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Open mesh cache partitioning file.
+ *
+ * parameters:
+ *   mode <-- read or write mode
+ *   echo <-- echo on main output (< 0 if none, header if 0,
+ *            n first and last elements if n > 0)
+ *
+ * returns:
+ *   pointer to cs_io_t structure
+ *----------------------------------------------------------------------------*/
+
+static cs_io_t *
+_cache_partition_open(cs_io_mode_t  mode,
+                      long          echo)
+{
+  char file_name[64];
+  cs_file_access_t  method;
+  cs_io_t  *pp = NULL;
+
+  cs_file_mode_t f_mode
+    = (mode == CS_IO_MODE_READ) ? CS_FILE_MODE_READ : CS_FILE_MODE_WRITE;
+
+  _cache_file_name("domain_number", file_name);
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info  hints;
+    MPI_Comm  block_comm, comm;
+    cs_file_get_default_access(f_mode, &method, &hints);
+    cs_file_get_default_comm(NULL, NULL, &block_comm, &comm);
+    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+    pp = cs_io_initialize(file_name,
+                          _cache_magic_string,
+                          mode,
+                          method,
+                          echo,
+                          hints,
+                          block_comm,
+                          comm);
+  }
+#else
+  {
+    cs_file_get_default_access(f_mode, &method);
+    pp = cs_io_initialize(file_name,
+                          _cache_magic_string,
+                          mode,
+                          method,
+                          echo);
+  }
+#endif
+
+  return pp;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a valid mesh cache is available.
+ *
+ * returns:
+ *   true if mesh cache files are present and match the current checksum
+ *----------------------------------------------------------------------------*/
+
+static bool
+_cache_check(void)
+{
+  char mesh_name[64], part_name[64];
+  cs_io_sec_header_t  header;
+
+  int n_checked = 0;
+  bool is_valid = true;
+
+  _cache_file_name("mesh_input", mesh_name);
+  _cache_file_name("domain_number", part_name);
+
+  if (! (cs_file_isreg(mesh_name) && cs_file_isreg(part_name))) {
+    bft_printf(_(" No valid mesh cache for %d rank(s) in \"%s\".\n"),
+               cs_glob_n_ranks, _cache_dir);
+    return false;
+  }
+
+  /* Only metadata is read here, so use serial access */
+
+#if defined(HAVE_MPI)
+  cs_io_t  *pp_in = cs_io_initialize(part_name,
+                                     _cache_magic_string,
+                                     CS_IO_MODE_READ,
+                                     CS_FILE_STDIO_SERIAL,
+                                     CS_IO_ECHO_NONE,
+                                     MPI_INFO_NULL,
+                                     MPI_COMM_NULL,
+                                     cs_glob_mpi_comm);
+#else
+  cs_io_t  *pp_in = cs_io_initialize(part_name,
+                                     _cache_magic_string,
+                                     CS_IO_MODE_READ,
+                                     CS_FILE_STDIO_SERIAL,
+                                     CS_IO_ECHO_NONE);
+#endif
+
+  /* Checksum and number of ranks precede partitioning data */
+
+  while (n_checked < 2 && is_valid) {
+
+    if (cs_io_read_header(pp_in, &header) != 0) {
+      is_valid = false;
+      break;
+    }
+
+    if (strncmp(header.sec_name, "checksum", CS_IO_NAME_LEN) == 0) {
+      cs_gnum_t checksum = 0;
+      cs_io_set_cs_gnum(&header, pp_in);
+      cs_io_read_global(&header, &checksum, pp_in);
+      if (checksum != _cache_checksum)
+        is_valid = false;
+      n_checked++;
+    }
+    else if (strncmp(header.sec_name, "n_ranks", CS_IO_NAME_LEN) == 0) {
+      cs_lnum_t n_ranks = 0;
+      cs_io_set_cs_lnum(&header, pp_in);
+      cs_io_read_global(&header, &n_ranks, pp_in);
+      if (n_ranks != cs_glob_n_ranks)
+        is_valid = false;
+      n_checked++;
+    }
+    else
+      is_valid = false;
+
+  }
+
+  cs_io_finalize(&pp_in);
+
+  if (is_valid)
+    bft_printf(_(" Using mesh cache: \"%s\"\n\n"), mesh_name);
+  else
+    bft_printf(_(" Mesh cache in \"%s\" does not match current inputs;\n"
+                 " it will be ignored.\n"), _cache_dir);
+
+  return is_valid;
+}
+
+/*----------------------------------------------------------------------------
+ * Read cell rank from mesh cache.
+ *
+ * Block ranges must have been defined before calling this function.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *   mb   <-> pointer to mesh builder helper structure
+ *   echo <-- echo (verbosity) level
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_read_cell_rank(cs_mesh_t          *mesh,
+                      cs_mesh_builder_t  *mb,
+                      long                echo)
+{
+  cs_io_sec_header_t  header;
+
+  const char  *unexpected_msg = N_("Section of type <%s> on <%s>\n"
+                                   "unexpected or of incorrect size");
+
+  cs_io_t  *pp_in = _cache_partition_open(CS_IO_MODE_READ, echo);
+
+  while (pp_in != NULL) {
+
+    if (cs_io_read_header(pp_in, &header) != 0) {
+      cs_io_finalize(&pp_in);
+      break;
+    }
+
+    if (strncmp(header.sec_name, "cell:domain number",
+                CS_IO_NAME_LEN) == 0) {
+
+      cs_lnum_t n_elts = 0;
+
+      if (header.n_vals != (cs_file_off_t)(mesh->n_g_cells))
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name, cs_io_get_name(pp_in));
+
+      if (mb->cell_bi.gnum_range[0] > 0)
+        n_elts = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+      mb->have_cell_rank = true;
+      BFT_REALLOC(mb->cell_rank, n_elts, int);
+
+      cs_io_set_cs_lnum(&header, pp_in);
+      cs_io_read_block(&header,
+                       mb->cell_bi.gnum_range[0],
+                       mb->cell_bi.gnum_range[1],
+                       mb->cell_rank, pp_in);
+
+      for (cs_lnum_t i = 0; i < n_elts; i++) /* 1 to n to 0 to n-1 */
+        mb->cell_rank[i] -= 1;
+
+      cs_io_finalize(&pp_in);
+
+    }
+    else
+      cs_io_skip(&header, pp_in);
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add a periodicity to mesh->periodicities (fvm_periodicity_t *) structure.
  *
@@ -1976,6 +2406,82 @@ cs_preprocessor_data_add_file(const char     *file_name,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Define preprocessed mesh cache mode.
+ *
+ * The mesh cache contains the mesh resulting from all preprocessing
+ * operations (joining, periodicity, boundary insertion, user modifications,
+ * smoothing, warped faces cutting) and its partitioning. It is written in
+ * the "mesh_cache" directory, for the current number of ranks.
+ *
+ * When the cache is used, it is read instead of the mesh input files
+ * and the preprocessing and partitioning operations are skipped, as long
+ * as the number of ranks and a checksum based on the input files
+ * (names, sizes, sampled contents, transformations, group renames) and
+ * joining and warped face cutting options match. Changes in user mesh
+ * modification or smoothing functions are not detected, so the cache
+ * should be removed if those are modified.
+ *
+ * This function should be called before mesh metadata is read
+ * (i.e. in cs_user_mesh_input).
+ *
+ * parameters:
+ *   mode <-- mesh cache mode
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_set_cache_mode(cs_preprocessor_data_cache_mode_t  mode)
+{
+  _cache_mode = mode;
+}
+
+/*----------------------------------------------------------------------------
+ * Define whether the whole contents of mesh input files are used to check
+ * the validity of the preprocessed mesh cache.
+ *
+ * By default, only the file names and sizes, the file headers and a few
+ * sampled blocks are used, which avoids reading the whole mesh input on
+ * rank 0 at each startup. A full check detects any change in input files,
+ * at the cost of reading them entirely.
+ *
+ * parameters:
+ *   full_check <-- true to use whole file contents, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_set_cache_full_check(bool  full_check)
+{
+  _cache_full_check = full_check;
+}
+
+/*----------------------------------------------------------------------------
+ * Return preprocessed mesh cache mode.
+ *
+ * returns:
+ *   mesh cache mode
+ *----------------------------------------------------------------------------*/
+
+cs_preprocessor_data_cache_mode_t
+cs_preprocessor_data_get_cache_mode(void)
+{
+  return _cache_mode;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if the preprocessed mesh cache is used for the current run.
+ *
+ * This is known once mesh metadata has been read.
+ *
+ * returns:
+ *   true if the mesh is read from a valid mesh cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_preprocessor_data_cache_is_used(void)
+{
+  return _cache_used;
+}
+
 /*----------------------------------------------------------------------------
  * Check for periodicity information in mesh meta-data.
  *
@@ -2036,6 +2542,23 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
   _set_default_input_if_needed();
 
+  /* Replace input files by preprocessed mesh cache if valid */
+
+  if (_cache_mode != CS_PREPROCESSOR_DATA_CACHE_NONE)
+    _cache_checksum = _cache_compute_checksum();
+
+  if (_cache_mode == CS_PREPROCESSOR_DATA_CACHE_USE)
+    _cache_used = _cache_check();
+
+  if (_cache_used) {
+    char mesh_name[64];
+    _cache_file_name("mesh_input", mesh_name);
+    for (int i = 0; i < _n_mesh_files; i++)
+      BFT_FREE((_mesh_file_info + i)->data);
+    _n_mesh_files = 0;
+    cs_preprocessor_data_add_file(mesh_name, 0, NULL, NULL);
+  }
+
   _cs_glob_mesh_reader = _mesh_reader_create(&_n_mesh_files,
                                              &_mesh_file_info);
 
@@ -2133,6 +2656,13 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   else
     _set_block_ranges(mesh, mesh_builder);
 
+  /* Use partitioning from preprocessed mesh cache if available */
+
+  if (_cache_used && ! pre_partitioned && cs_glob_n_ranks > 1) {
+    _cache_read_cell_rank(mesh, mesh_builder, echo);
+    pre_partitioned = mesh_builder->have_cell_rank;
+  }
+
   for (file_id = 0; file_id < mr->n_files; file_id++)
     _read_data(file_id, mesh, mesh_builder, mr, echo);
 
@@ -2161,6 +2691,90 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   cs_mesh_clean_families(mesh);
 }
 
+/*----------------------------------------------------------------------------
+ * Write preprocessed mesh cache if required.
+ *
+ * The mesh and its current partitioning are saved, unless the cache
+ * mode is CS_PREPROCESSOR_DATA_CACHE_NONE or the mesh was read from
+ * a valid cache.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_write_cache(cs_mesh_t  *mesh)
+{
+  if (_cache_mode == CS_PREPROCESSOR_DATA_CACHE_NONE || _cache_used)
+    return;
+
+  char mesh_name[64];
+
+  const cs_datatype_t gnum_type
+    = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+  const cs_datatype_t lnum_type
+    = (sizeof(cs_lnum_t) == 8) ? CS_INT64 : CS_INT32;
+  const cs_datatype_t int_type
+    = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+
+  /* Save mesh (this also creates the cache directory) */
+
+  snprintf(mesh_name, 64, "mesh_input_%d", cs_glob_n_ranks);
+  mesh_name[63] = '\0';
+
+  cs_mesh_save(mesh, NULL, _cache_dir, mesh_name);
+
+  /* Save checksum and partitioning */
+
+  cs_io_t  *pp_out = _cache_partition_open(CS_IO_MODE_WRITE,
+                                           CS_IO_ECHO_OPEN_CLOSE);
+
+  cs_lnum_t n_ranks = cs_glob_n_ranks;
+
+  cs_io_write_global("checksum", 1, 0, 0, 1, gnum_type,
+                     &_cache_checksum, pp_out);
+  cs_io_write_global("n_ranks", 1, 0, 0, 1, lnum_type,
+                     &n_ranks, pp_out);
+  cs_io_write_global("n_cells", 1, 1, 0, 1, gnum_type,
+                     &(mesh->n_g_cells), pp_out);
+
+  if (cs_glob_n_ranks > 1) {
+
+    int block_rank_step = 1;
+    cs_mesh_builder_t  *mb = cs_mesh_builder_create();
+
+#if defined(HAVE_MPI)
+    cs_file_get_default_comm(&block_rank_step, NULL, NULL, NULL);
+#endif
+
+    mb->min_rank_step = block_rank_step;
+    cs_mesh_to_builder_partition(mesh, mb);
+
+    cs_lnum_t n_elts = 0;
+    if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+      n_elts = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) /* 0 to n-1 to 1 to n */
+      mb->cell_rank[i] += 1;
+
+    cs_io_write_block_buffer("cell:domain number",
+                             mesh->n_g_cells,
+                             mb->cell_bi.gnum_range[0],
+                             mb->cell_bi.gnum_range[1],
+                             1, /* location_id */
+                             0, /* index id */
+                             1, /* n_location_vals */
+                             int_type,
+                             mb->cell_rank,
+                             pp_out);
+
+    cs_mesh_builder_destroy(&mb);
+
+  }
+
+  cs_io_finalize(&pp_out);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
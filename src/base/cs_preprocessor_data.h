@@ -44,6 +44,21 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Preprocessed mesh cache mode */
+
+typedef enum {
+
+  CS_PREPROCESSOR_DATA_CACHE_NONE,    /* Do not use or write mesh cache */
+  CS_PREPROCESSOR_DATA_CACHE_WRITE,   /* Write mesh cache after preprocessing */
+  CS_PREPROCESSOR_DATA_CACHE_USE      /* Use mesh cache if valid,
+                                         (re)write it otherwise */
+
+} cs_preprocessor_data_cache_mode_t;
+
 /*============================================================================
  *  Public function prototypes for Fortran API
  *============================================================================*/
@@ -89,6 +104,70 @@ cs_preprocessor_data_add_file(const char     *file_name,
                               const char    **group_rename,
                               const double    transf_matrix[3][4]);
 
+/*----------------------------------------------------------------------------
+ * Define preprocessed mesh cache mode.
+ *
+ * The mesh cache contains the mesh resulting from all preprocessing
+ * operations (joining, periodicity, boundary insertion, user modifications,
+ * smoothing, warped faces cutting) and its partitioning. It is written in
+ * the "mesh_cache" directory, for the current number of ranks.
+ *
+ * When the cache is used, it is read instead of the mesh input files
+ * and the preprocessing and partitioning operations are skipped, as long
+ * as the number of ranks and a checksum based on the input files
+ * (names, sizes, sampled contents, transformations, group renames) and
+ * joining and warped face cutting options match. Changes in user mesh
+ * modification or smoothing functions are not detected, so the cache
+ * should be removed if those are modified.
+ *
+ * This function should be called before mesh metadata is read
+ * (i.e. in cs_user_mesh_input).
+ *
+ * parameters:
+ *   mode <-- mesh cache mode
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_set_cache_mode(cs_preprocessor_data_cache_mode_t  mode);
+
+/*----------------------------------------------------------------------------
+ * Define whether the whole contents of mesh input files are used to check
+ * the validity of the preprocessed mesh cache.
+ *
+ * By default, only the file names and sizes, the file headers and a few
+ * sampled blocks are used, which avoids reading the whole mesh input on
+ * rank 0 at each startup. A full check detects any change in input files,
+ * at the cost of reading them entirely.
+ *
+ * parameters:
+ *   full_check <-- true to use whole file contents, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_set_cache_full_check(bool  full_check);
+
+/*----------------------------------------------------------------------------
+ * Return preprocessed mesh cache mode.
+ *
+ * returns:
+ *   mesh cache mode
+ *----------------------------------------------------------------------------*/
+
+cs_preprocessor_data_cache_mode_t
+cs_preprocessor_data_get_cache_mode(void);
+
+/*----------------------------------------------------------------------------
+ * Indicate if the preprocessed mesh cache is used for the current run.
+ *
+ * This is known once mesh metadata has been read.
+ *
+ * returns:
+ *   true if the mesh is read from a valid mesh cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_preprocessor_data_cache_is_used(void);
+
 /*----------------------------------------------------------------------------
  * Check for periodicity information in mesh meta-data.
  *
@@ -133,6 +212,20 @@ void
 cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
                                cs_mesh_builder_t  *mesh_builder);
 
+/*----------------------------------------------------------------------------
+ * Write preprocessed mesh cache if required.
+ *
+ * The mesh and its current partitioning are saved, unless the cache
+ * mode is CS_PREPROCESSOR_DATA_CACHE_NONE or the mesh was read from
+ * a valid cache.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_write_cache(cs_mesh_t  *mesh);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -68,6 +68,26 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Philox4x32 multipliers and key schedule (Weyl sequence) constants */
+
+#define CS_RANDOM_PHILOX_M0  0xD2511F53U
+#define CS_RANDOM_PHILOX_M1  0xCD9E8D57U
+#define CS_RANDOM_PHILOX_W0  0x9E3779B9U
+#define CS_RANDOM_PHILOX_W1  0xBB67AE85U
+
+/* Number of counters handled together by the counter-based generator */
+
+#define CS_RANDOM_CB_BLOCK  64
+
+/* Counter-based generator sub-streams (the second key word), so that
+   variates of different distributions with identical keys are independent;
+   a Poisson variate uses as many sub-streams as needed, starting at
+   CS_RANDOM_CB_POISSON. */
+
+#define CS_RANDOM_CB_UNIFORM  0
+#define CS_RANDOM_CB_NORMAL   1
+#define CS_RANDOM_CB_POISSON  2
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -171,6 +191,182 @@ _normal00(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox4x32-10 bijection for a block of counters.
+ *
+ * Counters are stored by word, so that rounds may be vectorized
+ * over the block.
+ *
+ * Reference: J.K. Salmon, M.A. Moraes, R.O. Dror, D.E. Shaw,
+ * "Parallel random numbers: as easy as 1, 2, 3", SC11 (2011).
+ *
+ * \param[in]       n     number of counters (<= CS_RANDOM_CB_BLOCK)
+ * \param[in]       key0  first key word
+ * \param[in]       key1  second key word
+ * \param[in, out]  c     counter words in, random words out
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_philox4x32_10(int       n,
+               uint32_t  key0,
+               uint32_t  key1,
+               uint32_t  c[4][CS_RANDOM_CB_BLOCK])
+{
+  for (int r = 0; r < 10; r++) {
+
+#   pragma omp simd
+    for (int i = 0; i < n; i++) {
+      uint64_t p0 = (uint64_t)CS_RANDOM_PHILOX_M0 * c[0][i];
+      uint64_t p1 = (uint64_t)CS_RANDOM_PHILOX_M1 * c[2][i];
+      c[0][i] = (uint32_t)(p1 >> 32) ^ c[1][i] ^ key0;
+      c[1][i] = (uint32_t)p1;
+      c[2][i] = (uint32_t)(p0 >> 32) ^ c[3][i] ^ key1;
+      c[3][i] = (uint32_t)p0;
+    }
+
+    key0 += CS_RANDOM_PHILOX_W0;
+    key1 += CS_RANDOM_PHILOX_W1;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Convert 2 random words to a double in the open interval (0, 1).
+ *
+ * \param[in]  hi  high word
+ * \param[in]  lo  low word
+ *
+ * \return  uniform value in (0, 1)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline double
+_cb_to_unit(uint32_t  hi,
+            uint32_t  lo)
+{
+  uint64_t x = ((uint64_t)hi << 32) | lo;
+
+  /* 53 high bits, centered in their interval so that 0 and 1 are excluded */
+  return ((double)(x >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set counter words for a given id, time step, and counter index.
+ *
+ * \param[in]       i          index in block
+ * \param[in]       gid        id (global particle number)
+ * \param[in]       time_step  time step number
+ * \param[in]       c_id       counter index for this id and time step
+ * \param[in, out]  c          counter words
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_cb_set_counter(int        i,
+                cs_gnum_t  gid,
+                int        time_step,
+                uint32_t   c_id,
+                uint32_t   c[4][CS_RANDOM_CB_BLOCK])
+{
+  uint64_t _gid = (uint64_t)gid;
+
+  c[0][i] = (uint32_t)(_gid & 0xffffffffU);
+  c[1][i] = (uint32_t)(_gid >> 32);
+  c[2][i] = (uint32_t)time_step;
+  c[3][i] = c_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Generate uniform or normal values with the counter-based generator.
+ *
+ * Draw d of a given id is obtained from the (d/2)-th counter for that id,
+ * so values only depend on the keys, not on the calling sequence.
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws per id
+ * \param[in]   normal     if true, apply Box-Muller transform
+ * \param[out]  x          generated values (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cb_generate(unsigned          seed,
+             int               time_step,
+             cs_lnum_t         n_ids,
+             const cs_gnum_t   ids[],
+             int               draw_id,
+             int               n_draws,
+             bool              normal,
+             cs_real_t         x[])
+{
+  if (n_ids < 1 || n_draws < 1)
+    return;
+
+  const double twopi = 6.2831853071795862;
+
+  const uint32_t stream = (normal) ? CS_RANDOM_CB_NORMAL : CS_RANDOM_CB_UNIFORM;
+
+  const int c_s = draw_id / 2;
+  const cs_gnum_t n_c = (draw_id + n_draws - 1)/2 - c_s + 1;
+  const cs_gnum_t n_tot = (cs_gnum_t)n_ids * n_c;
+
+  uint32_t c[4][CS_RANDOM_CB_BLOCK];
+  double   u[2][CS_RANDOM_CB_BLOCK];
+
+  for (cs_gnum_t s_id = 0; s_id < n_tot; s_id += CS_RANDOM_CB_BLOCK) {
+
+    int n = CS_RANDOM_CB_BLOCK;
+    if (n_tot - s_id < CS_RANDOM_CB_BLOCK)
+      n = n_tot - s_id;
+
+    for (int i = 0; i < n; i++) {
+      cs_gnum_t k = s_id + i;
+      cs_gnum_t gid = (ids != NULL) ? ids[k / n_c] : k / n_c;
+      _cb_set_counter(i, gid, time_step, c_s + k % n_c, c);
+    }
+
+    _philox4x32_10(n, seed, stream, c);
+
+#   pragma omp simd
+    for (int i = 0; i < n; i++) {
+      u[0][i] = _cb_to_unit(c[1][i], c[0][i]);
+      u[1][i] = _cb_to_unit(c[3][i], c[2][i]);
+    }
+
+    if (normal) {
+#     pragma omp simd
+      for (int i = 0; i < n; i++) {
+        double r = sqrt(-2.*log(u[0][i]));
+        double t = twopi * u[1][i];
+        u[0][i] = r * cos(t);
+        u[1][i] = r * sin(t);
+      }
+    }
+
+    /* Keep only values in the requested draw range */
+
+    for (int i = 0; i < n; i++) {
+      cs_gnum_t k = s_id + i;
+      cs_lnum_t id = k / n_c;
+      int j = 2*(c_s + k % n_c) - draw_id;
+      if (j >= 0)
+        x[id*n_draws + j] = u[0][i];
+      if (j + 1 < n_draws)
+        x[id*n_draws + j + 1] = u[1][i];
+    }
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -585,6 +781,144 @@ cs_random_restore(cs_real_t  save_block[1634])
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Uniform distribution counter-based random number generator.
+ *
+ * Values are obtained from the Philox4x32-10 counter-based generator,
+ * keyed by the seed, an id (usually a particle's global number), the time
+ * step number, and a draw index, so that they do not depend on the
+ * processing order, thread, or rank. This generator has no state, so
+ * it may be called concurrently, and needs nothing saved for restarts.
+ *
+ * For id ids[i] (or i if ids is NULL), the value of draw index
+ * draw_id + j is returned in a[i*n_draws + j].
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws for each id
+ * \param[out]  a          pseudo-random numbers following uniform
+ *                         distribution in (0, 1) (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_cb_uniform(unsigned         seed,
+                     int              time_step,
+                     cs_lnum_t        n_ids,
+                     const cs_gnum_t  ids[],
+                     int              draw_id,
+                     int              n_draws,
+                     cs_real_t        a[])
+{
+  _cb_generate(seed, time_step, n_ids, ids, draw_id, n_draws, false, a);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Normal distribution counter-based random number generator.
+ *
+ * Box-Muller method applied to the counter-based generator
+ * (see \ref cs_random_cb_uniform).
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws for each id
+ * \param[out]  x          pseudo-random numbers following normal
+ *                         distribution (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_cb_normal(unsigned         seed,
+                    int              time_step,
+                    cs_lnum_t        n_ids,
+                    const cs_gnum_t  ids[],
+                    int              draw_id,
+                    int              n_draws,
+                    cs_real_t        x[])
+{
+  _cb_generate(seed, time_step, n_ids, ids, draw_id, n_draws, true, x);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Poisson distribution counter-based random number generator.
+ *
+ * q(mu,p) = exp(-mu) mu**p/p!
+ *
+ * Uniform values are multiplied until their product drops below
+ * exp(-mu), using the counter-based generator
+ * (see \ref cs_random_cb_uniform).
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws for each id
+ * \param[in]   mu         Poisson distribution parameter
+ * \param[out]  p          pseudo-random numbers following Poisson
+ *                         distribution (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_cb_poisson(unsigned         seed,
+                     int              time_step,
+                     cs_lnum_t        n_ids,
+                     const cs_gnum_t  ids[],
+                     int              draw_id,
+                     int              n_draws,
+                     cs_real_t        mu,
+                     int              p[])
+{
+  uint32_t c[4][CS_RANDOM_CB_BLOCK];
+
+  const double pmu = exp(-mu);
+
+  for (cs_lnum_t i = 0; i < n_ids; i++) {
+
+    cs_gnum_t gid = (ids != NULL) ? ids[i] : (cs_gnum_t)i;
+
+    for (int j = 0; j < n_draws; j++) {
+
+      int k = 0;
+      double q = 1.;
+
+      /* Each counter provides 2 uniform values; successive counters
+         for a given draw use successive sub-streams */
+
+      for (uint32_t stream = CS_RANDOM_CB_POISSON; true; stream++) {
+
+        _cb_set_counter(0, gid, time_step, draw_id + j, c);
+        _philox4x32_10(1, seed, stream, c);
+
+        q *= _cb_to_unit(c[1][0], c[0][0]);
+        if (q <= pmu)
+          break;
+        k++;
+
+        q *= _cb_to_unit(c[3][0], c[2][0]);
+        if (q <= pmu)
+          break;
+        k++;
+
+      }
+
+      p[i*n_draws + j] = k;
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -142,6 +142,98 @@ cs_random_save(cs_real_t  save_block[1634]);
 void
 cs_random_restore(cs_real_t  save_block[1634]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Uniform distribution counter-based random number generator.
+ *
+ * Values are obtained from the Philox4x32-10 counter-based generator,
+ * keyed by the seed, an id (usually a particle's global number), the time
+ * step number, and a draw index, so that they do not depend on the
+ * processing order, thread, or rank. This generator has no state, so
+ * it may be called concurrently, and needs nothing saved for restarts.
+ *
+ * For id ids[i] (or i if ids is NULL), the value of draw index
+ * draw_id + j is returned in a[i*n_draws + j].
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws for each id
+ * \param[out]  a          pseudo-random numbers following uniform
+ *                         distribution in (0, 1) (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_cb_uniform(unsigned         seed,
+                     int              time_step,
+                     cs_lnum_t        n_ids,
+                     const cs_gnum_t  ids[],
+                     int              draw_id,
+                     int              n_draws,
+                     cs_real_t        a[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Normal distribution counter-based random number generator.
+ *
+ * Box-Muller method applied to the counter-based generator
+ * (see \ref cs_random_cb_uniform).
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws for each id
+ * \param[out]  x          pseudo-random numbers following normal
+ *                         distribution (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_cb_normal(unsigned         seed,
+                    int              time_step,
+                    cs_lnum_t        n_ids,
+                    const cs_gnum_t  ids[],
+                    int              draw_id,
+                    int              n_draws,
+                    cs_real_t        x[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Poisson distribution counter-based random number generator.
+ *
+ * q(mu,p) = exp(-mu) mu**p/p!
+ *
+ * Uniform values are multiplied until their product drops below
+ * exp(-mu), using the counter-based generator
+ * (see \ref cs_random_cb_uniform).
+ *
+ * \param[in]   seed       seed
+ * \param[in]   time_step  time step number
+ * \param[in]   n_ids      number of ids
+ * \param[in]   ids        ids (global numbers), or NULL for 0 to n_ids-1
+ * \param[in]   draw_id    index of first draw for each id
+ * \param[in]   n_draws    number of draws for each id
+ * \param[in]   mu         Poisson distribution parameter
+ * \param[out]  p          pseudo-random numbers following Poisson
+ *                         distribution (size: n_ids*n_draws)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_cb_poisson(unsigned         seed,
+                     int              time_step,
+                     cs_lnum_t        n_ids,
+                     const cs_gnum_t  ids[],
+                     int              draw_id,
+                     int              n_draws,
+                     cs_real_t        mu,
+                     int              p[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -559,6 +559,40 @@ cs_timer_stats_id_by_name(const char  *name)
   return cs_map_name_to_id_try(_name_map, name);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the total time counted by a given statistic.
+ *
+ * Time counted since the statistic was created is returned, including
+ * the current (not yet stopped) time interval if the timer is active.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  associated time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_timer_counter_t
+cs_timer_stats_get_total(int  id)
+{
+  cs_timer_counter_t retval;
+
+  CS_TIMER_COUNTER_INIT(retval);
+
+  if (id < 0 || id >= _n_stats) return retval;
+
+  cs_timer_stats_t  *s = _stats + id;
+
+  CS_TIMER_COUNTER_ADD(retval, s->t_tot, s->t_cur);
+
+  if (s->active) {
+    cs_timer_t t_cur = cs_timer_time();
+    cs_timer_counter_add_diff(&retval, &(s->t_start), &t_cur);
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Enable or disable plotting for a timer statistic.
@@ -146,6 +146,22 @@ cs_timer_stats_create(const char  *parent_name,
 int
 cs_timer_stats_id_by_name(const char  *name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the total time counted by a given statistic.
+ *
+ * Time counted since the statistic was created is returned, including
+ * the current (not yet stopped) time interval if the timer is active.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  associated time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_timer_counter_t
+cs_timer_stats_get_total(int  id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Enable or disable plotting for a timer statistic.
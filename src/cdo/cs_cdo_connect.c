@@ -742,6 +742,168 @@ _get_cell_type(cs_lnum_t                 c_id,
   return ret_type;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Color cells so that two cells sharing a vertex have a different
+ *         color (greedy algorithm following the cell numbering).
+ *         Only one color is used if there is a single thread.
+ *
+ * \param[in]       connect     pointer to a cs_cdo_connect_t struct.
+ * \param[in, out]  cell_color  color of each cell
+ *
+ * \return the number of colors
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_color_cells(const cs_cdo_connect_t   *connect,
+             int                       cell_color[])
+{
+  const cs_lnum_t  n_cells = connect->n_cells;
+  const cs_adjacency_t  *c2v = connect->c2v;
+
+  if (cs_glob_n_threads < 2) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      cell_color[c_id] = 0;
+    return 1;
+  }
+
+  cs_adjacency_t  *v2c = cs_adjacency_transpose(connect->n_vertices, c2v);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    cell_color[c_id] = -1;
+
+  /* color_tag[k] = c_id if the color k is already used by a neighbor of
+     the cell c_id */
+  int  n_colors = 0, n_max_colors = 32;
+  cs_lnum_t  *color_tag = NULL;
+  BFT_MALLOC(color_tag, n_max_colors, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    for (cs_lnum_t j = c2v->idx[c_id]; j < c2v->idx[c_id+1]; j++) {
+
+      const cs_lnum_t  v_id = c2v->ids[j];
+      for (cs_lnum_t k = v2c->idx[v_id]; k < v2c->idx[v_id+1]; k++) {
+        const int  color = cell_color[v2c->ids[k]];
+        if (color > -1)
+          color_tag[color] = c_id;
+      }
+
+    }
+
+    int  color = 0;
+    while (color < n_colors && color_tag[color] == c_id)
+      color++;
+
+    if (color == n_colors) { /* Add a new color */
+      if (n_colors == n_max_colors) {
+        n_max_colors *= 2;
+        BFT_REALLOC(color_tag, n_max_colors, cs_lnum_t);
+      }
+      color_tag[n_colors] = -1;
+      n_colors++;
+    }
+
+    cell_color[c_id] = color;
+
+  } /* Loop on cells */
+
+  BFT_FREE(color_tag);
+  cs_adjacency_destroy(&v2c);
+
+  return n_colors;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Gather cells sharing the same color and the same type of element
+ *         by batches of at most CS_CDO_CELL_BATCH_SIZE cells. Polyhedra are
+ *         not gathered. The initial ordering of cells is kept inside each
+ *         group of cells with the same color and type of element.
+ *
+ * \param[in, out]  connect   pointer to a cs_cdo_connect_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_cell_batches(cs_cdo_connect_t   *connect)
+{
+  const cs_lnum_t  n_cells = connect->n_cells;
+
+  int  *cell_color = NULL;
+  BFT_MALLOC(cell_color, n_cells, int);
+
+  const int  n_colors = _color_cells(connect, cell_color);
+  const int  n_groups = n_colors * FVM_N_ELEMENT_TYPES;
+
+  /* A group gathers cells with the same color and the same type */
+  cs_lnum_t  *group_shift = NULL;
+  BFT_MALLOC(group_shift, n_groups + 1, cs_lnum_t);
+  for (int i = 0; i < n_groups + 1; i++)
+    group_shift[i] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const int  g = cell_color[c_id]*FVM_N_ELEMENT_TYPES
+      + connect->cell_type[c_id];
+    group_shift[g + 1] += 1;
+  }
+
+  /* Number of batches */
+  cs_lnum_t  n_batches = 0;
+  for (int g = 0; g < n_groups; g++) {
+    const cs_lnum_t  n_group_cells = group_shift[g+1];
+    if (g % FVM_N_ELEMENT_TYPES == FVM_CELL_POLY)
+      n_batches += n_group_cells;
+    else
+      n_batches += (n_group_cells + CS_CDO_CELL_BATCH_SIZE - 1)
+        / CS_CDO_CELL_BATCH_SIZE;
+  }
+
+  for (int g = 0; g < n_groups; g++)
+    group_shift[g+1] += group_shift[g];
+
+  /* Cell ids ordered by color then by type of element */
+  BFT_MALLOC(connect->cell_batch_ids, n_cells, cs_lnum_t);
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const int  g = cell_color[c_id]*FVM_N_ELEMENT_TYPES
+      + connect->cell_type[c_id];
+    connect->cell_batch_ids[group_shift[g]] = c_id;
+    group_shift[g] += 1;
+  }
+
+  /* Index of the batches (group_shift is now shifted of one group) */
+  BFT_MALLOC(connect->cell_batch_idx, n_batches + 1, cs_lnum_t);
+  BFT_MALLOC(connect->color_batch_idx, n_colors + 1, cs_lnum_t);
+  connect->cell_batch_idx[0] = 0;
+
+  cs_lnum_t  b_id = 0, s_id = 0;
+  for (int g = 0; g < n_groups; g++) {
+
+    if (g % FVM_N_ELEMENT_TYPES == 0)
+      connect->color_batch_idx[g / FVM_N_ELEMENT_TYPES] = b_id;
+
+    const cs_lnum_t  e_id = group_shift[g];
+    const cs_lnum_t  b_size = (g % FVM_N_ELEMENT_TYPES == FVM_CELL_POLY) ?
+      1 : CS_CDO_CELL_BATCH_SIZE;
+
+    for (cs_lnum_t j = s_id; j < e_id; j += b_size) {
+      connect->cell_batch_idx[b_id + 1] = CS_MIN(j + b_size, e_id);
+      b_id++;
+    }
+    s_id = e_id;
+
+  }
+
+  assert(b_id == n_batches);
+  connect->n_cell_batches = n_batches;
+  connect->n_cell_colors = n_colors;
+  connect->color_batch_idx[n_colors] = n_batches;
+
+  BFT_FREE(group_shift);
+  BFT_FREE(cell_color);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Allocate and define a \ref cs_range_set_t structure and a
@@ -1001,6 +1163,9 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
   for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++)
     connect->cell_flag[c_ids[f_id]] = CS_FLAG_BOUNDARY;
 
+  /* Gather cells of the same type by batches */
+  _build_cell_batches(connect);
+
   /* Max number of entities (vertices, edges and faces) by cell */
   _compute_max_ent(mesh, connect);
 
@@ -1112,6 +1277,9 @@ cs_cdo_connect_free(cs_cdo_connect_t   *connect)
 
   BFT_FREE(connect->cell_type);
   BFT_FREE(connect->cell_flag);
+  BFT_FREE(connect->cell_batch_idx);
+  BFT_FREE(connect->cell_batch_ids);
+  BFT_FREE(connect->color_batch_idx);
 
   /* Structures for parallelism */
   cs_range_set_destroy(connect->range_sets + CS_CDO_CONNECT_VTX_VECT);
@@ -1144,14 +1312,15 @@ cs_cdo_connect_free(cs_cdo_connect_t   *connect)
 void
 cs_cdo_connect_summary(const cs_cdo_connect_t  *connect)
 {
-  cs_lnum_t  n_max_entbyc[5] = {connect->n_max_fbyc,
+  cs_lnum_t  n_max_entbyc[6] = {connect->n_max_fbyc,
                                 connect->n_max_ebyc,
                                 connect->n_max_vbyc,
                                 connect->v_max_cell_range,
-                                connect->e_max_cell_range};
+                                connect->e_max_cell_range,
+                                connect->n_cell_colors};
 
   if (cs_glob_n_ranks > 1)
-    cs_parall_max(5, CS_LNUM_TYPE, n_max_entbyc);
+    cs_parall_max(6, CS_LNUM_TYPE, n_max_entbyc);
 
   /* Output */
   cs_log_printf(CS_LOG_DEFAULT, "\n Connectivity information:\n");
@@ -1168,8 +1337,11 @@ cs_cdo_connect_summary(const cs_cdo_connect_t  *connect)
                 " --dim-- max. vertex range for a cell:      %d\n",
                 n_max_entbyc[3]);
   cs_log_printf(CS_LOG_DEFAULT,
-                " --dim-- max. edge range for a cell:        %d\n\n",
+                " --dim-- max. edge range for a cell:        %d\n",
                 n_max_entbyc[4]);
+  cs_log_printf(CS_LOG_DEFAULT,
+                " --dim-- max. number of cell colors:        %d\n\n",
+                n_max_entbyc[5]);
 
   /* Information about the element types */
   cs_gnum_t  n_type_cells[FVM_N_ELEMENT_TYPES];
@@ -66,6 +66,10 @@ BEGIN_C_DECLS
 /* Additional macros */
 #define CS_TRIANGLE_CASE          3 /* Number of vertices in a triangle */
 
+/* Max. number of cells gathered in a batch of cells sharing the same type of
+   element (related to the width of SIMD registers) */
+#define CS_CDO_CELL_BATCH_SIZE    8
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -94,6 +98,19 @@ typedef struct {
   cs_adjacency_t    *c2e;         /* cell --> edges connectivity */
   cs_adjacency_t    *c2v;         /* cell --> vertices connectivity */
 
+  /* Cells of the same type gathered by batches of at most
+     CS_CDO_CELL_BATCH_SIZE cells (a polyhedron is alone in its batch) */
+  cs_lnum_t          n_cell_batches;
+  cs_lnum_t         *cell_batch_idx;  /* size = n_cell_batches + 1 */
+  cs_lnum_t         *cell_batch_ids;  /* size = n_cells */
+
+  /* Batches are gathered by colors. Two cells of the same color share no
+     vertex (hence no edge and no face) so that the cellwise contributions
+     of a color can be assembled by several threads without conflict.
+     There is only one color if a single thread is used. */
+  int                n_cell_colors;
+  cs_lnum_t         *color_batch_idx; /* size = n_cell_colors + 1 */
+
   /* Delta of ids between the min./max. values of entities related to a cell
      Useful to store compactly the link between mesh ids and cell mesh ids
      needed during the cell mesh definition */
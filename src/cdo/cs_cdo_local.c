@@ -35,6 +35,11 @@
 #include <assert.h>
 #include <float.h>
 #include <limits.h>
+#include <string.h>
+
+#if defined(__linux__) && defined(HAVE_SYS_SYSINFO_H) && defined(HAVE_SYSINFO)
+#include <sys/sysinfo.h>
+#endif
 
 /*----------------------------------------------------------------------------
  *  Local headers
@@ -45,6 +50,7 @@
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_param.h"
+#include "cs_param_cdo.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -71,6 +77,19 @@ BEGIN_C_DECLS
 
 #define CS_CDO_LOCAL_DBG       0
 
+/* Persistent store of the cellwise view of the mesh. Each cell record is
+   a packed copy of the members of a cs_cell_mesh_t structure built with
+   the stored flag. Records are cell-contiguous in a single arena. */
+
+typedef struct {
+
+  cs_flag_t        flag;     /* quantities available in the store */
+  cs_lnum_t        n_cells;
+  size_t          *idx;      /* start of each cell record (size n_cells+1) */
+  unsigned char   *arena;    /* packed cell records */
+
+} cs_cell_mesh_store_t;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -109,12 +128,266 @@ static const cs_flag_t  cs_cdo_local_flag_ef =
 static double     **cs_cdo_local_dbuf = NULL;
 static short int  **cs_cdo_local_kbuf = NULL;
 
+/* Batches of cells sharing the same type of element (one by thread) */
+static cs_cell_batch_t  **cs_cdo_local_cell_batches = NULL;
+
+/* Persistent store of cell meshes and memory budget for it */
+static cs_cell_mesh_store_t  *cs_cdo_local_cm_store = NULL;
+static bool    cs_cdo_local_cm_store_auto = true;
+static size_t  cs_cdo_local_cm_store_max_size = 0;
+
+/* Quantities kept when the whole set of requested quantities does not fit
+   in the memory budget: geometry and cellwise numbering, but no local
+   connectivity */
+static const cs_flag_t  cs_cdo_local_flag_geom =
+  CS_CDO_LOCAL_PV | CS_CDO_LOCAL_PVQ | CS_CDO_LOCAL_PE | CS_CDO_LOCAL_PEQ |
+  CS_CDO_LOCAL_DFQ | CS_CDO_LOCAL_PF | CS_CDO_LOCAL_PFQ | CS_CDO_LOCAL_DEQ |
+  CS_CDO_LOCAL_HFQ;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy a member of a cs_cell_mesh_t structure into a cell record or
+ *         the reverse. Only the size is updated if buf is NULL.
+ *
+ * \param[in]       to_store  true: cm --> buf; false: buf --> cm
+ * \param[in, out]  buf       cell record (or NULL)
+ * \param[in, out]  pos       current position in the cell record
+ * \param[in, out]  member    pointer to the member of the cs_cell_mesh_t
+ * \param[in]       size      size in bytes of the member
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_cm_member_transfer(bool              to_store,
+                    unsigned char    *buf,
+                    size_t           *pos,
+                    void             *member,
+                    size_t            size)
+{
+  if (buf != NULL) {
+    if (to_store)
+      memcpy(buf + *pos, member, size);
+    else
+      memcpy(member, buf + *pos, size);
+  }
+  *pos += size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Pack or unpack the members of a cs_cell_mesh_t structure defined
+ *         by a given flag. The members related to the cell itself and the
+ *         number of vertices, edges and faces are not considered and should
+ *         be already set.
+ *
+ * \param[in]       flag      quantities to transfer
+ * \param[in]       to_store  true: cm --> buf; false: buf --> cm
+ * \param[in, out]  buf       cell record (or NULL to only get its size)
+ * \param[in, out]  cm        pointer to a cs_cell_mesh_t structure
+ *
+ * \return the size in bytes of the cell record
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_cm_transfer(cs_flag_t          flag,
+             bool               to_store,
+             unsigned char     *buf,
+             cs_cell_mesh_t    *cm)
+{
+  size_t  pos = 0;
+
+  const size_t  n_vc = cm->n_vc, n_ec = cm->n_ec, n_fc = cm->n_fc;
+
+  if (flag & cs_cdo_local_flag_v) {
+    _cm_member_transfer(to_store, buf, &pos, cm->v_ids,
+                        n_vc*sizeof(cs_lnum_t));
+    _cm_member_transfer(to_store, buf, &pos, cm->xv, 3*n_vc*sizeof(double));
+    if (flag & CS_CDO_LOCAL_PVQ)
+      _cm_member_transfer(to_store, buf, &pos, cm->wvc, n_vc*sizeof(double));
+  }
+
+  if (flag & cs_cdo_local_flag_e) {
+    _cm_member_transfer(to_store, buf, &pos, cm->e_ids,
+                        n_ec*sizeof(cs_lnum_t));
+    if (flag & cs_cdo_local_flag_peq)
+      _cm_member_transfer(to_store, buf, &pos, cm->edge,
+                          n_ec*sizeof(cs_quant_t));
+    if (flag & CS_CDO_LOCAL_DFQ)
+      _cm_member_transfer(to_store, buf, &pos, cm->dface,
+                          n_ec*sizeof(cs_nvec3_t));
+  }
+
+  if (flag & CS_CDO_LOCAL_EV) {
+    _cm_member_transfer(to_store, buf, &pos, cm->e2v_sgn,
+                        n_ec*sizeof(short int));
+    _cm_member_transfer(to_store, buf, &pos, cm->e2v_ids,
+                        2*n_ec*sizeof(short int));
+  }
+
+  if (flag & cs_cdo_local_flag_f) {
+    _cm_member_transfer(to_store, buf, &pos, cm->f_ids,
+                        n_fc*sizeof(cs_lnum_t));
+    _cm_member_transfer(to_store, buf, &pos, cm->f_sgn,
+                        n_fc*sizeof(short int));
+    if (flag & cs_cdo_local_flag_pfq)
+      _cm_member_transfer(to_store, buf, &pos, cm->face,
+                          n_fc*sizeof(cs_quant_t));
+    if (flag & cs_cdo_local_flag_deq)
+      _cm_member_transfer(to_store, buf, &pos, cm->dedge,
+                          n_fc*sizeof(cs_nvec3_t));
+    if (flag & CS_CDO_LOCAL_HFQ)
+      _cm_member_transfer(to_store, buf, &pos, cm->hfc, n_fc*sizeof(double));
+  }
+
+  if (flag & cs_cdo_local_flag_fe) {
+    _cm_member_transfer(to_store, buf, &pos, cm->f2e_idx,
+                        (n_fc + 1)*sizeof(short int));
+    _cm_member_transfer(to_store, buf, &pos, cm->f2e_ids,
+                        2*n_ec*sizeof(short int));
+    if (flag & CS_CDO_LOCAL_FEQ)
+      _cm_member_transfer(to_store, buf, &pos, cm->tef,
+                          2*n_ec*sizeof(double));
+  }
+
+  if (flag & cs_cdo_local_flag_ef) {
+    _cm_member_transfer(to_store, buf, &pos, cm->e2f_ids,
+                        2*n_ec*sizeof(short int));
+    if (flag & CS_CDO_LOCAL_EFQ)
+      _cm_member_transfer(to_store, buf, &pos, cm->sefc,
+                          2*n_ec*sizeof(cs_nvec3_t));
+  }
+
+  if (flag & CS_CDO_LOCAL_DIAM) {
+    _cm_member_transfer(to_store, buf, &pos, &(cm->diam_c), sizeof(double));
+    _cm_member_transfer(to_store, buf, &pos, cm->f_diam,
+                        n_fc*sizeof(double));
+  }
+
+  return pos;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the size of the store of cell meshes for a given flag
+ *
+ * \param[in]  flag      quantities to store
+ * \param[in]  connect   pointer to a cs_cdo_connect_t structure
+ * \param[in]  cm        pointer to a cs_cell_mesh_t structure (buffer)
+ *
+ * \return the size in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_cm_store_size(cs_flag_t                  flag,
+               const cs_cdo_connect_t    *connect,
+               cs_cell_mesh_t            *cm)
+{
+  size_t  size = (connect->n_cells + 1)*sizeof(size_t);
+
+  for (cs_lnum_t c_id = 0; c_id < connect->n_cells; c_id++) {
+    cm->n_vc = connect->c2v->idx[c_id+1] - connect->c2v->idx[c_id];
+    cm->n_ec = connect->c2e->idx[c_id+1] - connect->c2e->idx[c_id];
+    cm->n_fc = connect->c2f->idx[c_id+1] - connect->c2f->idx[c_id];
+    size += _cm_transfer(flag, true, NULL, cm);
+  }
+
+  return size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the store of cell meshes
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cm_store_free(void)
+{
+  cs_cell_mesh_store_t  *store = cs_cdo_local_cm_store;
+
+  if (store == NULL)
+    return;
+
+  BFT_FREE(store->idx);
+  BFT_FREE(store->arena);
+  BFT_FREE(store);
+
+  cs_cdo_local_cm_store = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the number of ranks sharing the memory of the local node.
+ *         If this can not be determined, all ranks are assumed to share it.
+ *
+ * \return the number of ranks on the local node
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_n_node_ranks(void)
+{
+  int  n_node_ranks = 1;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+    MPI_Comm  node_comm;
+    MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &node_comm);
+    MPI_Comm_size(node_comm, &n_node_ranks);
+    MPI_Comm_free(&node_comm);
+#else
+    n_node_ranks = cs_glob_n_ranks;
+#endif
+
+  }
+#endif
+
+  return n_node_ranks;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the memory budget for the store of cell meshes
+ *
+ * \return the max. size in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_cm_store_budget(void)
+{
+  if (!cs_cdo_local_cm_store_auto)
+    return cs_cdo_local_cm_store_max_size;
+
+  /* Default: a quarter of the free memory of the node shared among the
+     ranks of this node is an upper bound. No store if this information is
+     not available. */
+  size_t  budget = 0;
+
+#if defined(__linux__) && defined(HAVE_SYS_SYSINFO_H) && defined(HAVE_SYSINFO)
+  {
+    struct sysinfo info;
+    if (sysinfo(&info) == 0)
+      budget = (size_t)info.freeram * (size_t)info.mem_unit / 4;
+  }
+#endif
+
+  budget /= (size_t)_n_node_ranks();
+
+  return budget;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -145,6 +418,7 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect)
   BFT_MALLOC(cs_cdo_local_face_meshes_light, size, cs_face_mesh_light_t *);
   BFT_MALLOC(cs_cdo_local_dbuf, size, double *);
   BFT_MALLOC(cs_cdo_local_kbuf, size, short int *);
+  BFT_MALLOC(cs_cdo_local_cell_batches, size, cs_cell_batch_t *);
 
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
 #pragma omp parallel
@@ -156,6 +430,7 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect)
     cs_cdo_local_face_meshes[t_id] = cs_face_mesh_create(connect->n_max_vbyf);
     cs_cdo_local_face_meshes_light[t_id] =
       cs_face_mesh_light_create(connect->n_max_vbyf, connect->n_max_vbyc);
+    cs_cdo_local_cell_batches[t_id] = cs_cell_batch_create(connect);
 
     BFT_MALLOC(cs_cdo_local_dbuf[t_id], n_vc*(n_vc+1)/2, double);
     BFT_MALLOC(cs_cdo_local_kbuf[t_id], CS_MAX(connect->v_max_cell_range,
@@ -170,6 +445,7 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect)
   cs_cdo_local_face_meshes[0] = cs_face_mesh_create(connect->n_max_vbyf);
   cs_cdo_local_face_meshes_light[0] =
     cs_face_mesh_light_create(connect->n_max_vbyf, connect->n_max_vbyc);
+  cs_cdo_local_cell_batches[0] = cs_cell_batch_create(connect);
 
   BFT_MALLOC(cs_cdo_local_dbuf[0], n_vc*(n_vc+1)/2, double);
   BFT_MALLOC(cs_cdo_local_kbuf[0], CS_MAX(connect->v_max_cell_range,
@@ -203,6 +479,7 @@ cs_cdo_local_finalize(void)
     cs_cell_mesh_free(&(cs_cdo_local_cell_meshes[t_id]));
     cs_face_mesh_free(&(cs_cdo_local_face_meshes[t_id]));
     cs_face_mesh_light_free(&(cs_cdo_local_face_meshes_light[t_id]));
+    cs_cell_batch_free(&(cs_cdo_local_cell_batches[t_id]));
     BFT_FREE(cs_cdo_local_dbuf[t_id]);
     BFT_FREE(cs_cdo_local_kbuf[t_id]);
 
@@ -212,15 +489,19 @@ cs_cdo_local_finalize(void)
   cs_cell_mesh_free(&(cs_cdo_local_cell_meshes[0]));
   cs_face_mesh_free(&(cs_cdo_local_face_meshes[0]));
   cs_face_mesh_light_free(&(cs_cdo_local_face_meshes_light[0]));
+  cs_cell_batch_free(&(cs_cdo_local_cell_batches[0]));
   BFT_FREE(cs_cdo_local_dbuf[0]);
   BFT_FREE(cs_cdo_local_kbuf[0]);
 #endif /* openMP */
 
+  _cm_store_free();
+
   BFT_FREE(cs_cdo_local_cell_meshes);
   BFT_FREE(cs_cdo_local_face_meshes);
   BFT_FREE(cs_cdo_local_face_meshes_light);
   BFT_FREE(cs_cdo_local_dbuf);
   BFT_FREE(cs_cdo_local_kbuf);
+  BFT_FREE(cs_cdo_local_cell_batches);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -577,6 +858,123 @@ cs_cdo_local_get_cell_mesh(int    mesh_id)
   return cs_cdo_local_cell_meshes[mesh_id];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a cs_cell_batch_t structure
+ *
+ * \param[in]  connect        pointer to a cs_cdo_connect_t structure
+ *
+ * \return a pointer to a new allocated cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cell_batch_t *
+cs_cell_batch_create(const cs_cdo_connect_t   *connect)
+{
+  cs_cell_batch_t  *cbatch = NULL;
+
+  BFT_MALLOC(cbatch, 1, cs_cell_batch_t);
+
+  cbatch->n_cells = 0;
+  cbatch->type = FVM_CELL_POLY;
+
+  for (int l = 0; l < CS_CDO_CELL_BATCH_SIZE; l++) {
+    cbatch->cm[l] = cs_cell_mesh_create(connect);
+    cbatch->pty_val[l] = 1.0;
+    cbatch->loc[l] = cs_sdm_square_create(connect->n_max_vbyc);
+  }
+
+  return cbatch;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_cell_batch_t structure
+ *
+ * \param[in, out]  p_cbatch   pointer of pointer to a cs_cell_batch_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_batch_free(cs_cell_batch_t     **p_cbatch)
+{
+  cs_cell_batch_t  *cbatch = *p_cbatch;
+
+  if (cbatch == NULL)
+    return;
+
+  for (int l = 0; l < CS_CDO_CELL_BATCH_SIZE; l++) {
+    cs_cell_mesh_free(&(cbatch->cm[l]));
+    cbatch->loc[l] = cs_sdm_free(cbatch->loc[l]);
+  }
+
+  BFT_FREE(cbatch);
+  *p_cbatch = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get a pointer to a cs_cell_batch_t structure corresponding to
+ *         thread id
+ *
+ * \param[in]   t_id   id in the array of pointer to cs_cell_batch_t struct.
+ *
+ * \return a pointer to a cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cell_batch_t *
+cs_cdo_local_get_cell_batch(int    t_id)
+{
+  if (t_id < 0 || t_id >= cs_glob_n_threads)
+    return NULL;
+
+  return cs_cdo_local_cell_batches[t_id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the cellwise views of the mesh for the cells of the batch
+ *         b_id. Cells of a batch share the same type of element.
+ *
+ * \param[in]       b_id       id of the batch of cells
+ * \param[in]       flag       flag related to the quantities to build
+ * \param[in]       bd_flag    additional flag for boundary cells
+ * \param[in]       connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]       quant      pointer to a cs_cdo_quantities_t structure
+ * \param[in, out]  cbatch     pointer to a cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_batch_build(cs_lnum_t                    b_id,
+                    cs_flag_t                    flag,
+                    cs_flag_t                    bd_flag,
+                    const cs_cdo_connect_t      *connect,
+                    const cs_cdo_quantities_t   *quant,
+                    cs_cell_batch_t             *cbatch)
+{
+  const cs_lnum_t  s_id = connect->cell_batch_idx[b_id];
+  const cs_lnum_t  e_id = connect->cell_batch_idx[b_id+1];
+
+  assert(e_id - s_id <= CS_CDO_CELL_BATCH_SIZE);
+
+  cbatch->n_cells = e_id - s_id;
+  cbatch->type = connect->cell_type[connect->cell_batch_ids[s_id]];
+
+  for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+    const cs_lnum_t  c_id = connect->cell_batch_ids[i];
+
+    cs_flag_t  msh_flag = flag;
+    if (connect->cell_flag[c_id] & CS_FLAG_BOUNDARY)
+      msh_flag |= bd_flag;
+
+    cs_cell_mesh_build(c_id, msh_flag, connect, quant, cbatch->cm[i - s_id]);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Initialize to invalid values a cs_cell_mesh_t structure
@@ -843,6 +1241,13 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
   if (flag == 0)
     return;
 
+  /* Copy the packed record if the store holds all requested quantities */
+  const cs_cell_mesh_store_t  *store = cs_cdo_local_cm_store;
+  if (store != NULL && (flag & ~store->flag) == 0) {
+    _cm_transfer(store->flag, false, store->arena + store->idx[c_id], cm);
+    return;
+  }
+
   /* Information related to primal vertices */
   if (flag & cs_cdo_local_flag_v) {
 
@@ -1183,6 +1588,130 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
   } /* Compute diameters */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the memory budget of the persistent store of cell meshes.
+ *         By default, this budget is a quarter of the free memory of the
+ *         node divided by the number of ranks (no store if this information
+ *         is not available). A budget equal to 0 disables the store.
+ *
+ * \param[in]  max_size    max. size in bytes of the store on a rank
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_mesh_store_set_max_size(size_t    max_size)
+{
+  cs_cdo_local_cm_store_auto = false;
+  cs_cdo_local_cm_store_max_size = max_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build a persistent store of the cellwise views of the mesh. Once
+ *         defined, \ref cs_cell_mesh_build copies the record of a cell when
+ *         all requested quantities are in the store instead of gathering
+ *         them from the global arrays.
+ *         According to the memory budget, all requested quantities are
+ *         stored, or only the geometrical ones (no local connectivity), or
+ *         nothing (cell meshes are recomputed).
+ *
+ * \param[in]  flag      quantities which are requested
+ * \param[in]  connect   pointer to a cs_cdo_connect_t structure
+ * \param[in]  quant     pointer to a cs_cdo_quantities_t structure
+ *
+ * \return the flag of the quantities actually stored (0 if none)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_flag_t
+cs_cell_mesh_store_define(cs_flag_t                    flag,
+                          const cs_cdo_connect_t      *connect,
+                          const cs_cdo_quantities_t   *quant)
+{
+  _cm_store_free();
+
+  if (flag == 0 || cs_cdo_local_n_structures < 1)
+    return 0;
+
+  /* Choose what to store according to the memory budget */
+  cs_cell_mesh_t  *cm = cs_cdo_local_cell_meshes[0];
+
+  const size_t  budget = _cm_store_budget();
+  const cs_flag_t  geom_flag = flag & cs_cdo_local_flag_geom;
+
+  cs_flag_t  store_flag = 0;
+  size_t  store_size = _cm_store_size(flag, connect, cm);
+
+  if (store_size <= budget)
+    store_flag = flag;
+  else if (geom_flag != 0) {
+    store_size = _cm_store_size(geom_flag, connect, cm);
+    if (store_size <= budget)
+      store_flag = geom_flag;
+  }
+
+  if (store_flag == 0) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  " <CDO/Cell mesh store> recompute (%lu bytes needed)\n",
+                  (unsigned long)store_size);
+    return 0;
+  }
+
+  /* Build the index of cell records */
+  const cs_lnum_t  n_cells = connect->n_cells;
+
+  cs_cell_mesh_store_t  *store = NULL;
+  BFT_MALLOC(store, 1, cs_cell_mesh_store_t);
+
+  store->flag = store_flag;
+  store->n_cells = n_cells;
+  BFT_MALLOC(store->idx, n_cells + 1, size_t);
+
+  store->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cm->n_vc = connect->c2v->idx[c_id+1] - connect->c2v->idx[c_id];
+    cm->n_ec = connect->c2e->idx[c_id+1] - connect->c2e->idx[c_id];
+    cm->n_fc = connect->c2f->idx[c_id+1] - connect->c2f->idx[c_id];
+    store->idx[c_id+1] = store->idx[c_id]
+      + _cm_transfer(store_flag, true, NULL, cm);
+  }
+
+  BFT_MALLOC(store->arena, store->idx[n_cells], unsigned char);
+
+  /* Fill cell records */
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+    int t_id = omp_get_thread_num();
+#else
+    int t_id = 0;
+#endif /* openMP */
+
+    cs_cell_mesh_t  *_cm = cs_cdo_local_cell_meshes[t_id];
+
+#   pragma omp for CS_CDO_OMP_SCHEDULE
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+      cs_cell_mesh_build(c_id, store_flag, connect, quant, _cm);
+      _cm_transfer(store_flag, true, store->arena + store->idx[c_id], _cm);
+
+    }
+  }
+
+  cs_cell_mesh_reset(cm);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                " <CDO/Cell mesh store> %s; %lu bytes\n",
+                (store_flag == flag) ? "full" : "geometry only",
+                (unsigned long)(store->idx[n_cells]));
+
+  /* Activate the store */
+  cs_cdo_local_cm_store = store;
+
+  return store_flag;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate a cs_face_mesh_t structure
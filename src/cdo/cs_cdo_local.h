@@ -188,6 +188,21 @@ typedef struct {
 
 } cs_cell_mesh_t;
 
+/* Structure used to build simultaneously local operators for a batch of
+   cells sharing the same type of element. Structure which belongs to one
+   thread. */
+
+typedef struct {
+
+  int              n_cells;  // number of cells in the current batch
+  fvm_element_t    type;     // type of element shared by cells of the batch
+
+  cs_cell_mesh_t  *cm[CS_CDO_CELL_BATCH_SIZE];      // cellwise views
+  double           pty_val[CS_CDO_CELL_BATCH_SIZE]; // isotropic property
+  cs_sdm_t        *loc[CS_CDO_CELL_BATCH_SIZE];     // local square matrices
+
+} cs_cell_batch_t;
+
 /* Structure used to get a better memory locality. Map existing structure
    into a more compact one dedicated to a face.
    Arrays are allocated to n_max_vbyf (= n_max_ebyf).
@@ -395,6 +410,66 @@ cs_cell_mesh_create(const cs_cdo_connect_t   *connect);
 cs_cell_mesh_t *
 cs_cdo_local_get_cell_mesh(int    mesh_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a cs_cell_batch_t structure
+ *
+ * \param[in]  connect        pointer to a cs_cdo_connect_t structure
+ *
+ * \return a pointer to a new allocated cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cell_batch_t *
+cs_cell_batch_create(const cs_cdo_connect_t   *connect);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_cell_batch_t structure
+ *
+ * \param[in, out]  p_cbatch   pointer of pointer to a cs_cell_batch_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_batch_free(cs_cell_batch_t     **p_cbatch);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get a pointer to a cs_cell_batch_t structure corresponding to
+ *         thread id
+ *
+ * \param[in]   t_id   id in the array of pointer to cs_cell_batch_t struct.
+ *
+ * \return a pointer to a cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cell_batch_t *
+cs_cdo_local_get_cell_batch(int    t_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the cellwise views of the mesh for the cells of the batch
+ *         b_id. Cells of a batch share the same type of element.
+ *
+ * \param[in]       b_id       id of the batch of cells
+ * \param[in]       flag       flag related to the quantities to build
+ * \param[in]       bd_flag    additional flag for boundary cells
+ * \param[in]       connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]       quant      pointer to a cs_cdo_quantities_t structure
+ * \param[in, out]  cbatch     pointer to a cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_batch_build(cs_lnum_t                    b_id,
+                    cs_flag_t                    flag,
+                    cs_flag_t                    bd_flag,
+                    const cs_cdo_connect_t      *connect,
+                    const cs_cdo_quantities_t   *quant,
+                    cs_cell_batch_t             *cbatch);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Initialize to invalid values a cs_cell_mesh_t structure
@@ -448,6 +523,43 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
                    const cs_cdo_quantities_t   *quant,
                    cs_cell_mesh_t              *cm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the memory budget of the persistent store of cell meshes.
+ *         By default, this budget is a quarter of the free memory of the
+ *         node divided by the number of ranks (no store if this information
+ *         is not available). A budget equal to 0 disables the store.
+ *
+ * \param[in]  max_size    max. size in bytes of the store on a rank
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_mesh_store_set_max_size(size_t    max_size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build a persistent store of the cellwise views of the mesh. Once
+ *         defined, \ref cs_cell_mesh_build copies the record of a cell when
+ *         all requested quantities are in the store instead of gathering
+ *         them from the global arrays.
+ *         According to the memory budget, all requested quantities are
+ *         stored, or only the geometrical ones (no local connectivity), or
+ *         nothing (cell meshes are recomputed).
+ *
+ * \param[in]  flag      quantities which are requested
+ * \param[in]  connect   pointer to a cs_cdo_connect_t structure
+ * \param[in]  quant     pointer to a cs_cdo_quantities_t structure
+ *
+ * \return the flag of the quantities actually stored (0 if none)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_flag_t
+cs_cell_mesh_store_define(cs_flag_t                    flag,
+                          const cs_cdo_connect_t      *connect,
+                          const cs_cdo_quantities_t   *quant);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Retrieve the list of vertices attached to a face
@@ -44,6 +44,7 @@
 
 #include <bft_mem.h>
 
+#include "cs_blas.h"
 #include "cs_cdo_bc.h"
 #include "cs_cdofb_priv.h"
 #include "cs_cdofb_scaleq.h"
@@ -55,7 +56,10 @@
 #include "cs_math.h"
 #include "cs_navsto_coupling.h"
 #include "cs_navsto_param.h"
+#include "cs_parall.h"
 #include "cs_post.h"
+#include "cs_range_set.h"
+#include "cs_sles.h"
 #include "cs_source_term.h"
 #include "cs_static_condensation.h"
 #include "cs_timer.h"
@@ -91,6 +95,10 @@ BEGIN_C_DECLS
 #define CS_CDOFB_NAVSTO_DBG      0
 #define CS_CDOFB_NAVSTO_MODULO  10
 
+/* Size of the Krylov space before a restart of the FGMRES algorithm used
+   with a monolithic coupling */
+#define CS_CDOFB_NAVSTO_RESTART 30
+
 /*! \struct cs_cdofb_navsto_t
  *  \brief Context related to CDO face-based discretization when dealing with
  *         vector-valued unknowns
@@ -168,6 +176,37 @@ typedef struct {
 
 } cs_cdofb_navsto_t;
 
+/* Saddle-point system [A B^T; B 0] arising from a monolithic coupling.
+   A is the velocity block built by the momentum equation and B = -div is
+   the discrete divergence weighted by the cell volume. Vectors are stored
+   with the velocity DoFs (gathered numbering of the momentum equation)
+   first and then the cell pressure DoFs. */
+
+typedef struct {
+
+  cs_lnum_t               n_u;        /* number of gathered velocity DoFs */
+  cs_lnum_t               n_u_all;    /* number of local velocity DoFs */
+  cs_lnum_t               n_p;        /* number of pressure DoFs */
+
+  const cs_range_set_t   *rset;       /* range set of the momentum equation */
+  const cs_matrix_t      *a;          /* velocity block */
+  cs_sles_t              *sles_u;     /* inexact solver for the velocity
+                                         block (setup of the momentum eq.) */
+  double                  eps_u;      /* tolerance for the velocity block */
+
+  bool                   *skip_grad;  /* faces on which the velocity is
+                                         prescribed (NULL if none) */
+  bool                    p_is_free;  /* pressure defined up to a constant */
+  cs_real_t              *s_inv;      /* inverse of the approximation of the
+                                         Schur complement (diagonal) */
+
+  cs_real_t              *u_work;     /* size = max(n_u_all, n_cols_ext) */
+  cs_real_t              *v_work;     /* size = max(n_u_all, n_cols_ext) */
+  cs_real_t              *y_work;     /* size = max(n_u_all, n_cols_ext) */
+  cs_real_t              *g_work;     /* size = n_u */
+
+} _saddle_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -220,6 +259,502 @@ _create_navsto_context(const cs_navsto_param_t  *nsp)
   return nssc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the face normal weighted by the face surface for a primal
+ *         face (interior or border)
+ *
+ * \param[in]  f_id     id related to the face (f_id > n_i_face -> border face)
+ * \param[in]  cdoq     pointer to a cs_cdo_quantities_t structure
+ *
+ * \return a pointer to the face vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline const cs_real_t *
+_face_vector(cs_lnum_t                    f_id,
+             const cs_cdo_quantities_t   *cdoq)
+{
+  const cs_lnum_t  bf_id = f_id - cdoq->n_i_faces;
+  if (bf_id > -1)  // Border face
+    return cdoq->b_face_normal + 3*bf_id;
+  else             // Interior face
+    return cdoq->i_face_normal + 3*f_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute div = B.u where B is the (opposite of the) discrete
+ *         divergence operator weighted by the cell volume
+ *
+ * \param[in, out] sp     pointer to a _saddle_t structure
+ * \param[in]      u      velocity DoFs (gathered view)
+ * \param[in, out] div    result (size = n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_div(_saddle_t          *sp,
+            const cs_real_t    *u,
+            cs_real_t          *div)
+{
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_adjacency_t  *c2f = cs_shared_connect->c2f;
+  const cs_real_t  *u_all = u;
+
+  if (cs_glob_n_ranks > 1) {
+    cs_range_set_scatter(sp->rset, CS_REAL_TYPE, 1, u, sp->u_work);
+    u_all = sp->u_work;
+  }
+
+# pragma omp parallel for if (quant->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+    cs_real_t  flux = 0.;
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+      const cs_lnum_t  f_id = c2f->ids[j];
+      flux += c2f->sgn[j] * cs_math_3_dot_product(_face_vector(f_id, quant),
+                                                 u_all + 3*f_id);
+    }
+    div[c_id] = -flux;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute g = B^T.p where B is the (opposite of the) discrete
+ *         divergence operator weighted by the cell volume. Faces on which the
+ *         velocity is prescribed are skipped.
+ *
+ * \param[in, out] sp     pointer to a _saddle_t structure
+ * \param[in]      p      pressure DoFs (size = n_cells)
+ * \param[in, out] g      result (gathered view)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_grad(_saddle_t          *sp,
+             const cs_real_t    *p,
+             cs_real_t          *g)
+{
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_adjacency_t  *f2c = cs_shared_connect->f2c;
+  cs_real_t  *g_all = (cs_glob_n_ranks > 1) ? sp->u_work : g;
+
+  assert(f2c->sgn != NULL);
+
+# pragma omp parallel for if (quant->n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < quant->n_faces; f_id++) {
+
+    cs_real_t  *_g = g_all + 3*f_id;
+
+    if (sp->skip_grad != NULL && sp->skip_grad[f_id]) {
+      _g[0] = _g[1] = _g[2] = 0.;
+      continue;
+    }
+
+    cs_real_t  _p = 0.;
+    for (cs_lnum_t j = f2c->idx[f_id]; j < f2c->idx[f_id+1]; j++)
+      _p -= f2c->sgn[j] * p[f2c->ids[j]];
+
+    const cs_real_t  *fv = _face_vector(f_id, quant);
+    for (int k = 0; k < 3; k++)
+      _g[k] = _p * fv[k];
+
+  }
+
+  if (cs_glob_n_ranks > 1) {
+
+    /* Contributions of cells located on distant ranks */
+    cs_interface_set_sum(sp->rset->ifs,
+                         sp->n_u_all, 1, false, CS_REAL_TYPE,
+                         g_all);
+
+    cs_range_set_gather(sp->rset, CS_REAL_TYPE, 1, g_all, g);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize a _saddle_t structure once the velocity block has been
+ *         built. The approximation of the Schur complement is set.
+ *
+ * \param[in]      nsp      pointer to a \ref cs_navsto_param_t structure
+ * \param[in]      mom_eq   pointer to the momentum equation
+ * \param[in, out] sp       pointer to the _saddle_t structure to set
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_init(const cs_navsto_param_t    *nsp,
+             const cs_equation_t        *mom_eq,
+             _saddle_t                  *sp)
+{
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_adjacency_t  *c2f = cs_shared_connect->c2f;
+  const cs_equation_param_t  *mom_eqp = mom_eq->param;
+  const cs_cdo_bc_t  *face_bc = mom_eq->builder->face_bc;
+
+  sp->n_u = mom_eq->n_sles_gather_elts;
+  sp->n_u_all = mom_eq->n_sles_scatter_elts;
+  sp->n_p = quant->n_cells;
+  sp->rset = mom_eq->rset;
+  sp->a = mom_eq->matrix;
+  sp->sles_u = cs_sles_find_or_add(mom_eq->field_id, NULL);
+  sp->eps_u = mom_eqp->itsol_info.eps;
+
+  const cs_lnum_t  n_work = CS_MAX(sp->n_u_all,
+                                   cs_matrix_get_n_columns(sp->a));
+
+  BFT_MALLOC(sp->u_work, n_work, cs_real_t);
+  BFT_MALLOC(sp->v_work, n_work, cs_real_t);
+  BFT_MALLOC(sp->y_work, n_work, cs_real_t);
+  BFT_MALLOC(sp->g_work, sp->n_u, cs_real_t);
+  BFT_MALLOC(sp->s_inv, sp->n_p, cs_real_t);
+
+  /* Velocity rows related to a Dirichlet BC are replaced when the BC is
+     enforced algebraically or by a penalization. The pressure gradient
+     should not act on these rows. */
+  cs_gnum_t  n_free_faces = 0;
+  sp->skip_grad = NULL;
+
+  const bool  strong_dir =
+    (mom_eqp->enforcement == CS_PARAM_BC_ENFORCE_ALGEBRAIC ||
+     mom_eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED) ? true : false;
+
+  if (strong_dir) {
+    BFT_MALLOC(sp->skip_grad, quant->n_faces, bool);
+    for (cs_lnum_t f_id = 0; f_id < quant->n_faces; f_id++)
+      sp->skip_grad[f_id] = false;
+  }
+
+  for (cs_lnum_t bf_id = 0; bf_id < quant->n_b_faces; bf_id++) {
+
+    const cs_flag_t  dir_flag = CS_CDO_BC_DIRICHLET | CS_CDO_BC_HMG_DIRICHLET;
+
+    if (face_bc->flag[bf_id] & dir_flag) {
+      if (strong_dir)
+        sp->skip_grad[quant->n_i_faces + bf_id] = true;
+    }
+    else
+      n_free_faces++;
+
+  }
+
+  if (cs_glob_n_ranks > 1)
+    cs_parall_counter(&n_free_faces, 1);
+  sp->p_is_free = (n_free_faces == 0) ? true : false;
+
+  /* Approximation of the Schur complement (only its diagonal is kept) */
+  switch (nsp->schur_approx) {
+
+  case CS_NAVSTO_SCHUR_DIAG_INVERSE:
+    {
+      const cs_real_t  *diag = cs_matrix_get_diagonal(sp->a);
+      const cs_real_t  *d_all = diag;
+
+      if (cs_glob_n_ranks > 1) {
+        cs_range_set_scatter(sp->rset, CS_REAL_TYPE, 1, diag, sp->u_work);
+        d_all = sp->u_work;
+      }
+
+#     pragma omp parallel for if (quant->n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+        cs_real_t  s = 0.;
+        for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+
+          const cs_lnum_t  f_id = c2f->ids[j];
+          if (sp->skip_grad != NULL && sp->skip_grad[f_id])
+            continue;
+
+          const cs_real_t  *fv = _face_vector(f_id, quant);
+          for (int k = 0; k < 3; k++)
+            if (fabs(d_all[3*f_id+k]) > 0.)
+              s += fv[k]*fv[k] / d_all[3*f_id+k];
+
+        }
+        sp->s_inv[c_id] = (s > 0.) ? 1./s : 0.;
+
+      }
+    }
+    break;
+
+  case CS_NAVSTO_SCHUR_MASS_SCALED:
+    {
+      const cs_property_t  *visc = cs_property_by_name("laminar_viscosity");
+      const cs_real_t  t_cur = cs_shared_time_step->t_cur;
+
+      if (cs_property_is_uniform(visc)) {
+
+        const cs_real_t  nu = cs_property_get_cell_value(0, t_cur, visc);
+        for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++)
+          sp->s_inv[c_id] = nu/quant->cell_vol[c_id];
+
+      }
+      else {
+
+        for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++)
+          sp->s_inv[c_id] = cs_property_get_cell_value(c_id, t_cur, visc)
+            / quant->cell_vol[c_id];
+
+      }
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid approximation of the Schur complement.",
+              __func__);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the buffers of a _saddle_t structure
+ *
+ * \param[in, out] sp       pointer to the _saddle_t structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_free(_saddle_t      *sp)
+{
+  BFT_FREE(sp->u_work);
+  BFT_FREE(sp->v_work);
+  BFT_FREE(sp->y_work);
+  BFT_FREE(sp->g_work);
+  BFT_FREE(sp->s_inv);
+  if (sp->skip_grad != NULL)
+    BFT_FREE(sp->skip_grad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute y = K.x where K = [A B^T; B 0] is the saddle-point matrix
+ *
+ * \param[in, out] sp     pointer to a _saddle_t structure
+ * \param[in]      x      input vector (velocity then pressure DoFs)
+ * \param[in, out] y      result
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_matvec(_saddle_t          *sp,
+               const cs_real_t    *x,
+               cs_real_t          *y)
+{
+  /* The matrix-vector product may require a halo synchronization. Input
+     and output vectors are then extended to the ghost range */
+  memcpy(sp->v_work, x, sp->n_u*sizeof(cs_real_t));
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE,
+                            sp->a, sp->v_work, sp->y_work);
+
+  _saddle_grad(sp, x + sp->n_u, sp->g_work);
+
+# pragma omp parallel for if (sp->n_u > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < sp->n_u; i++)
+    y[i] = sp->y_work[i] + sp->g_work[i];
+
+  _saddle_div(sp, x, y + sp->n_u);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the upper block-triangular preconditioner
+ *         P = [A B^T; 0 -S] where S is an approximation of the Schur
+ *         complement and A^-1 is replaced by an inexact solve
+ *
+ * \param[in, out] sp     pointer to a _saddle_t structure
+ * \param[in]      r      vector to precondition
+ * \param[in, out] z      result
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_precond(_saddle_t          *sp,
+                const cs_real_t    *r,
+                cs_real_t          *z)
+{
+  const cs_real_t  *r_p = r + sp->n_u;
+  cs_real_t  *z_p = z + sp->n_u;
+
+  /* Pressure block */
+# pragma omp parallel for if (sp->n_p > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < sp->n_p; c_id++)
+    z_p[c_id] = -sp->s_inv[c_id] * r_p[c_id];
+
+  /* Velocity block: A z_u = r_u - B^T z_p */
+  _saddle_grad(sp, z_p, sp->g_work);
+
+# pragma omp parallel for if (sp->n_u > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < sp->n_u; i++) {
+    sp->g_work[i] = r[i] - sp->g_work[i];
+    sp->v_work[i] = 0.;
+  }
+
+  int  n_iters = 0;
+  double  residual = DBL_MAX;
+
+  cs_sles_solve(sp->sles_u,
+                sp->a,
+                CS_HALO_ROTATION_IGNORE,
+                sp->eps_u,
+                1.0,       // r_norm
+                &n_iters,
+                &residual,
+                sp->g_work,
+                sp->v_work,
+                0,         // aux. size
+                NULL);     // aux. buffers
+
+  memcpy(z, sp->v_work, sp->n_u*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve K.x = b with a restarted flexible GMRES algorithm
+ *         (right preconditioning) where K is the saddle-point matrix
+ *
+ * \param[in]      nsp        pointer to a \ref cs_navsto_param_t structure
+ * \param[in, out] sp         pointer to a _saddle_t structure
+ * \param[in]      b          right-hand side
+ * \param[in, out] x          initial guess in and solution out
+ * \param[out]     n_iters    number of iterations performed
+ * \param[out]     residual   relative residual norm reached
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_fgmres(const cs_navsto_param_t    *nsp,
+               _saddle_t                  *sp,
+               const cs_real_t            *b,
+               cs_real_t                  *x,
+               int                        *n_iters,
+               double                     *residual)
+{
+  const int  m = CS_CDOFB_NAVSTO_RESTART;
+  const cs_lnum_t  n = sp->n_u + sp->n_p;
+
+  double  h[(CS_CDOFB_NAVSTO_RESTART + 1)*CS_CDOFB_NAVSTO_RESTART];
+  double  g[CS_CDOFB_NAVSTO_RESTART + 1];
+  double  gc[CS_CDOFB_NAVSTO_RESTART], gs[CS_CDOFB_NAVSTO_RESTART];
+  double  y[CS_CDOFB_NAVSTO_RESTART];
+
+  cs_real_t  *v = NULL, *z = NULL, *w = NULL;
+  BFT_MALLOC(v, (m + 1)*n, cs_real_t);
+  BFT_MALLOC(z, m*n, cs_real_t);
+  BFT_MALLOC(w, n, cs_real_t);
+
+  double  b_norm = sqrt(cs_gdot(n, b, b));
+  if (b_norm < DBL_MIN)
+    b_norm = 1.;
+
+  const double  tol = nsp->sp_eps * b_norm;
+
+  int  iter = 0;
+  double  r_norm = DBL_MAX;
+
+  while (iter < nsp->sp_max_iter) {
+
+    /* Residual r = b - K.x stored in the first Krylov vector */
+    _saddle_matvec(sp, x, w);
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++)
+      v[i] = b[i] - w[i];
+
+    r_norm = sqrt(cs_gdot(n, v, v));
+    if (r_norm < tol)
+      break;
+
+    const double  inv_norm = 1./r_norm;
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++)
+      v[i] *= inv_norm;
+
+    g[0] = r_norm;
+    for (int j = 1; j < m + 1; j++)
+      g[j] = 0.;
+
+    int  k = 0;
+    for (int j = 0; j < m && iter < nsp->sp_max_iter; j++) {
+
+      cs_real_t  *vj = v + j*n, *zj = z + j*n, *vj1 = v + (j+1)*n;
+
+      _saddle_precond(sp, vj, zj);
+      _saddle_matvec(sp, zj, vj1);
+
+      /* Modified Gram-Schmidt orthogonalization */
+      for (int i = 0; i < j + 1; i++) {
+        const double  hij = cs_gdot(n, vj1, v + i*n);
+        h[i*m + j] = hij;
+        cs_axpy(n, -hij, v + i*n, vj1);
+      }
+
+      const double  hj1 = sqrt(cs_gdot(n, vj1, vj1));
+      h[(j+1)*m + j] = hj1;
+      if (hj1 > DBL_MIN) {
+        const double  inv_hj1 = 1./hj1;
+#       pragma omp parallel for if (n > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < n; i++)
+          vj1[i] *= inv_hj1;
+      }
+
+      /* Apply the previous Givens rotations to the new column */
+      for (int i = 0; i < j; i++) {
+        const double  h0 = h[i*m + j], h1 = h[(i+1)*m + j];
+        h[i*m + j] = gc[i]*h0 + gs[i]*h1;
+        h[(i+1)*m + j] = -gs[i]*h0 + gc[i]*h1;
+      }
+
+      /* New Givens rotation */
+      const double  hjj = h[j*m + j];
+      const double  den = sqrt(hjj*hjj + hj1*hj1);
+      gc[j] = (den > DBL_MIN) ? hjj/den : 1.;
+      gs[j] = (den > DBL_MIN) ? hj1/den : 0.;
+      h[j*m + j] = gc[j]*hjj + gs[j]*hj1;
+      h[(j+1)*m + j] = 0.;
+
+      g[j+1] = -gs[j]*g[j];
+      g[j] = gc[j]*g[j];
+
+      iter++;
+      k = j + 1;
+      r_norm = fabs(g[j+1]);
+
+      if (r_norm < tol || hj1 <= DBL_MIN)
+        break;
+
+    } /* Arnoldi process */
+
+    /* Solve the upper triangular system H.y = g and update x += Z.y */
+    for (int i = k - 1; i > -1; i--) {
+      double  yi = g[i];
+      for (int l = i + 1; l < k; l++)
+        yi -= h[i*m + l]*y[l];
+      y[i] = yi/h[i*m + i];
+    }
+
+    for (int i = 0; i < k; i++)
+      cs_axpy(n, y[i], z + i*n, x);
+
+    if (r_norm < tol)
+      break;
+
+  } /* Restart loop */
+
+  *n_iters = iter;
+  *residual = r_norm/b_norm;
+
+  BFT_FREE(v);
+  BFT_FREE(z);
+  BFT_FREE(w);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -402,6 +937,39 @@ cs_cdofb_navsto_init_proj_context(const cs_navsto_param_t    *nsp,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize a \ref cs_cdofb_navsto_t structure storing in the case of
+ *         a monolithic approach
+ *
+ * \param[in] nsp        pointer to a \ref cs_navsto_param_t structure
+ * \param[in] nsc_input  pointer to a \ref cs_navsto_coupling_monolithic_t
+ *                       structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdofb_navsto_init_monolithic_context(const cs_navsto_param_t    *nsp,
+                                        const void                 *nsc_input)
+{
+  /* Sanity checks */
+  assert(nsp != NULL && nsc_input != NULL);
+
+  /* Navier-Navsto scheme context (NSSC) */
+  cs_cdofb_navsto_t  *nssc = _create_navsto_context(nsp);
+
+  const cs_navsto_coupling_monolithic_t  *nsc =
+    (const cs_navsto_coupling_monolithic_t *)nsc_input;
+
+  cs_cdofb_navsto_context = nssc;
+
+  /* Face velocity is shared with the momentum equation */
+  cs_equation_t *mom_eq = nsc->momentum;
+
+  nssc->face_velocity =
+    ((cs_cdofb_vecteq_t *)mom_eq->scheme_context)->face_values;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Destroy a \ref cs_cdofb_navsto_t structure
@@ -413,13 +981,15 @@ cs_cdofb_navsto_init_proj_context(const cs_navsto_param_t    *nsp,
 void
 cs_cdofb_navsto_free_context(const cs_navsto_param_t      *nsp)
 {
-  CS_UNUSED(nsp);
-
   cs_cdofb_navsto_t  *nssc = cs_cdofb_navsto_context;
 
   if (nssc == NULL)
     return;
 
+  /* Face values are owned by the momentum equation */
+  if (nsp->coupling == CS_NAVSTO_COUPLING_MONOLITHIC)
+    nssc->face_velocity = NULL;
+
   /* Free temporary buffers */
   if (nssc->face_velocity != NULL) BFT_FREE(nssc->face_velocity);
   if (nssc->face_pressure != NULL) BFT_FREE(nssc->face_pressure);
@@ -560,6 +1130,128 @@ cs_cdofb_navsto_proj_compute(const cs_mesh_t              *mesh,
   cs_timer_counter_add_diff(&(nssc->timer), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve the Navier-Stokes system with a CDO face-based scheme using
+ *         a monolithic approach: the saddle-point system in (u, p) is solved
+ *         at once with a flexible GMRES and a block-triangular preconditioner
+ *
+ * \param[in]      mesh        pointer to a \ref cs_mesh_t structure
+ * \param[in]      dt_cur      current value of the time step
+ * \param[in]      nsp         pointer to a \ref cs_navsto_param_t structure
+ * \param[in, out] nsc_input   Navier-Stokes coupling context: pointer to a
+ *                             structure cast on-the-fly
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdofb_navsto_monolithic_compute(const cs_mesh_t              *mesh,
+                                   double                        dt_cur,
+                                   const cs_navsto_param_t      *nsp,
+                                   void                         *nsc_input)
+{
+  cs_cdofb_navsto_t  *nssc = cs_cdofb_navsto_context;
+  cs_navsto_coupling_monolithic_t  *nscc =
+    (cs_navsto_coupling_monolithic_t *)nsc_input;
+
+  cs_equation_t *mom_eq = nscc->momentum;
+  cs_field_t  *vel_fld = cs_field_by_id(mom_eq->field_id);
+  cs_field_t  *pre_fld = nssc->pressure;
+
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+
+  cs_timer_t  t0 = cs_timer_time();
+
+  /* Build the velocity block and the related right-hand side */
+  cs_equation_build_system(mesh, cs_shared_time_step, dt_cur, mom_eq);
+
+  cs_real_t  *x_u = NULL, *b_u = NULL;
+  mom_eq->prepare_solving(mom_eq, &x_u, &b_u);
+
+  _saddle_t  sp;
+  _saddle_init(nsp, mom_eq, &sp);
+
+  const cs_lnum_t  n_u = sp.n_u, n_p = sp.n_p;
+
+  cs_real_t  *x = NULL, *b = NULL;
+  BFT_MALLOC(x, n_u + n_p, cs_real_t);
+  BFT_MALLOC(b, n_u + n_p, cs_real_t);
+
+  memcpy(x, x_u, n_u*sizeof(cs_real_t));
+  memcpy(b, b_u, n_u*sizeof(cs_real_t));
+  memcpy(x + n_u, pre_fld->val, n_p*sizeof(cs_real_t));
+  for (cs_lnum_t c_id = 0; c_id < n_p; c_id++)
+    b[n_u + c_id] = 0.;  /* No mass source */
+
+  int  n_iters = 0;
+  double  residual = DBL_MAX;
+
+  _saddle_fgmres(nsp, &sp, b, x, &n_iters, &residual);
+
+  if (nsp->verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "  <NavSto/Monolithic> n_iters %d residual % -8.4e\n",
+                  n_iters, residual);
+
+  /* Pressure is defined up to a constant: set a zero mean value */
+  cs_real_t  *p = x + n_u;
+
+  if (sp.p_is_free) {
+
+    double  mean[2] = {0., 0.};
+    for (cs_lnum_t c_id = 0; c_id < n_p; c_id++) {
+      mean[0] += quant->cell_vol[c_id] * p[c_id];
+      mean[1] += quant->cell_vol[c_id];
+    }
+    if (cs_glob_n_ranks > 1)
+      cs_parall_sum(2, CS_DOUBLE, mean);
+
+    const double  p_mean = mean[0]/mean[1];
+    for (cs_lnum_t c_id = 0; c_id < n_p; c_id++)
+      p[c_id] -= p_mean;
+
+  }
+
+  /* Update the velocity (face and cell DoFs) and the pressure */
+  memcpy(x_u, x, n_u*sizeof(cs_real_t));
+
+  if (cs_glob_n_ranks > 1) { /* Parallel mode */
+
+    cs_range_set_scatter(mom_eq->rset,
+                         CS_REAL_TYPE, 1, // type and stride
+                         x_u,
+                         x_u);
+
+    cs_range_set_scatter(mom_eq->rset,
+                         CS_REAL_TYPE, 1, // type and stride
+                         b_u,
+                         mom_eq->rhs);
+
+  }
+
+  cs_field_current_to_previous(vel_fld);
+  cs_field_current_to_previous(pre_fld);
+
+  mom_eq->update_field(x_u, mom_eq->rhs, mom_eq->param,
+                       mom_eq->builder, mom_eq->scheme_context, vel_fld->val);
+
+  memcpy(pre_fld->val, p, n_p*sizeof(cs_real_t));
+
+  /* Free memory */
+  _saddle_free(&sp);
+  BFT_FREE(x);
+  BFT_FREE(b);
+  BFT_FREE(x_u);
+  if (b_u != mom_eq->rhs)
+    BFT_FREE(b_u);
+  BFT_FREE(mom_eq->rhs);
+  cs_sles_free(sp.sles_u);
+  cs_matrix_destroy(&(mom_eq->matrix));
+
+  cs_timer_t  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(nssc->timer), &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve the values of the velocity on the faces
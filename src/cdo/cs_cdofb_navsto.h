@@ -144,6 +144,21 @@ void
 cs_cdofb_navsto_init_proj_context(const cs_navsto_param_t    *nsp,
                                   const void                 *nsc_input);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize a \ref cs_cdofb_navsto_t structure storing in the case of
+ *         a monolithic approach
+ *
+ * \param[in] nsp        pointer to a \ref cs_navsto_param_t structure
+ * \param[in] nsc_input  pointer to a \ref cs_navsto_coupling_monolithic_t
+ *                       structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdofb_navsto_init_monolithic_context(const cs_navsto_param_t    *nsp,
+                                        const void                 *nsc_input);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Destroy a \ref cs_cdofb_navsto_t structure
@@ -231,6 +246,26 @@ cs_cdofb_navsto_proj_compute(const cs_mesh_t              *mesh,
                              const cs_navsto_param_t      *nsp,
                              void                         *nsc_input);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve the Navier-Stokes system with a CDO face-based scheme using
+ *         a monolithic approach: the saddle-point system in (u, p) is solved
+ *         at once with a flexible GMRES and a block-triangular preconditioner
+ *
+ * \param[in]      mesh        pointer to a \ref cs_mesh_t structure
+ * \param[in]      dt_cur      current value of the time step
+ * \param[in]      nsp         pointer to a \ref cs_navsto_param_t structure
+ * \param[in, out] nsc_input   Navier-Stokes coupling context: pointer to a
+ *                             structure cast on-the-fly
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdofb_navsto_monolithic_compute(const cs_mesh_t              *mesh,
+                                   double                        dt_cur,
+                                   const cs_navsto_param_t      *nsp,
+                                   void                         *nsc_input);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve the values of the velocity on the faces
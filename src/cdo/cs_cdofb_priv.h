@@ -85,6 +85,9 @@ struct  _cs_cdofb_t {
   /* Pointer of function to apply the time scheme */
   cs_cdo_time_scheme_t            *apply_time_scheme;
 
+  /* Cache of cellwise stiffness matrices (NULL if not used) */
+  cs_hodge_cache_t                *stiffness_cache;
+
 };
 
 /*============================================================================
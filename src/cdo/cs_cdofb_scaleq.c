@@ -498,6 +498,19 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
   } /* There is at least one source term */
 
+  /* Cache of cellwise operators (only if requested) */
+  eqc->stiffness_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->stiffness_cache =
+      cs_equation_create_hodge_cache(eqp, eqp->diffusion_property,
+                                     connect->c2f, 1);
+
+  /* Matrix-free operator (only if requested). Cell DoFs are eliminated by
+     static condensation so that only face DoFs are stored */
+  eqb->mfree =
+    cs_equation_mfree_create(eqp, connect->c2f, 1,
+                             connect->range_sets[CS_CDO_CONNECT_FACE_SP0]);
+
   return eqc;
 }
 
@@ -525,6 +538,8 @@ cs_cdofb_scaleq_free_context(void   *data)
   BFT_FREE(eqc->rc_tilda);
   BFT_FREE(eqc->acf_tilda);
 
+  eqc->stiffness_cache = cs_hodge_cache_free(eqc->stiffness_cache);
+
   BFT_FREE(eqc);
 
   return NULL;
@@ -552,14 +567,23 @@ cs_cdofb_scaleq_initialize_system(const cs_equation_param_t  *eqp,
                                   cs_real_t                 **system_rhs)
 {
   assert(eqb != NULL);
-  assert(*system_matrix == NULL && *system_rhs == NULL);
+  assert(*system_rhs == NULL);
   CS_UNUSED(data);
   CS_UNUSED(eqp);
 
   cs_timer_t  t0 = cs_timer_time();
 
-  /* Create the matrix related to the current algebraic system */
-  *system_matrix = cs_matrix_create(cs_shared_ms);
+  /* Create the matrix related to the current algebraic system (unless the
+     operator is frozen and the matrix of a previous time step is kept) */
+  if (eqb->matrix_is_frozen)
+    assert(*system_matrix != NULL);
+  else {
+    assert(*system_matrix == NULL);
+    if (eqb->mfree != NULL)
+      *system_matrix = cs_equation_mfree_create_matrix(eqb->mfree);
+    else
+      *system_matrix = cs_matrix_create(cs_shared_ms);
+  }
 
   const cs_cdo_quantities_t  *quant = cs_shared_quant;
 
@@ -653,9 +677,11 @@ cs_cdofb_scaleq_build_system(const cs_mesh_t            *mesh,
 
   cs_timer_t  t0 = cs_timer_time();
 
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav =
-    cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  /* Initialize the structure to assemble values (no global matrix is
+     assembled with a matrix-free operator or with a frozen operator) */
+  cs_matrix_assembler_values_t  *mav = NULL;
+  if (eqb->mfree == NULL && !eqb->matrix_is_frozen)
+    mav = cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
   cs_cdofb_scaleq_t  *eqc = (cs_cdofb_scaleq_t *)data;
 
@@ -711,191 +737,212 @@ cs_cdofb_scaleq_build_system(const cs_mesh_t            *mesh,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    /* Cells are gathered by colors. Cells of the same color share no face
+       so that they are assembled by several threads without conflict. */
+    for (int color = 0; color < connect->n_cell_colors; color++) {
 
-      const cs_flag_t  cell_flag = connect->cell_flag[c_id];
-      const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
+      const cs_lnum_t  s_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color]];
+      const cs_lnum_t  e_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color+1]];
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+#     pragma omp for CS_CDO_OMP_SCHEDULE
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+        const cs_lnum_t  c_id = connect->cell_batch_ids[i];
+
+        const cs_flag_t  cell_flag = connect->cell_flag[c_id];
+        const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _init_cell_system(cell_flag, cm, eqp, eqb, eqc,
-                        dir_values, neu_tags, field_val, t_eval_pty, // in
-                        csys, cb);                                   // out
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        _init_cell_system(cell_flag, cm, eqp, eqb, eqc,
+                          dir_values, neu_tags, field_val, t_eval_pty, // in
+                          csys, cb);                                   // out
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 2
-      if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
+        if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
 #endif
 
-      /* DIFFUSION TERM */
-      /* ============== */
+        /* DIFFUSION TERM */
+        /* ============== */
 
-      if (cs_equation_param_has_diffusion(eqp)) {
+        if (cs_equation_param_has_diffusion(eqp)) {
 
-        /* Define the local stiffness matrix */
-        if (!(eqb->diff_pty_uniform))
-          cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty, cell_flag,
-                                                cb);
+          /* Define the local stiffness matrix */
+          if (!(eqb->diff_pty_uniform))
+            cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty,
+                                                  cell_flag, cb);
 
-        /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+          /* local matrix owned by the cellwise builder (store in cb->loc) */
+          cs_hodge_cache_get(eqc->stiffness_cache, eqc->get_stiffness_matrix,
+                             eqp->diffusion_hodge, cm, cb, cb->loc);
 
-        /* Add the local diffusion operator to the local system */
-        cs_sdm_add(csys->mat, cb->loc);
+          /* Add the local diffusion operator to the local system */
+          cs_sdm_add(csys->mat, cb->loc);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
+          if (cs_dbg_cw_test(cm))
+            cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
 #endif
-      } /* END OF DIFFUSION */
+        } /* END OF DIFFUSION */
 
-      /* SOURCE TERM */
-      /* =========== */
+        /* SOURCE TERM */
+        /* =========== */
 
-      if (cs_equation_param_has_sourceterm(eqp)) {
+        if (cs_equation_param_has_sourceterm(eqp)) {
 
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+          /* Reset the local contribution */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (const cs_xdef_t **)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        t_eval_pty,
-                                        NULL,  /* No input structure */
-                                        cb,    /* mass matrix is cb->hdg */
-                                        csys->source);
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (const cs_xdef_t **)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          t_eval_pty,
+                                          NULL,  /* No input structure */
+                                          cb,    /* mass matrix is cb->hdg */
+                                          csys->source);
 
-        csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
+          csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
-        /* Reset the value of the source term for the cell DoF
-           Source term is only hold by the cell DoF in face-based schemes */
-        eqc->source_terms[c_id] = csys->source[cm->n_fc];
+          /* Reset the value of the source term for the cell DoF
+             Source term is only hold by the cell DoF in face-based schemes */
+          eqc->source_terms[c_id] = csys->source[cm->n_fc];
 
-      } /* End of term source contribution */
+        } /* End of term source contribution */
 
-      /* UNSTEADY TERM + TIME SCHEME */
-      /* =========================== */
+        /* UNSTEADY TERM + TIME SCHEME */
+        /* =========================== */
 
-      if (cs_equation_param_has_time(eqp)) {
+        if (cs_equation_param_has_time(eqp)) {
 
-        /* Get the value of the time property */
-        double  tpty_val = 1/dt_cur;
-        if (eqb->time_pty_uniform)
-          tpty_val *= time_pty_val;
-        else
-          tpty_val *= cs_property_get_cell_value(c_id, t_eval_pty,
-                                                 eqp->time_property);
+          /* Get the value of the time property */
+          double  tpty_val = 1/dt_cur;
+          if (eqb->time_pty_uniform)
+            tpty_val *= time_pty_val;
+          else
+            tpty_val *= cs_property_get_cell_value(c_id, t_eval_pty,
+                                                   eqp->time_property);
 
-        /* Assign local matrix to a mass matrix to define */
-        cs_sdm_t  *mass_mat = cb->loc;
-        assert(mass_mat->n_rows == mass_mat->n_cols);
-        assert(mass_mat->n_rows == cm->n_fc + 1);
+          /* Assign local matrix to a mass matrix to define */
+          cs_sdm_t  *mass_mat = cb->loc;
+          assert(mass_mat->n_rows == mass_mat->n_cols);
+          assert(mass_mat->n_rows == cm->n_fc + 1);
 
-        if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) {
+          if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) {
 
-          /* Use a vector to deal with the diagonal matrix */
-          memset(mass_mat->val, 0, sizeof(cs_real_t)*(cm->n_fc + 1));
-          mass_mat->val[cm->n_fc] = cm->vol_c * tpty_val;
+            /* Use a vector to deal with the diagonal matrix */
+            memset(mass_mat->val, 0, sizeof(cs_real_t)*(cm->n_fc + 1));
+            mass_mat->val[cm->n_fc] = cm->vol_c * tpty_val;
 
-        }
-        else {
+          }
+          else {
 
-          memset(mass_mat->val, 0,
-                 sizeof(cs_real_t)*(cm->n_fc + 1)*(cm->n_fc + 1));
+            memset(mass_mat->val, 0,
+                   sizeof(cs_real_t)*(cm->n_fc + 1)*(cm->n_fc + 1));
 
-          bft_error(__FILE__, __LINE__, 0,
-                    "%s: Not implemented yet.", __func__);
+            bft_error(__FILE__, __LINE__, 0,
+                      "%s: Not implemented yet.", __func__);
 
-        }
+          }
 
-        /* Apply the time discretization to the local system.
-           Update csys (matrix and rhs) */
-        eqc->apply_time_scheme(eqp, tpty_val, mass_mat, eqb->sys_flag, cb,
-                               csys);
+          /* Apply the time discretization to the local system.
+             Update csys (matrix and rhs) */
+          eqc->apply_time_scheme(eqp, tpty_val, mass_mat, eqb->sys_flag, cb,
+                                 csys);
 
-      } /* END OF TIME CONTRIBUTION */
+        } /* END OF TIME CONTRIBUTION */
 
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
-       * Operations that have to be performed BEFORE the static condensation
-       */
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
+         * Operations that have to be performed BEFORE the static condensation
+         */
+        if (cell_flag & CS_FLAG_BOUNDARY) {
 
-        /* Neumann boundary conditions */
-        if (csys->has_nhmg_neumann)
-          for (short int f  = 0; f < cm->n_fc; f++)
-            csys->rhs[f] += csys->neu_values[f];
+          /* Neumann boundary conditions */
+          if (csys->has_nhmg_neumann)
+            for (short int f  = 0; f < cm->n_fc; f++)
+              csys->rhs[f] += csys->neu_values[f];
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix before condensation",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix before condensation",
+                           c_id, csys);
 #endif
 
-      /* Static condensation of the local system matrix of size n_fc + 1 into
-         a matrix of size n_fc.
-         Store data in rc_tilda and acf_tilda to compute the values at cell
-         centers after solving the system */
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda,
-                                       eqc->acf_tilda,
-                                       cb, csys);
+        /* Static condensation of the local system matrix of size n_fc + 1 into
+           a matrix of size n_fc.
+           Store data in rc_tilda and acf_tilda to compute the values at cell
+           centers after solving the system */
+        cs_static_condensation_scalar_eq(connect->c2f,
+                                         eqc->rc_tilda,
+                                         eqc->acf_tilda,
+                                         cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix after condensation",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix after condensation",
+                           c_id, csys);
 #endif
 
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
-       * Operations that have to be performed AFTER the static condensation
-       */
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
+         * Operations that have to be performed AFTER the static condensation
+         */
+        if (cell_flag & CS_FLAG_BOUNDARY) {
 
-        if (eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED ||
-            eqp->enforcement == CS_PARAM_BC_ENFORCE_ALGEBRAIC) {
+          if (eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED ||
+              eqp->enforcement == CS_PARAM_BC_ENFORCE_ALGEBRAIC) {
 
-          /* Weakly enforced Dirichlet BCs for cells attached to the boundary
-             csys is updated inside (matrix and rhs) */
-          eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,   /* in */
-                                 eqc->boundary_flux_op,      /* function */
-                                 fm, cb, csys);              /* in/out */
+            /* Weakly enforced Dirichlet BCs for cells attached to the boundary
+               csys is updated inside (matrix and rhs) */
+            eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,   /* in */
+                                   eqc->boundary_flux_op,      /* function */
+                                   fm, cb, csys);              /* in/out */
 
-        }
+          }
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
 #endif
 
-      /* ASSEMBLY */
-      /* ======== */
+        /* ASSEMBLY */
+        /* ======== */
 
-      const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_FACE_SP0];
+        const cs_range_set_t  *rs =
+          connect->range_sets[CS_CDO_CONNECT_FACE_SP0];
 
-      /* Matrix assembly */
-      cs_equation_assemble_matrix(csys, rs, mav);
+        /* Matrix assembly (skipped if the matrix is frozen) */
+        if (eqb->mfree != NULL)
+          cs_equation_mfree_store(csys, eqb->mfree);
+        else if (mav != NULL)
+          cs_equation_assemble_matrix(csys, rs, true, mav);
 
-      /* Assemble RHS */
-      for (short int f = 0; f < cm->n_fc; f++)
-#       pragma omp atomic
-        rhs[cm->f_ids[f]] += csys->rhs[f];
+        /* Assemble RHS */
+        for (short int f = 0; f < cm->n_fc; f++)
+          rhs[cm->f_ids[f]] += csys->rhs[f];
+
+      } /* Main loop on cells */
 
-    } /* Main loop on cells */
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
-  cs_matrix_assembler_values_done(mav); // optional
+  if (eqb->mfree != NULL)
+    cs_equation_mfree_finalize(eqb->mfree);
+  else if (mav != NULL)
+    cs_matrix_assembler_values_done(mav); // optional
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 2
   cs_dbg_darray_to_listing("FINAL RHS_FACE", quant->n_faces, rhs, 8);
@@ -904,7 +951,8 @@ cs_cdofb_scaleq_build_system(const cs_mesh_t            *mesh,
   /* Free temporary buffers and structures */
   BFT_FREE(dir_values);
   BFT_FREE(neu_tags);
-  cs_matrix_assembler_values_finalize(&mav);
+  if (mav != NULL)
+    cs_matrix_assembler_values_finalize(&mav);
 
   cs_timer_t  t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
@@ -1087,7 +1135,8 @@ cs_cdofb_scaleq_balance(const cs_equation_param_t     *eqp,
                                                 cb);
 
         /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+        cs_hodge_cache_get(eqc->stiffness_cache, eqc->get_stiffness_matrix,
+                           eqp->diffusion_hodge, cm, cb, cb->loc);
 
         cs_real_t  *res = cb->values;
         for (short int v = 0; v < cm->n_vc; v++)
@@ -537,6 +537,19 @@ cs_cdofb_vecteq_init_context(const cs_equation_param_t   *eqp,
 
   } /* There is at least one source term */
 
+  /* Cache of cellwise operators (only if requested) */
+  eqc->stiffness_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->stiffness_cache =
+      cs_equation_create_hodge_cache(eqp, eqp->diffusion_property,
+                                     connect->c2f, 1);
+
+  /* Matrix-free operator (only if requested). Cell DoFs are eliminated by
+     static condensation so that only face DoFs are stored */
+  eqb->mfree =
+    cs_equation_mfree_create(eqp, connect->c2f, 3,
+                             connect->range_sets[CS_CDO_CONNECT_FACE_VP0]);
+
   return eqc;
 }
 
@@ -564,6 +577,8 @@ cs_cdofb_vecteq_free_context(void   *data)
   BFT_FREE(eqc->rc_tilda);
   BFT_FREE(eqc->acf_tilda);
 
+  eqc->stiffness_cache = cs_hodge_cache_free(eqc->stiffness_cache);
+
   BFT_FREE(eqc);
 
   return NULL;
@@ -598,7 +613,10 @@ cs_cdofb_vecteq_initialize_system(const cs_equation_param_t  *eqp,
   cs_timer_t  t0 = cs_timer_time();
 
   /* Create the matrix related to the current algebraic system */
-  *system_matrix = cs_matrix_create(cs_shared_ms);
+  if (eqb->mfree != NULL)
+    *system_matrix = cs_equation_mfree_create_matrix(eqb->mfree);
+  else
+    *system_matrix = cs_matrix_create(cs_shared_ms);
 
   const cs_cdo_quantities_t  *quant = cs_shared_quant;
 
@@ -695,9 +713,11 @@ cs_cdofb_vecteq_build_system(const cs_mesh_t            *mesh,
 
   cs_timer_t  t0 = cs_timer_time();
 
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav =
-    cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  /* Initialize the structure to assemble values (no global matrix is
+     assembled with a matrix-free operator) */
+  cs_matrix_assembler_values_t  *mav = NULL;
+  if (eqb->mfree == NULL)
+    mav = cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
   cs_cdofb_vecteq_t  *eqc = (cs_cdofb_vecteq_t *)data;
 
@@ -751,171 +771,192 @@ cs_cdofb_vecteq_build_system(const cs_mesh_t            *mesh,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    /* Cells are gathered by colors. Cells of the same color share no face
+       so that they are assembled by several threads without conflict. */
+    for (int color = 0; color < connect->n_cell_colors; color++) {
+
+      const cs_lnum_t  s_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color]];
+      const cs_lnum_t  e_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color+1]];
+
+#     pragma omp for CS_CDO_OMP_SCHEDULE
+      for (cs_lnum_t c_idx = s_id; c_idx < e_id; c_idx++) {
 
-      const cs_flag_t  cell_flag = connect->cell_flag[c_id];
-      const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
+        const cs_lnum_t  c_id = connect->cell_batch_ids[c_idx];
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+        const cs_flag_t  cell_flag = connect->cell_flag[c_id];
+        const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      cs_cdofb_vecteq_init_cell_system(cell_flag, cm, eqp, eqb, eqc,
-                                       dir_values, neu_tags,
-                                       field_val, t_eval_pty,
-                                       csys, cb);
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        cs_cdofb_vecteq_init_cell_system(cell_flag, cm, eqp, eqb, eqc,
+                                         dir_values, neu_tags,
+                                         field_val, t_eval_pty,
+                                         csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 2
-      if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
+        if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
 #endif
 
-      /* DIFFUSION CONTRIBUTION TO THE ALGEBRAIC SYSTEM */
-      /* ============================================== */
+        /* DIFFUSION CONTRIBUTION TO THE ALGEBRAIC SYSTEM */
+        /* ============================================== */
 
-      if (cs_equation_param_has_diffusion(eqp)) {
+        if (cs_equation_param_has_diffusion(eqp)) {
 
-        /* Define the local stiffness matrix */
-        if (!(eqb->diff_pty_uniform))
-          cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty, cell_flag,
-                                                cb);
+          /* Define the local stiffness matrix */
+          if (!(eqb->diff_pty_uniform))
+            cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty,
+                                                  cell_flag, cb);
 
-        /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+          /* local matrix owned by the cellwise builder (store in cb->loc) */
+          cs_hodge_cache_get(eqc->stiffness_cache, eqc->get_stiffness_matrix,
+                             eqp->diffusion_hodge, cm, cb, cb->loc);
 
-        if (eqp->diffusion_hodge.is_iso == false)
-          bft_error(__FILE__, __LINE__, 0, " %s: Case not handle yet\n",
-                    __func__);
+          if (eqp->diffusion_hodge.is_iso == false)
+            bft_error(__FILE__, __LINE__, 0, " %s: Case not handle yet\n",
+                      __func__);
 
-        /* Add the local diffusion operator to the local system */
-        const cs_real_t  *sval = cb->loc->val;
-        for (int bi = 0; bi < cm->n_fc + 1; bi++) {
-          for (int bj = 0; bj < cm->n_fc + 1; bj++) {
+          /* Add the local diffusion operator to the local system */
+          const cs_real_t  *sval = cb->loc->val;
+          for (int bi = 0; bi < cm->n_fc + 1; bi++) {
+            for (int bj = 0; bj < cm->n_fc + 1; bj++) {
 
-            /* Retrieve the 3x3 matrix */
-            cs_sdm_t  *bij = cs_sdm_get_block(csys->mat, bi, bj);
-            assert(bij->n_rows == bij->n_cols && bij->n_rows == 3);
+              /* Retrieve the 3x3 matrix */
+              cs_sdm_t  *bij = cs_sdm_get_block(csys->mat, bi, bj);
+              assert(bij->n_rows == bij->n_cols && bij->n_rows == 3);
 
-            const cs_real_t  _val = sval[(cm->n_fc+1)*bi+bj];
-            bij->val[0] += _val;
-            bij->val[4] += _val;
-            bij->val[8] += _val;
+              const cs_real_t  _val = sval[(cm->n_fc+1)*bi+bj];
+              bij->val[0] += _val;
+              bij->val[4] += _val;
+              bij->val[8] += _val;
 
+            }
           }
-        }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
+          if (cs_dbg_cw_test(cm))
+            cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
 #endif
-      } /* END OF DIFFUSION */
-
-      /* SOURCE TERM COMPUTATION */
-      /* ======================= */
-
-      if (cs_equation_param_has_sourceterm(eqp)) {
-
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
-
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (const cs_xdef_t **)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        t_eval_pty,
-                                        NULL,  /* No input structure */
-                                        cb,    /* mass matrix is cb->hdg */
-                                        csys->source);
-
-        for (int k = 0; k < 3; k++)
-          csys->rhs[3*cm->n_fc + k] += csys->source[3*cm->n_fc + k];
-
-        /* Reset the value of the source term for the cell DoF
-           Source term is only hold by the cell DoF in face-based schemes */
-        for (int k = 0; k < 3; k++)
-          eqc->source_terms[3*c_id + k] = csys->source[3*cm->n_fc + k];
-
-      } /* End of term source contribution */
-
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
-       * Operations that have to be performed BEFORE the static condensation
-       */
-      if (cell_flag & CS_FLAG_BOUNDARY) {
-
-        /* Neumann boundary conditions */
-        if (csys->has_nhmg_neumann) {
-          for (short int f = 0; f < 3*cm->n_fc; f++)
-            csys->rhs[f] += csys->neu_values[f];
-        }
+        } /* END OF DIFFUSION */
+
+        /* SOURCE TERM COMPUTATION */
+        /* ======================= */
+
+        if (cs_equation_param_has_sourceterm(eqp)) {
+
+          /* Reset the local contribution */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (const cs_xdef_t **)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          t_eval_pty,
+                                          NULL,  /* No input structure */
+                                          cb,    /* mass matrix is cb->hdg */
+                                          csys->source);
+
+          for (int k = 0; k < 3; k++)
+            csys->rhs[3*cm->n_fc + k] += csys->source[3*cm->n_fc + k];
+
+          /* Reset the value of the source term for the cell DoF
+             Source term is only hold by the cell DoF in face-based schemes */
+          for (int k = 0; k < 3; k++)
+            eqc->source_terms[3*c_id + k] = csys->source[3*cm->n_fc + k];
+
+        } /* End of term source contribution */
+
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
+         * Operations that have to be performed BEFORE the static condensation
+         */
+        if (cell_flag & CS_FLAG_BOUNDARY) {
+
+          /* Neumann boundary conditions */
+          if (csys->has_nhmg_neumann) {
+            for (short int f = 0; f < 3*cm->n_fc; f++)
+              csys->rhs[f] += csys->neu_values[f];
+          }
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix before condensation",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix before condensation",
+                           c_id, csys);
 #endif
 
-      /* Static condensation of the local system stored inside a block matrix of
-         size n_fc + 1 into a block matrix of size n_fc.
-         Store information in the context structure in order to be able to
-         compute the values at cell centers. */
+        /* Static condensation of the local system stored inside a block
+           matrix of size n_fc + 1 into a block matrix of size n_fc.
+           Store information in the context structure in order to be able to
+           compute the values at cell centers. */
 
-      cs_static_condensation_vector_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+        cs_static_condensation_vector_eq(connect->c2f,
+                                         eqc->rc_tilda, eqc->acf_tilda,
+                                         cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix after condensation",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix after condensation",
+                           c_id, csys);
 #endif
 
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
-       * Operations that have to be performed AFTER the static condensation
-       */
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
+         * Operations that have to be performed AFTER the static condensation
+         */
+        if (cell_flag & CS_FLAG_BOUNDARY) {
 
-        if (eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED) {
+          if (eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED) {
 
-          /* Weakly enforced Dirichlet BCs for cells attached to the boundary
-             csys is updated inside (matrix and rhs) */
-          eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,   // in
-                                 eqc->boundary_flux_op,      // function
-                                 fm, cb, csys);              // in/out
+            /* Weakly enforced Dirichlet BCs for cells attached to the boundary
+               csys is updated inside (matrix and rhs) */
+            eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,   // in
+                                   eqc->boundary_flux_op,      // function
+                                   fm, cb, csys);              // in/out
 
-        }
+          }
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 0
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
 #endif
 
-      /* ASSEMBLY */
-      /* ======== */
+        /* ASSEMBLY */
+        /* ======== */
+
+        const cs_range_set_t  *rs =
+          connect->range_sets[CS_CDO_CONNECT_FACE_VP0];
 
-      const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_FACE_VP0];
+        /* Matrix assembly */
+        if (eqb->mfree != NULL)
+          cs_equation_mfree_store(csys, eqb->mfree);
+        else
+          cs_equation_assemble_block_matrix(csys, rs, 3, true, mav);
 
-      /* Matrix assembly */
-      cs_equation_assemble_block_matrix(csys, rs, 3, mav);
+        /* Assemble RHS */
+        for (short int i = 0; i < 3*cm->n_fc; i++) {
+          rhs[csys->dof_ids[i]] += csys->rhs[i];
+        }
 
-      /* Assemble RHS */
-      for (short int i = 0; i < 3*cm->n_fc; i++) {
-#       pragma omp atomic
-        rhs[csys->dof_ids[i]] += csys->rhs[i];
-      }
+      } /* Main loop on cells */
 
-    } /* Main loop on cells */
+    } /* Loop on colors */
 
   } /* OpenMP Block */
 
-  cs_matrix_assembler_values_done(mav);    /* optional */
+  if (eqb->mfree != NULL)
+    cs_equation_mfree_finalize(eqb->mfree);
+  else
+    cs_matrix_assembler_values_done(mav);    /* optional */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 2
   cs_dbg_darray_to_listing("FINAL RHS_FACE", quant->n_faces, rhs, 9);
@@ -924,7 +965,8 @@ cs_cdofb_vecteq_build_system(const cs_mesh_t            *mesh,
   /* Free temporary buffers and structures */
   BFT_FREE(dir_values);
   BFT_FREE(neu_tags);
-  cs_matrix_assembler_values_finalize(&mav);
+  if (mav != NULL)
+    cs_matrix_assembler_values_finalize(&mav);
 
   cs_timer_t  t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
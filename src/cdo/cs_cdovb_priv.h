@@ -92,6 +92,10 @@ struct _cs_cdovb_t {
   cs_param_hodge_t                 hdg_mass;
   cs_hodge_t                      *get_mass_matrix;
 
+  /* Cache of cellwise stiffness and mass matrices (NULL if not used) */
+  cs_hodge_cache_t                *stiffness_cache;
+  cs_hodge_cache_t                *mass_cache;
+
 };
 
 /*============================================================================
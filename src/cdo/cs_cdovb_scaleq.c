@@ -229,6 +229,39 @@ _init_cell_system(const cs_flag_t               cell_flag,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if the local stiffness matrices can be built by batches of
+ *          cells sharing the same type of element
+ *
+ * \param[in]      eqp         pointer to a cs_equation_param_t structure
+ * \param[in]      eqc         pointer to a cs_cdovb_scaleq_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_batched_stiffness(const cs_equation_param_t    *eqp,
+                   const cs_cdovb_scaleq_t      *eqc)
+{
+  if (eqp->build_mode != CS_PARAM_CDO_BUILD_BATCHED)
+    return false;
+  if (!cs_equation_param_has_diffusion(eqp))
+    return false;
+
+  /* Cached stiffness matrices are not rebuilt */
+  if (eqc->stiffness_cache != NULL)
+    return false;
+
+  const cs_param_hodge_t  h_info = eqp->diffusion_hodge;
+
+  if (h_info.algo != CS_PARAM_HODGE_ALGO_COST || h_info.inv_pty)
+    return false;
+
+  return (h_info.is_iso || h_info.is_unity);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -626,6 +659,23 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
   eqc->get_mass_matrix = cs_hodge_vpcd_wbs_get;
 
+  /* Cache of cellwise operators (only if requested) */
+  eqc->stiffness_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->stiffness_cache =
+      cs_equation_create_hodge_cache(eqp, eqp->diffusion_property,
+                                     connect->c2v, 0);
+
+  eqc->mass_cache = NULL;
+  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX)
+    eqc->mass_cache = cs_equation_create_hodge_cache(eqp, NULL,
+                                                     connect->c2v, 0);
+
+  /* Matrix-free operator (only if requested) */
+  eqb->mfree =
+    cs_equation_mfree_create(eqp, connect->c2v, 1,
+                             connect->range_sets[CS_CDO_CONNECT_VTX_SCAL]);
+
   /* Array used for extra-operations */
   eqc->cell_values = NULL;
 
@@ -654,6 +704,9 @@ cs_cdovb_scaleq_free_context(void   *builder)
   BFT_FREE(eqc->source_terms);
   BFT_FREE(eqc->cell_values);
 
+  eqc->stiffness_cache = cs_hodge_cache_free(eqc->stiffness_cache);
+  eqc->mass_cache = cs_hodge_cache_free(eqc->mass_cache);
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -685,13 +738,22 @@ cs_cdovb_scaleq_initialize_system(const cs_equation_param_t  *eqp,
 
   if (data == NULL)
     return;
-  assert(*system_matrix == NULL && *system_rhs == NULL);
+  assert(*system_rhs == NULL);
 
   cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)data;
   cs_timer_t  t0 = cs_timer_time();
 
-  /* Create the matrix related to the current algebraic system */
-  *system_matrix = cs_matrix_create(cs_shared_ms);
+  /* Create the matrix related to the current algebraic system (unless the
+     operator is frozen and the matrix of a previous time step is kept) */
+  if (eqb->matrix_is_frozen)
+    assert(*system_matrix != NULL);
+  else {
+    assert(*system_matrix == NULL);
+    if (eqb->mfree != NULL)
+      *system_matrix = cs_equation_mfree_create_matrix(eqb->mfree);
+    else
+      *system_matrix = cs_matrix_create(cs_shared_ms);
+  }
 
   /* Allocate and initialize the related right-hand side */
   BFT_MALLOC(*system_rhs, eqc->n_dofs, cs_real_t);
@@ -773,9 +835,11 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
 
   cs_timer_t  t0 = cs_timer_time();
 
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav =
-    cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  /* Initialize the structure to assemble values (no global matrix is
+     assembled with a matrix-free operator or with a frozen operator) */
+  cs_matrix_assembler_values_t  *mav = NULL;
+  if (eqb->mfree == NULL && !eqb->matrix_is_frozen)
+    mav = cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
   cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)data;
 
@@ -789,6 +853,9 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
   /* Tag faces with a non-homogeneous Neumann BC */
   short int  *neu_tags = cs_equation_tag_neumann_face(quant, eqp);
 
+  /* Local stiffness matrices computed by batches of cells ? */
+  const bool  batched = _batched_stiffness(eqp, eqc);
+
 #pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
   shared(dt_cur, quant, connect, eqp, eqb, eqc, rhs, matrix, mav,       \
          dir_values, neu_tags, field_val,                               \
@@ -803,7 +870,8 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
     /* Each thread get back its related structures:
        Get the cell-wise view of the mesh and the algebraic system */
     cs_face_mesh_t  *fm = cs_cdo_local_get_face_mesh(t_id);
-    cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_mesh_t  *cw_cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_batch_t  *cbatch = cs_cdo_local_get_cell_batch(t_id);
     cs_cell_sys_t  *csys = cs_cdovb_cell_sys[t_id];
     cs_cell_builder_t  *cb = cs_cdovb_cell_bld[t_id];
 
@@ -822,229 +890,295 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    /* Batches of cells sharing the same type of element are gathered by
+       colors. Cells of the same color share no vertex so that they are
+       assembled by several threads without critical section. */
+    for (int color = 0; color < connect->n_cell_colors; color++) {
 
-      const cs_flag_t  cell_flag = connect->cell_flag[c_id];
-      const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
+#     pragma omp for CS_CDO_OMP_SCHEDULE
+      for (cs_lnum_t b_id = connect->color_batch_idx[color];
+           b_id < connect->color_batch_idx[color+1]; b_id++) {
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+        const cs_lnum_t  s_id = connect->cell_batch_idx[b_id];
+        const cs_lnum_t  e_id = connect->cell_batch_idx[b_id+1];
+        bool  batched_stiffness = false;
+
+        if (batched) {
+
+          /* Set the local mesh structures for all the cells of the batch */
+          cs_cell_batch_build(b_id, eqb->msh_flag | eqb->st_msh_flag,
+                              eqb->bd_msh_flag, connect, quant, cbatch);
+
+          /* Polyhedra are not gathered: use the cellwise build */
+          if (cbatch->type != FVM_CELL_POLY) {
+
+            for (int l = 0; l < cbatch->n_cells; l++) {
+              if (eqb->diff_pty_uniform)
+                cbatch->pty_val[l] = cb->pty_val;
+              else
+                cbatch->pty_val[l] =
+                  cs_property_value_in_cell(cbatch->cm[l],
+                                            eqp->diffusion_property,
+                                            t_eval_pty);
+            }
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _init_cell_system(cell_flag, cm, eqp, eqb,
-                        dir_values, neu_tags, field_val, t_eval_pty, // in
-                        csys, cb);                                   // out
+            /* Local stiffness matrices stored in cbatch->loc */
+            cs_hodge_vb_cost_get_stiffness_batch(eqp->diffusion_hodge, cbatch);
+            batched_stiffness = true;
+
+          }
+
+        } /* Batched build */
+
+        for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+          const cs_lnum_t  c_id = connect->cell_batch_ids[i];
+          const cs_flag_t  cell_flag = connect->cell_flag[c_id];
+          const cs_flag_t  msh_flag =
+            cs_equation_cell_mesh_flag(cell_flag, eqb);
+
+          cs_cell_mesh_t  *cm = cw_cm;
+          if (batched)
+            cm = cbatch->cm[i - s_id];
+          else /* Set the local mesh structure for the current cell */
+            cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+
+          /* Set the local (i.e. cellwise) structures for the current cell */
+          _init_cell_system(cell_flag, cm, eqp, eqb,
+                            dir_values, neu_tags, field_val, t_eval_pty, // in
+                            csys, cb);                                   // out
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 2
-      if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
+          if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
 #endif
 
-      /* DIFFUSION TERM */
-      /* ============== */
+          /* DIFFUSION TERM */
+          /* ============== */
 
-      if (cs_equation_param_has_diffusion(eqp)) {
+          if (cs_equation_param_has_diffusion(eqp)) {
 
-        /* Define the local stiffness matrix */
-        if (!(eqb->diff_pty_uniform))
-          cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty, cell_flag,
-                                                cb);
+            /* Define the local stiffness matrix */
+            if (!(eqb->diff_pty_uniform))
+              cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty,
+                                                    cell_flag, cb);
 
-        /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+            if (batched_stiffness)  /* Already computed for the whole batch */
+              cs_sdm_add(csys->mat, cbatch->loc[i - s_id]);
+
+            else {
+
+              /* local matrix owned by the cellwise builder (in cb->loc) */
+              cs_hodge_cache_get(eqc->stiffness_cache,
+                                 eqc->get_stiffness_matrix,
+                                 eqp->diffusion_hodge, cm, cb, cb->loc);
 
-        /* Add the local diffusion operator to the local system */
-        cs_sdm_add(csys->mat, cb->loc);
+              /* Add the local diffusion operator to the local system */
+              cs_sdm_add(csys->mat, cb->loc);
+
+            }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
+            if (cs_dbg_cw_test(cm))
+              cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
 #endif
-      } /* END OF DIFFUSION */
+          } /* END OF DIFFUSION */
 
-      /* ADVECTION TERM */
-      /* ============== */
+          /* ADVECTION TERM */
+          /* ============== */
 
-      if (cs_equation_param_has_convection(eqp)) {
+          if (cs_equation_param_has_convection(eqp)) {
 
-        /* Define the local advection matrix */
-        eqc->get_advection_matrix(eqp, cm, t_eval_pty, fm, cb);
+            /* Define the local advection matrix */
+            eqc->get_advection_matrix(eqp, cm, t_eval_pty, fm, cb);
 
-        cs_sdm_add(csys->mat, cb->loc);
+            cs_sdm_add(csys->mat, cb->loc);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after advection", c_id, csys);
+            if (cs_dbg_cw_test(cm))
+              cs_cell_sys_dump("\n>> Local system after advection", c_id, csys);
 #endif
-      } /* END OF ADVECTION */
+          } /* END OF ADVECTION */
 
-      /* MASS MATRIX */
-      /* =========== */
+          /* MASS MATRIX */
+          /* =========== */
 
-      if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) {
-        eqc->get_mass_matrix(eqc->hdg_mass, cm, cb); /* stored in cb->hdg */
+          if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) {
+            cs_hodge_cache_get(eqc->mass_cache, eqc->get_mass_matrix,
+                               eqc->hdg_mass, cm, cb, cb->hdg);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-        if (cs_dbg_cw_test(cm)) {
-          cs_log_printf(CS_LOG_DEFAULT, ">> Local mass matrix");
-          cs_sdm_dump(c_id, csys->dof_ids, csys->dof_ids, cb->hdg);
-        }
+            if (cs_dbg_cw_test(cm)) {
+              cs_log_printf(CS_LOG_DEFAULT, ">> Local mass matrix");
+              cs_sdm_dump(c_id, csys->dof_ids, csys->dof_ids, cb->hdg);
+            }
 #endif
-      }
+          }
 
-      /* REACTION TERM */
-      /* ============= */
+          /* REACTION TERM */
+          /* ============= */
 
-      if (cs_equation_param_has_reaction(eqp)) {
+          if (cs_equation_param_has_reaction(eqp)) {
 
-        /* Define the local reaction property */
-        double  rpty_val = 0;
-        for (int r = 0; r < eqp->n_reaction_terms; r++)
-          if (eqb->reac_pty_uniform[r])
-            rpty_val += reac_pty_vals[r];
-          else
-            rpty_val += cs_property_value_in_cell(cm,
-                                                  eqp->reaction_properties[r],
-                                                  t_eval_pty);
+            /* Define the local reaction property */
+            double  rpty_val = 0;
+            for (int r = 0; r < eqp->n_reaction_terms; r++)
+              if (eqb->reac_pty_uniform[r])
+                rpty_val += reac_pty_vals[r];
+              else
+                rpty_val +=
+                  cs_property_value_in_cell(cm, eqp->reaction_properties[r],
+                                            t_eval_pty);
 
-        /* Update local system matrix with the reaction term
-           cb->hdg corresponds to the current mass matrix */
-        cs_sdm_add_mult(csys->mat, rpty_val, cb->hdg);
+            /* Update local system matrix with the reaction term
+               cb->hdg corresponds to the current mass matrix */
+            cs_sdm_add_mult(csys->mat, rpty_val, cb->hdg);
 
-      } /* END OF REACTION */
+          } /* END OF REACTION */
 
-      /* SOURCE TERM */
-      /* =========== */
+          /* SOURCE TERM */
+          /* =========== */
 
-      if (cs_equation_param_has_sourceterm(eqp)) {
+          if (cs_equation_param_has_sourceterm(eqp)) {
 
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+            /* Reset the local contribution */
+            memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (const cs_xdef_t **)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        t_eval_pty,
-                                        NULL,  /* No input structure */
-                                        cb,    /* mass matrix is cb->hdg */
-                                        csys->source);
+            /* Source term contribution to the algebraic system
+               If the equation is steady, the source term has already been
+               computed and is added to the right-hand side during its
+               initialization. */
+            cs_source_term_compute_cellwise(eqp->n_source_terms,
+                        (const cs_xdef_t **)eqp->source_terms,
+                                            cm,
+                                            eqb->source_mask,
+                                            eqb->compute_source,
+                                            t_eval_pty,
+                                            NULL,  /* No input structure */
+                                            cb,    /* mass matrix is cb->hdg */
+                                            csys->source);
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+            for (short int v = 0; v < cm->n_vc; v++)
+              csys->rhs[v] += csys->source[v];
 
-      } /* End of term source */
+          } /* End of term source */
 
-      /* UNSTEADY TERM + TIME SCHEME */
-      /* =========================== */
+          /* UNSTEADY TERM + TIME SCHEME */
+          /* =========================== */
 
-      if (cs_equation_param_has_time(eqp)) {
+          if (cs_equation_param_has_time(eqp)) {
 
-        /* Get the value of the time property */
-        double  tpty_val = 1/dt_cur;
-        if (eqb->time_pty_uniform)
-          tpty_val *= time_pty_val;
-        else
-          tpty_val *= cs_property_value_in_cell(cm,
-                                                eqp->time_property,
-                                                t_eval_pty);
+            /* Get the value of the time property */
+            double  tpty_val = 1/dt_cur;
+            if (eqb->time_pty_uniform)
+              tpty_val *= time_pty_val;
+            else
+              tpty_val *= cs_property_value_in_cell(cm,
+                                                    eqp->time_property,
+                                                    t_eval_pty);
 
-        cs_sdm_t  *mass_mat = cb->hdg;
-        if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) {
+            cs_sdm_t  *mass_mat = cb->hdg;
+            if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) {
 
-          assert(cs_flag_test(eqb->msh_flag, CS_CDO_LOCAL_PVQ));
-          /* Switch to cb->loc. Used as a diagonal only */
-          mass_mat = cb->loc;
+              assert(cs_flag_test(eqb->msh_flag, CS_CDO_LOCAL_PVQ));
+              /* Switch to cb->loc. Used as a diagonal only */
+              mass_mat = cb->loc;
 
-          /* |c|*wvc = |dual_cell(v) cap c| */
-          const double  ptyc = tpty_val * cm->vol_c;
-          for (short int v = 0; v < cm->n_vc; v++)
-            mass_mat->val[v] = ptyc * cm->wvc[v];
+              /* |c|*wvc = |dual_cell(v) cap c| */
+              const double  ptyc = tpty_val * cm->vol_c;
+              for (short int v = 0; v < cm->n_vc; v++)
+                mass_mat->val[v] = ptyc * cm->wvc[v];
 
-        }
+            }
 
-        /* Apply the time discretization to the local system.
-           Update csys (matrix and rhs) */
-        eqc->apply_time_scheme(eqp, tpty_val, mass_mat, eqb->sys_flag, cb,
-                               csys);
+            /* Apply the time discretization to the local system.
+               Update csys (matrix and rhs) */
+            eqc->apply_time_scheme(eqp, tpty_val, mass_mat, eqb->sys_flag, cb,
+                                   csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after time", c_id, csys);
+            if (cs_dbg_cw_test(cm))
+              cs_cell_sys_dump("\n>> Local system after time", c_id, csys);
 #endif
-      } /* END OF TIME CONTRIBUTION */
+          } /* END OF TIME CONTRIBUTION */
 
-      /* BOUNDARY CONDITIONS */
-      /* =================== */
+          /* BOUNDARY CONDITIONS */
+          /* =================== */
 
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+          if (cell_flag & CS_FLAG_BOUNDARY) {
 
-        /* Neumann boundary conditions */
-        if (csys->has_nhmg_neumann) {
-          for (short int v  = 0; v < cm->n_vc; v++)
-            csys->rhs[v] += csys->neu_values[v];
-        }
+            /* Neumann boundary conditions */
+            if (csys->has_nhmg_neumann) {
+              for (short int v  = 0; v < cm->n_vc; v++)
+                csys->rhs[v] += csys->neu_values[v];
+            }
 
-        /* Contribution for the advection term: csys is updated inside
-           (matrix and rhs) */
-        if (cs_equation_param_has_convection(eqp))
-          eqc->add_advection_bc(cm, eqp, t_eval_pty, fm, cb, csys);
+            /* Contribution for the advection term: csys is updated inside
+               (matrix and rhs) */
+            if (cs_equation_param_has_convection(eqp))
+              eqc->add_advection_bc(cm, eqp, t_eval_pty, fm, cb, csys);
 
-        /* The enforcement of the Dirichlet has to be done after all
-           other contributions */
-        if (csys->has_dirichlet) {
-          /* csys is updated inside (matrix and rhs) */
-          eqc->enforce_dirichlet(eqp->diffusion_hodge,
-                                 cm,
-                                 eqc->boundary_flux_op,
-                                 fm, cb, csys);
+            /* The enforcement of the Dirichlet has to be done after all
+               other contributions */
+            if (csys->has_dirichlet) {
+              /* csys is updated inside (matrix and rhs) */
+              eqc->enforce_dirichlet(eqp->diffusion_hodge,
+                                     cm,
+                                     eqc->boundary_flux_op,
+                                     fm, cb, csys);
 
-        }
+            }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after BC treatment", c_id, csys);
+            if (cs_dbg_cw_test(cm))
+              cs_cell_sys_dump("\n>> Local system after BC treatment",
+                               c_id, csys);
 #endif
-      } /* END OF BOUNDARY CONDITIONS */
+          } /* END OF BOUNDARY CONDITIONS */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
+          if (cs_dbg_cw_test(cm))
+            cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
 #endif
 
-      /* ASSEMBLY */
-      /* ======== */
+          /* ASSEMBLY */
+          /* ======== */
 
-      const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
+          const cs_range_set_t  *rs =
+            connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
 
-      /* Matrix assembly */
-      cs_equation_assemble_matrix(csys, rs, mav);
+          /* Matrix assembly (skipped if the matrix is frozen) */
+          if (eqb->mfree != NULL)
+            cs_equation_mfree_store(csys, eqb->mfree);
+          else if (mav != NULL)
+            cs_equation_assemble_matrix(csys, rs, true, mav);
 
-      /* Assemble RHS */
-      for (short int v = 0; v < cm->n_vc; v++)
-#       pragma omp atomic
-        rhs[cm->v_ids[v]] += csys->rhs[v];
+          /* Assemble RHS (no other thread deals with these vertices) */
+          for (short int v = 0; v < cm->n_vc; v++)
+            rhs[cm->v_ids[v]] += csys->rhs[v];
 
-      if (eqc->source_terms != NULL) {
-        for (short int v = 0; v < cm->n_vc; v++)
-#         pragma omp atomic
-          eqc->source_terms[cm->v_ids[v]] += csys->source[v];
-      }
+          if (eqc->source_terms != NULL) {
+            for (short int v = 0; v < cm->n_vc; v++)
+              eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+          }
 
-    } /* Main loop on cells */
+        } /* Loop on cells of the batch */
+
+      } /* Main loop on batches of cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
-  cs_matrix_assembler_values_done(mav); // optional
+  if (eqb->mfree != NULL)
+    cs_equation_mfree_finalize(eqb->mfree);
+  else if (mav != NULL) {
+    cs_matrix_assembler_values_done(mav); // optional
+    cs_matrix_assembler_values_finalize(&mav);
+  }
 
   /* Free temporary buffers and structures */
   BFT_FREE(dir_values);
   BFT_FREE(neu_tags);
-  cs_matrix_assembler_values_finalize(&mav);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 2
   if (eqc->source_terms != NULL)
@@ -1251,7 +1385,8 @@ cs_cdovb_scaleq_balance(const cs_equation_param_t     *eqp,
         p_cur[v] = pot->val[cm->v_ids[v]];
 
       if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX)
-        eqc->get_mass_matrix(eqc->hdg_mass, cm, cb); /* stored in cb->hdg */
+        cs_hodge_cache_get(eqc->mass_cache, eqc->get_mass_matrix,
+                           eqc->hdg_mass, cm, cb, cb->hdg);
 
       /* UNSTEADY TERM */
       if (cs_equation_param_has_time(eqp)) {
@@ -1359,7 +1494,8 @@ cs_cdovb_scaleq_balance(const cs_equation_param_t     *eqp,
                                                 cb);
 
         /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+        cs_hodge_cache_get(eqc->stiffness_cache, eqc->get_stiffness_matrix,
+                           eqp->diffusion_hodge, cm, cb, cb->loc);
 
         cs_real_t  *res = cb->values;
         for (short int v = 0; v < cm->n_vc; v++)
@@ -569,6 +569,15 @@ cs_cdovb_vecteq_init_context(const cs_equation_param_t   *eqp,
 
   eqc->get_mass_matrix = cs_hodge_vpcd_wbs_get;
 
+  /* Cache of cellwise operators (only if requested) */
+  eqc->stiffness_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->stiffness_cache =
+      cs_equation_create_hodge_cache(eqp, eqp->diffusion_property,
+                                     connect->c2v, 0);
+
+  eqc->mass_cache = NULL; /* Mass matrix is not used yet */
+
   /* Array used for extra-operations */
   eqc->cell_values = NULL;
 
@@ -596,6 +605,9 @@ cs_cdovb_vecteq_free_context(void   *builder)
   BFT_FREE(eqc->source_terms);
   BFT_FREE(eqc->cell_values);
 
+  eqc->stiffness_cache = cs_hodge_cache_free(eqc->stiffness_cache);
+  eqc->mass_cache = cs_hodge_cache_free(eqc->mass_cache);
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -767,124 +779,139 @@ cs_cdovb_vecteq_build_system(const cs_mesh_t            *mesh,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    /* Cells are gathered by colors. Cells of the same color share no vertex
+       so that they are assembled by several threads without conflict. */
+    for (int color = 0; color < connect->n_cell_colors; color++) {
+
+      const cs_lnum_t  s_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color]];
+      const cs_lnum_t  e_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color+1]];
+
+#     pragma omp for CS_CDO_OMP_SCHEDULE
+      for (cs_lnum_t c_idx = s_id; c_idx < e_id; c_idx++) {
+
+        const cs_lnum_t  c_id = connect->cell_batch_ids[c_idx];
 
-      const cs_flag_t  cell_flag = connect->cell_flag[c_id];
-      const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
+        const cs_flag_t  cell_flag = connect->cell_flag[c_id];
+        const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _init_cell_system(cell_flag, cm, eqp, eqb,
-                        dir_values, neu_tags, field_val, t_eval_pty, // in
-                        csys, cb);                                   // out
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        _init_cell_system(cell_flag, cm, eqp, eqb,
+                          dir_values, neu_tags, field_val, t_eval_pty, // in
+                          csys, cb);                                   // out
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_VECTEQ_DBG > 2
-      if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
+        if (cs_dbg_cw_test(cm)) cs_cell_mesh_dump(cm);
 #endif
 
-      /* DIFFUSION TERM */
-      /* ============== */
+        /* DIFFUSION TERM */
+        /* ============== */
 
-      if (cs_equation_param_has_diffusion(eqp)) {
+        if (cs_equation_param_has_diffusion(eqp)) {
 
-        /* Define the local stiffness matrix */
-        if (!(eqb->diff_pty_uniform))
-          cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty, cell_flag,
-                                                cb);
+          /* Define the local stiffness matrix */
+          if (!(eqb->diff_pty_uniform))
+            cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty,
+                                                  cell_flag, cb);
 
-        /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+          /* local matrix owned by the cellwise builder (store in cb->loc) */
+          cs_hodge_cache_get(eqc->stiffness_cache, eqc->get_stiffness_matrix,
+                             eqp->diffusion_hodge, cm, cb, cb->loc);
 
-        if (eqp->diffusion_hodge.is_iso == false)
-          bft_error(__FILE__, __LINE__, 0, " %s: Case not handle yet\n",
-                    __func__);
+          if (eqp->diffusion_hodge.is_iso == false)
+            bft_error(__FILE__, __LINE__, 0, " %s: Case not handle yet\n",
+                      __func__);
 
-        /* Add the local diffusion operator to the local system */
-        const cs_real_t  *sval = cb->loc->val;
-        for (int bi = 0; bi < cm->n_vc; bi++) {
-          for (int bj = 0; bj < cm->n_vc; bj++) {
+          /* Add the local diffusion operator to the local system */
+          const cs_real_t  *sval = cb->loc->val;
+          for (int bi = 0; bi < cm->n_vc; bi++) {
+            for (int bj = 0; bj < cm->n_vc; bj++) {
 
-            /* Retrieve the 3x3 matrix */
-            cs_sdm_t  *bij = cs_sdm_get_block(csys->mat, bi, bj);
-            assert(bij->n_rows == bij->n_cols && bij->n_rows == 3);
+              /* Retrieve the 3x3 matrix */
+              cs_sdm_t  *bij = cs_sdm_get_block(csys->mat, bi, bj);
+              assert(bij->n_rows == bij->n_cols && bij->n_rows == 3);
 
-            const cs_real_t  _val = sval[cm->n_vc*bi+bj];
-            bij->val[0] += _val;
-            bij->val[4] += _val;
-            bij->val[8] += _val;
+              const cs_real_t  _val = sval[cm->n_vc*bi+bj];
+              bij->val[0] += _val;
+              bij->val[4] += _val;
+              bij->val[8] += _val;
 
+            }
           }
-        }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_VECTEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Cell system after diffusion", c_id, csys);
+          if (cs_dbg_cw_test(cm))
+            cs_cell_sys_dump("\n>> Cell system after diffusion", c_id, csys);
 #endif
-      } /* END OF DIFFUSION */
+        } /* END OF DIFFUSION */
 
-      /* SOURCE TERM */
-      /* =========== */
+        /* SOURCE TERM */
+        /* =========== */
 
-      if (cs_equation_param_has_sourceterm(eqp)) {
+        if (cs_equation_param_has_sourceterm(eqp)) {
 
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+          /* Reset the local contribution */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (const cs_xdef_t **)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        t_eval_pty,
-                                        NULL,  /* No input structure */
-                                        cb,    /* mass matrix is cb->hdg */
-                                        csys->source);
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (const cs_xdef_t **)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          t_eval_pty,
+                                          NULL,  /* No input structure */
+                                          cb,    /* mass matrix is cb->hdg */
+                                          csys->source);
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
 
-      } /* End of term source */
+        } /* End of term source */
 
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM */
-      /* ======================================================= */
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM */
+        /* ======================================================= */
 
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+        if (cell_flag & CS_FLAG_BOUNDARY) {
 
-        if (csys->has_dirichlet)
-          /* Weakly enforced Dirichlet BCs for cells attached to the boundary
-             csys is updated inside (matrix and rhs) */
-          eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,   /* in */
-                                 eqc->boundary_flux_op,      /* function */
-                                 fm, cb, csys);              /* in/out */
+          if (csys->has_dirichlet)
+            /* Weakly enforced Dirichlet BCs for cells attached to the boundary
+               csys is updated inside (matrix and rhs) */
+            eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,   /* in */
+                                   eqc->boundary_flux_op,      /* function */
+                                   fm, cb, csys);              /* in/out */
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_VECTEQ_DBG > 0
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", c_id, csys);
 #endif
 
-      /* ASSEMBLY */
-      /* ======== */
+        /* ASSEMBLY */
+        /* ======== */
 
-      const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_VECT];
+        const cs_range_set_t  *rs =
+          connect->range_sets[CS_CDO_CONNECT_VTX_VECT];
 
-      /* Matrix assembly */
-      cs_equation_assemble_block_matrix(csys, rs, 3, mav);
+        /* Matrix assembly */
+        cs_equation_assemble_block_matrix(csys, rs, 3, true, mav);
 
-      /* Assemble RHS */
-      for (short int i = 0; i < 3*cm->n_vc; i++) {
-#       pragma omp atomic
-        rhs[csys->dof_ids[i]] += csys->rhs[i];
-      }
+        /* Assemble RHS */
+        for (short int i = 0; i < 3*cm->n_vc; i++) {
+          rhs[csys->dof_ids[i]] += csys->rhs[i];
+        }
+
+      } /* Main loop on cells */
 
-    } /* Main loop on cells */
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -141,6 +141,10 @@ struct _cs_cdovcb_scaleq_t {
   cs_param_hodge_t                 hdg_mass;
   cs_hodge_t                      *get_mass_matrix;
 
+  /* Cache of cellwise stiffness and mass matrices (NULL if not used) */
+  cs_hodge_cache_t                *stiffness_cache;
+  cs_hodge_cache_t                *mass_cache;
+
 };
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -631,6 +635,18 @@ cs_cdovcb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
   eqc->get_mass_matrix = cs_hodge_vcb_wbs_get;
 
+  /* Cache of cellwise operators (only if requested) */
+  eqc->stiffness_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->stiffness_cache =
+      cs_equation_create_hodge_cache(eqp, eqp->diffusion_property,
+                                     connect->c2v, 1);
+
+  eqc->mass_cache = NULL;
+  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX)
+    eqc->mass_cache = cs_equation_create_hodge_cache(eqp, NULL,
+                                                     connect->c2v, 1);
+
   return eqc;
 }
 
@@ -658,6 +674,9 @@ cs_cdovcb_scaleq_free_context(void   *data)
 
   BFT_FREE(eqc->source_terms);
 
+  eqc->stiffness_cache = cs_hodge_cache_free(eqc->stiffness_cache);
+  eqc->mass_cache = cs_hodge_cache_free(eqc->mass_cache);
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -826,244 +845,260 @@ cs_cdovcb_scaleq_build_system(const cs_mesh_t            *mesh,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
-
-      const cs_flag_t  cell_flag = connect->cell_flag[c_id];
-      const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
+    /* Cells are gathered by colors. Cells of the same color share no vertex
+       so that they are assembled by several threads without conflict. */
+    for (int color = 0; color < connect->n_cell_colors; color++) {
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
-
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _init_cell_system(cell_flag, cm, eqp, eqb, eqc,
-                        dir_values, neu_tags, field_val, t_eval_pty, // in
-                        csys, cb);                                   // out
-
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 2
-      if (cs_dbg_cw_test(cm))
-        cs_cell_mesh_dump(cm);
-#endif
+      const cs_lnum_t  s_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color]];
+      const cs_lnum_t  e_id =
+        connect->cell_batch_idx[connect->color_batch_idx[color+1]];
 
-      /* DIFFUSION TERM */
-      /* ============== */
+#     pragma omp for CS_CDO_OMP_SCHEDULE
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
 
-      if (cs_equation_param_has_diffusion(eqp)) {
+        const cs_lnum_t  c_id = connect->cell_batch_ids[i];
 
-        /* Define the local stiffness matrix */
-        if (!(eqb->diff_pty_uniform))
-          cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty, cell_flag,
-                                                cb);
+        const cs_flag_t  cell_flag = connect->cell_flag[c_id];
+        const cs_flag_t  msh_flag = cs_equation_cell_mesh_flag(cell_flag, eqb);
 
-        /* local matrix owned by the cellwise builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-        /* Add the local diffusion operator to the local system */
-        cs_sdm_add(csys->mat, cb->loc);
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        _init_cell_system(cell_flag, cm, eqp, eqb, eqc,
+                          dir_values, neu_tags, field_val, t_eval_pty, // in
+                          csys, cb);                                   // out
 
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 2
         if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
+          cs_cell_mesh_dump(cm);
 #endif
-      } /* END OF DIFFUSION */
 
-      /* ADVECTION TERM */
-      /* ============== */
+        /* DIFFUSION TERM */
+        /* ============== */
 
-      if (cs_equation_param_has_convection(eqp)) {
+        if (cs_equation_param_has_diffusion(eqp)) {
+
+          /* Define the local stiffness matrix */
+          if (!(eqb->diff_pty_uniform))
+            cs_equation_set_diffusion_property_cw(eqp, cm, t_eval_pty,
+                                                  cell_flag, cb);
 
-        /* Define the local advection matrix */
-        eqc->get_advection_matrix(eqp, cm, t_eval_pty, fm, cb);
+          /* local matrix owned by the cellwise builder (store in cb->loc) */
+          cs_hodge_cache_get(eqc->stiffness_cache, eqc->get_stiffness_matrix,
+                             eqp->diffusion_hodge, cm, cb, cb->loc);
 
-        cs_sdm_add(csys->mat, cb->loc);
+          /* Add the local diffusion operator to the local system */
+          cs_sdm_add(csys->mat, cb->loc);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
-        if (cs_dbg_cw_test(cm))
-          cs_cell_sys_dump("\n>> Local system after advection", c_id, csys);
+          if (cs_dbg_cw_test(cm))
+            cs_cell_sys_dump("\n>> Local system after diffusion", c_id, csys);
 #endif
-      } /* END OF ADVECTION */
-
-      if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX)
-        eqc->get_mass_matrix(eqc->hdg_mass, cm, cb); // stored in cb->hdg
-
-      /* REACTION TERM */
-      /* ============= */
-
-      if (cs_equation_param_has_reaction(eqp)) {
-
-        /* Define the local reaction property */
-        double  rpty_val = 0;
-        for (int r = 0; r < eqp->n_reaction_terms; r++)
-          if (eqb->reac_pty_uniform[r])
-            rpty_val += reac_pty_vals[r];
-          else
-            rpty_val += cs_property_get_cell_value(c_id, t_eval_pty,
-                                                   eqp->reaction_properties[r]);
-
-        /* Update local system matrix with the reaction term
-           cb->hdg corresponds to the current mass matrix */
-        cs_sdm_add_mult(csys->mat, rpty_val, cb->hdg);
+        } /* END OF DIFFUSION */
 
-      } /* END OF REACTION */
+        /* ADVECTION TERM */
+        /* ============== */
 
-      /* SOURCE TERM */
-      /* =========== */
+        if (cs_equation_param_has_convection(eqp)) {
 
-      if (cs_equation_param_has_sourceterm(eqp)) {
+          /* Define the local advection matrix */
+          eqc->get_advection_matrix(eqp, cm, t_eval_pty, fm, cb);
 
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+          cs_sdm_add(csys->mat, cb->loc);
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (const cs_xdef_t **)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        t_eval_pty,
-                                        NULL,  /* No data structure */
-                                        cb,    /* mass matrix is cb->hdg */
-                                        csys->source);
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
+          if (cs_dbg_cw_test(cm))
+            cs_cell_sys_dump("\n>> Local system after advection", c_id, csys);
+#endif
+        } /* END OF ADVECTION */
+
+        if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX)
+          cs_hodge_cache_get(eqc->mass_cache, eqc->get_mass_matrix,
+                             eqc->hdg_mass, cm, cb, cb->hdg);
+
+        /* REACTION TERM */
+        /* ============= */
+
+        if (cs_equation_param_has_reaction(eqp)) {
+
+          /* Define the local reaction property */
+          double  rpty_val = 0;
+          for (int r = 0; r < eqp->n_reaction_terms; r++)
+            if (eqb->reac_pty_uniform[r])
+              rpty_val += reac_pty_vals[r];
+            else
+              rpty_val +=
+                cs_property_get_cell_value(c_id, t_eval_pty,
+                                           eqp->reaction_properties[r]);
+
+          /* Update local system matrix with the reaction term
+             cb->hdg corresponds to the current mass matrix */
+          cs_sdm_add_mult(csys->mat, rpty_val, cb->hdg);
+
+        } /* END OF REACTION */
+
+        /* SOURCE TERM */
+        /* =========== */
+
+        if (cs_equation_param_has_sourceterm(eqp)) {
+
+          /* Reset the local contribution */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (const cs_xdef_t **)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          t_eval_pty,
+                                          NULL,  /* No data structure */
+                                          cb,    /* mass matrix is cb->hdg */
+                                          csys->source);
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
-        csys->rhs[cm->n_vc] += csys->source[cm->n_vc];
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
+          csys->rhs[cm->n_vc] += csys->source[cm->n_vc];
 
-      } /* End of term source */
+        } /* End of term source */
 
-      /* UNSTEADY TERM + TIME SCHEME */
-      /* =========================== */
+        /* UNSTEADY TERM + TIME SCHEME */
+        /* =========================== */
 
-      if (cs_equation_param_has_time(eqp)) {
+        if (cs_equation_param_has_time(eqp)) {
 
-        /* Get the value of the time property */
-        double  tpty_val = 1/dt_cur;
-        if (eqb->time_pty_uniform)
-          tpty_val *= time_pty_val;
-        else
-          tpty_val *= cs_property_get_cell_value(c_id, t_eval_pty,
-                                                 eqp->time_property);
+          /* Get the value of the time property */
+          double  tpty_val = 1/dt_cur;
+          if (eqb->time_pty_uniform)
+            tpty_val *= time_pty_val;
+          else
+            tpty_val *= cs_property_get_cell_value(c_id, t_eval_pty,
+                                                   eqp->time_property);
 
-        cs_sdm_t  *mass_mat = cb->hdg;
-        if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) {
+          cs_sdm_t  *mass_mat = cb->hdg;
+          if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) {
 
-          /* Switch to cb->loc. Define a diagonal matrix (seen as a vector) */
-          mass_mat = cb->loc;
+            /* Switch to cb->loc. Define a diagonal matrix (seen as a vector) */
+            mass_mat = cb->loc;
 
-          /* 0.75*|c|*wvc = 0.75*|dual_cell(v) cap c| for vertices
-             0.25*|c|*wvc = 0.75*|dual_cell(v) cap c| for the cell */
-          const double  ptyc = tpty_val * cm->vol_c;
-          for (short int v = 0; v < cm->n_vc; v++)
-            mass_mat->val[v] = 0.75 * ptyc * cm->wvc[v];
-          mass_mat->val[cm->n_vc] = 0.25 * ptyc;
+            /* 0.75*|c|*wvc = 0.75*|dual_cell(v) cap c| for vertices
+               0.25*|c|*wvc = 0.75*|dual_cell(v) cap c| for the cell */
+            const double  ptyc = tpty_val * cm->vol_c;
+            for (short int v = 0; v < cm->n_vc; v++)
+              mass_mat->val[v] = 0.75 * ptyc * cm->wvc[v];
+            mass_mat->val[cm->n_vc] = 0.25 * ptyc;
 
-        }
+          }
 
-        /* Apply the time discretization to the local system.
-           Update csys (matrix and rhs) */
-        eqc->apply_time_scheme(eqp, tpty_val, mass_mat, eqb->sys_flag, cb,
-                               csys);
+          /* Apply the time discretization to the local system.
+             Update csys (matrix and rhs) */
+          eqc->apply_time_scheme(eqp, tpty_val, mass_mat, eqb->sys_flag, cb,
+                                 csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix after time scheme",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix after time scheme",
+                           c_id, csys);
 #endif
-      } /* END OF TIME CONTRIBUTION */
+        } /* END OF TIME CONTRIBUTION */
+
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
+         * Operations that have to be performed BEFORE the static condensation
+         */
+        if (cell_flag & CS_FLAG_BOUNDARY) {
 
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
-       * Operations that have to be performed BEFORE the static condensation
-       */
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+          if (cs_equation_param_has_convection(eqp))
+            /* Apply boundary conditions related to the advection term
+               csys is updated inside (matrix and rhs) */
+            eqc->add_advection_bc(cm, eqp, t_eval_pty, fm, cb, csys);
 
-        if (cs_equation_param_has_convection(eqp))
-          /* Apply boundary conditions related to the advection term
+          /* Weakly enforced Dirichlet BCs for cells attached to the boundary
              csys is updated inside (matrix and rhs) */
-          eqc->add_advection_bc(cm, eqp, t_eval_pty, fm, cb, csys);
-
-        /* Weakly enforced Dirichlet BCs for cells attached to the boundary
-           csys is updated inside (matrix and rhs) */
-        if (eqp->enforcement == CS_PARAM_BC_ENFORCE_WEAK_NITSCHE ||
-            eqp->enforcement == CS_PARAM_BC_ENFORCE_WEAK_SYM)
-          eqc->enforce_dirichlet(eqp->diffusion_hodge, cm, /* in */
-                                 eqc->boundary_flux_op,    /* function */
-                                 fm, cb, csys);            /* in/out */
-
-        /* Neumann boundary conditions (Consistent for linear solutions) */
-        if (csys->has_nhmg_neumann) {
-          for (short int v  = 0; v < cm->n_vc; v++)
-            csys->rhs[v] += csys->neu_values[v];
-        }
+          if (eqp->enforcement == CS_PARAM_BC_ENFORCE_WEAK_NITSCHE ||
+              eqp->enforcement == CS_PARAM_BC_ENFORCE_WEAK_SYM)
+            eqc->enforce_dirichlet(eqp->diffusion_hodge, cm, /* in */
+                                   eqc->boundary_flux_op,    /* function */
+                                   fm, cb, csys);            /* in/out */
+
+          /* Neumann boundary conditions (Consistent for linear solutions) */
+          if (csys->has_nhmg_neumann) {
+            for (short int v  = 0; v < cm->n_vc; v++)
+              csys->rhs[v] += csys->neu_values[v];
+          }
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix before condensation",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix before condensation",
+                           c_id, csys);
 #endif
 
-      /* Static condensation of the local system matrix of size n_vc + 1 into
-         a matrix of size n_vc.
-         Store data in rc_tilda and acv_tilda to compute the values at cell
-         centers after solving the system */
-      cs_static_condensation_scalar_eq(connect->c2v,
-                                       eqc->rc_tilda,
-                                       eqc->acv_tilda,
-                                       cb, csys);
+        /* Static condensation of the local system matrix of size n_vc + 1 into
+           a matrix of size n_vc.
+           Store data in rc_tilda and acv_tilda to compute the values at cell
+           centers after solving the system */
+        cs_static_condensation_scalar_eq(connect->c2v,
+                                         eqc->rc_tilda,
+                                         eqc->acv_tilda,
+                                         cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> Local system matrix after condensation",
-                         c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> Local system matrix after condensation",
+                           c_id, csys);
 #endif
 
-      /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
-       * Operations that have to be performed AFTER the static condensation
-       */
-      if (cell_flag & CS_FLAG_BOUNDARY) {
+        /* BOUNDARY CONDITION CONTRIBUTION TO THE ALGEBRAIC SYSTEM
+         * Operations that have to be performed AFTER the static condensation
+         */
+        if (cell_flag & CS_FLAG_BOUNDARY) {
 
-        if (eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED ||
-            eqp->enforcement == CS_PARAM_BC_ENFORCE_ALGEBRAIC) {
+          if (eqp->enforcement == CS_PARAM_BC_ENFORCE_PENALIZED ||
+              eqp->enforcement == CS_PARAM_BC_ENFORCE_ALGEBRAIC) {
 
-          /* Weakly enforced Dirichlet BCs for cells attached to the boundary
-             csys is updated inside (matrix and rhs) */
-          eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,  /* in */
-                                 eqc->boundary_flux_op,     /* function */
-                                 fm, cb, csys);             /* in/out */
+            /* Weakly enforced Dirichlet BCs for cells attached to the boundary
+               csys is updated inside (matrix and rhs) */
+            eqc->enforce_dirichlet(eqp->diffusion_hodge, cm,  /* in */
+                                   eqc->boundary_flux_op,     /* function */
+                                   fm, cb, csys);             /* in/out */
 
-        } /* Enforcement of the Dirichlet BC */
+          } /* Enforcement of the Dirichlet BC */
 
-      } /* Boundary cell */
+        } /* Boundary cell */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVCB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(cm))
-        cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
+        if (cs_dbg_cw_test(cm))
+          cs_cell_sys_dump(">> (FINAL) Local system matrix", c_id, csys);
 #endif
 
-      /* ASSEMBLY */
-      /* ======== */
+        /* ASSEMBLY */
+        /* ======== */
 
-      const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
+        const cs_range_set_t  *rs =
+          connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
 
-      /* Matrix assembly */
-      cs_equation_assemble_matrix(csys, rs, mav);
-
-      /* Assemble RHS */
-      for (short int v = 0; v < cm->n_vc; v++)
-#       pragma omp atomic
-        rhs[cm->v_ids[v]] += csys->rhs[v];
+        /* Matrix assembly */
+        cs_equation_assemble_matrix(csys, rs, true, mav);
 
-      if (eqc->source_terms != NULL) { /* Assemble only the part related to
-                                          vertices */
+        /* Assemble RHS */
         for (short int v = 0; v < cm->n_vc; v++)
-#         pragma omp atomic
-          eqc->source_terms[cm->v_ids[v]] += csys->source[v];
-      }
+          rhs[cm->v_ids[v]] += csys->rhs[v];
+
+        if (eqc->source_terms != NULL) { /* Assemble only the part related to
+                                            vertices */
+          for (short int v = 0; v < cm->n_vc; v++)
+            eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+        }
+
+      } /* Main loop on cells */
 
-    } /* Main loop on cells */
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -501,6 +501,216 @@ _set_vect_hho_function_pointers(cs_equation_t  *eq)
   eq->get_face_values = cs_hho_vecteq_get_face_values;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the matrix kept from a previous time step (frozen operator)
+ *         and the setup of the related linear solver
+ *
+ * \param[in, out]  eq          pointer to a cs_equation_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_release_frozen_operator(cs_equation_t       *eq)
+{
+  cs_sles_t  *sles = cs_sles_find_or_add(eq->field_id, NULL);
+
+  cs_sles_free(sles);
+  cs_matrix_destroy(&(eq->matrix));
+
+  eq->builder->matrix_is_frozen = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve the linear system of an equation with a given matrix and a
+ *         given linear solver, then update the related field.
+ *         The matrix and the solver are not freed so that they can be used
+ *         by another equation sharing the same algebraic operator.
+ *
+ * \param[in]       sles        pointer to a cs_sles_t structure
+ * \param[in]       matrix      pointer to the matrix to use
+ * \param[in, out]  eq          pointer to a cs_equation_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_solve_system(cs_sles_t           *sles,
+              const cs_matrix_t   *matrix,
+              cs_equation_t       *eq)
+{
+  int  n_iters = 0;
+  double  residual = DBL_MAX;
+  cs_field_t  *fld = cs_field_by_id(eq->field_id);
+  cs_real_t  *x = NULL, *b = NULL;
+
+  if (eq->main_ts_id > -1)
+    cs_timer_stats_start(eq->main_ts_id);
+  if (eq->solve_ts_id > -1)
+    cs_timer_stats_start(eq->solve_ts_id);
+
+  const cs_equation_param_t  *eqp = eq->param;
+  const double  r_norm = 1.0; /* No renormalization by default (TODO) */
+  const cs_param_itsol_t  itsol_info = eqp->itsol_info;
+
+  /* Sanity checks (up to now, only scalar field are handled) */
+  assert(eq->n_sles_gather_elts <= eq->n_sles_scatter_elts);
+  assert(eq->n_sles_gather_elts == cs_matrix_get_n_rows(matrix));
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_EQUATION_DBG > 0
+  cs_log_printf(CS_LOG_DEFAULT,
+                " n_sles_gather_elts:  %d\n"
+                " n_sles_scatter_elts: %d\n"
+                " n_matrix_rows:       %d\n"
+                " n_matrix_columns:    %d\n",
+                eq->n_sles_gather_elts, eq->n_sles_scatter_elts,
+                cs_matrix_get_n_rows(matrix),
+                cs_matrix_get_n_columns(matrix));
+#endif
+
+  /* Handle parallelism */
+  eq->prepare_solving(eq, &x, &b);
+
+  cs_sles_convergence_state_t code = cs_sles_solve(sles,
+                                                   matrix,
+                                                   CS_HALO_ROTATION_IGNORE,
+                                                   itsol_info.eps,
+                                                   r_norm,
+                                                   &n_iters,
+                                                   &residual,
+                                                   b,
+                                                   x,
+                                                   0,      // aux. size
+                                                   NULL);  // aux. buffers
+
+  if (eq->param->sles_verbosity > 0 &&
+      cs_matrix_get_type(matrix) == CS_MATRIX_SHELL)
+    cs_log_printf(CS_LOG_DEFAULT, "  <%s/sles_cvg> code %-d n_iters %d"
+                  " residual % -8.4e (matrix-free)\n",
+                  eq->name, code, n_iters, residual);
+
+  else if (eq->param->sles_verbosity > 0) {
+
+    const cs_lnum_t  size = eq->n_sles_gather_elts;
+    const cs_lnum_t  *row_index, *col_id;
+    const cs_real_t  *d_val, *x_val;
+
+    cs_matrix_get_msr_arrays(matrix, &row_index, &col_id, &d_val, &x_val);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_EQUATION_DBG > 1
+    cs_dbg_dump_linear_system(eq->name, size, CS_EQUATION_DBG,
+                              x, b,
+                              row_index, col_id, x_val, d_val);
+#endif
+
+    cs_gnum_t  nnz = row_index[size];
+    if (cs_glob_n_ranks > 1) cs_parall_counter(&nnz, 1);
+    cs_log_printf(CS_LOG_DEFAULT, "  <%s/sles_cvg> code %-d n_iters %d"
+                  " residual % -8.4e nnz %lu\n",
+                  eq->name, code, n_iters, residual, nnz);
+
+  }
+
+  if (cs_glob_n_ranks > 1) { /* Parallel mode */
+
+    cs_range_set_scatter(eq->rset,
+                         CS_REAL_TYPE, 1, // type and stride
+                         x,
+                         x);
+
+    cs_range_set_scatter(eq->rset,
+                         CS_REAL_TYPE, 1, // type and stride
+                         b,
+                         eq->rhs);
+
+  }
+
+  if (eq->solve_ts_id > -1)
+    cs_timer_stats_stop(eq->solve_ts_id);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_EQUATION_DBG > 1
+  cs_dbg_array_fprintf(NULL, "sol.log", 1e-16, eq->n_sles_gather_elts, x, 6);
+  cs_dbg_array_fprintf(NULL, "rhs.log", 1e-16, eq->n_sles_gather_elts, b, 6);
+#endif
+
+  /* Copy current field values to previous values */
+  cs_field_current_to_previous(fld);
+
+  /* Define the new field value for the current time */
+  eq->update_field(x, eq->rhs, eq->param,
+                   eq->builder, eq->scheme_context, fld->val);
+
+  if (eq->main_ts_id > -1)
+    cs_timer_stats_stop(eq->main_ts_id);
+
+  /* Free memory */
+  BFT_FREE(x);
+  if (b != eq->rhs)
+    BFT_FREE(b);
+  BFT_FREE(eq->rhs);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if two equations lead to the same algebraic operator: same
+ *         DoF layout (hence the same shared matrix structure and range set),
+ *         same settings for the linear solver and same matrix coefficients.
+ *         The answer is the same on all ranks.
+ *
+ * \param[in]  ref     pointer to the reference cs_equation_t structure
+ * \param[in]  eq      pointer to the cs_equation_t structure to compare
+ *
+ * \return true if the system of ref can be used to solve the one of eq
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_same_operator(const cs_equation_t   *ref,
+               const cs_equation_t   *eq)
+{
+  const cs_param_itsol_t  ref_info = ref->param->itsol_info;
+  const cs_param_itsol_t  eq_info = eq->param->itsol_info;
+
+  /* Settings are shared by all ranks */
+  if (ref->rset != eq->rset ||
+      ref->param->space_scheme != eq->param->space_scheme ||
+      ref_info.solver != eq_info.solver ||
+      ref_info.precond != eq_info.precond ||
+      ref_info.n_max_iter != eq_info.n_max_iter ||
+      ref_info.resid_normalized != eq_info.resid_normalized ||
+      fabs(ref_info.eps - eq_info.eps) > 0)
+    return false;
+
+  if (cs_matrix_get_type(ref->matrix) != CS_MATRIX_MSR ||
+      cs_matrix_get_type(eq->matrix) != CS_MATRIX_MSR)
+    return false;
+
+  int  same = 1;
+
+  const cs_lnum_t  *ref_idx, *ref_ids, *eq_idx, *eq_ids;
+  const cs_real_t  *ref_d, *ref_x, *eq_d, *eq_x;
+
+  cs_matrix_get_msr_arrays(ref->matrix, &ref_idx, &ref_ids, &ref_d, &ref_x);
+  cs_matrix_get_msr_arrays(eq->matrix, &eq_idx, &eq_ids, &eq_d, &eq_x);
+
+  const cs_lnum_t  n_rows = cs_matrix_get_n_rows(ref->matrix);
+
+  /* The matrix structure is shared among equations with the same layout */
+  if (n_rows != cs_matrix_get_n_rows(eq->matrix) ||
+      ref_idx != eq_idx || ref_ids != eq_ids)
+    same = 0;
+  else if (memcmp(ref_d, eq_d, n_rows*sizeof(cs_real_t)) != 0 ||
+           memcmp(ref_x, eq_x, ref_idx[n_rows]*sizeof(cs_real_t)) != 0)
+    same = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &same, 1, MPI_INT, MPI_MIN, cs_glob_mpi_comm);
+#endif
+
+  return (same == 1) ? true : false;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1121,6 +1331,10 @@ cs_equation_destroy_all(void)
 
     eq->param = cs_equation_free_param(eq->param);
 
+    /* Matrix kept from the last time step (frozen operator) */
+    if (eq->matrix != NULL)
+      cs_matrix_destroy(&(eq->matrix));
+
     /* Sanity check */
     assert(eq->matrix == NULL && eq->rhs == NULL);
     /* Since eq->rset is only shared, no free is done at this stage */
@@ -1742,6 +1956,16 @@ cs_equation_initialize(const cs_mesh_t             *mesh,
 
   }  /* Loop on equations */
 
+  /* Cell meshes are requested by each equation at each build. Store them
+     once for all if the memory budget allows it. */
+  cs_flag_t  cm_flag = 0;
+  for (int i = 0; i < _n_equations; i++) {
+    const cs_equation_builder_t  *eqb = _equations[i]->builder;
+    if (eqb != NULL)
+      cm_flag |= eqb->msh_flag | eqb->bd_msh_flag | eqb->st_msh_flag;
+  }
+
+  cs_cell_mesh_store_define(cm_flag, connect, quant);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1769,8 +1993,29 @@ cs_equation_build_system(const cs_mesh_t            *mesh,
   if (eq->main_ts_id > -1)
     cs_timer_stats_start(eq->main_ts_id);
 
+  cs_equation_builder_t  *eqb = eq->builder;
+
   /* Sanity checks */
-  assert(eq->matrix == NULL && eq->rhs == NULL);
+  assert(eq->rhs == NULL);
+
+  /* With a frozen operator, the matrix built at a previous time step is kept
+     as long as the time step does not change. Only the rhs is then built */
+  if (eqb->frozen_operator) {
+
+    const bool  dt_changed = (fabs(dt_cur - eqb->frozen_dt) > 0);
+
+    eqb->matrix_is_frozen = (eq->matrix != NULL && !dt_changed);
+    if (eq->matrix != NULL && !eqb->matrix_is_frozen)
+      _release_frozen_operator(eq);
+    eqb->frozen_dt = dt_cur;
+
+    if (eqb->matrix_is_frozen && eq->param->sles_verbosity > 0)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    "  <%s/sles> Frozen operator. Build only the rhs\n",
+                    eq->name);
+
+  }
+  assert(eqb->matrix_is_frozen || eq->matrix == NULL);
 
   /* Initialize the algebraic system to build */
   eq->initialize_system(eq->param,
@@ -1802,112 +2047,92 @@ cs_equation_build_system(const cs_mesh_t            *mesh,
 void
 cs_equation_solve(cs_equation_t   *eq)
 {
-  int  n_iters = 0;
-  double  residual = DBL_MAX;
   cs_sles_t  *sles = cs_sles_find_or_add(eq->field_id, NULL);
-  cs_field_t  *fld = cs_field_by_id(eq->field_id);
-  cs_real_t  *x = NULL, *b = NULL;
 
-  if (eq->main_ts_id > -1)
-    cs_timer_stats_start(eq->main_ts_id);
-  if (eq->solve_ts_id > -1)
-    cs_timer_stats_start(eq->solve_ts_id);
-
-  const cs_equation_param_t  *eqp = eq->param;
-  const double  r_norm = 1.0; /* No renormalization by default (TODO) */
-  const cs_param_itsol_t  itsol_info = eqp->itsol_info;
-
-  /* Sanity checks (up to now, only scalar field are handled) */
-  assert(eq->n_sles_gather_elts <= eq->n_sles_scatter_elts);
-  assert(eq->n_sles_gather_elts == cs_matrix_get_n_rows(eq->matrix));
-
-#if defined(DEBUG) && !defined(NDEBUG) && CS_EQUATION_DBG > 0
-  cs_log_printf(CS_LOG_DEFAULT,
-                " n_sles_gather_elts:  %d\n"
-                " n_sles_scatter_elts: %d\n"
-                " n_matrix_rows:       %d\n"
-                " n_matrix_columns:    %d\n",
-                eq->n_sles_gather_elts, eq->n_sles_scatter_elts,
-                cs_matrix_get_n_rows(eq->matrix),
-                cs_matrix_get_n_columns(eq->matrix));
-#endif
+  _solve_system(sles, eq->matrix, eq);
 
-  /* Handle parallelism */
-  eq->prepare_solving(eq, &x, &b);
+  /* A frozen operator and the setup of its linear solver are kept for the
+     next time step */
+  if (eq->builder != NULL && eq->builder->frozen_operator)
+    return;
 
-  cs_sles_convergence_state_t code = cs_sles_solve(sles,
-                                                   eq->matrix,
-                                                   CS_HALO_ROTATION_IGNORE,
-                                                   itsol_info.eps,
-                                                   r_norm,
-                                                   &n_iters,
-                                                   &residual,
-                                                   b,
-                                                   x,
-                                                   0,      // aux. size
-                                                   NULL);  // aux. buffers
+  cs_sles_free(sles);
+  cs_matrix_destroy(&(eq->matrix));
+}
 
-  if (eq->param->sles_verbosity > 0) {
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and solve one after the other the linear systems of a set of
+ *         equations. Equations are expected to share the same DoF layout
+ *         (for instance, tracers). The matrix structure, the matrix assembler
+ *         and the range set are already shared among such equations; when
+ *         the matrix of an equation is moreover identical to the one of the
+ *         previous equation, the linear solver set up for the latter (e.g.
+ *         the multigrid hierarchy or the preconditioner) is reused and only
+ *         the right-hand side differs.
+ *         At most two matrices are allocated at the same time.
+ *
+ * \param[in]       mesh        pointer to a cs_mesh_t structure
+ * \param[in]       time_step   pointer to a time step structure
+ * \param[in]       dt_cur      value of the current time step
+ * \param[in]       n_eqs       number of equations
+ * \param[in, out]  eqs         array of pointers to cs_equation_t structures
+ */
+/*----------------------------------------------------------------------------*/
 
-    const cs_lnum_t  size = eq->n_sles_gather_elts;
-    const cs_lnum_t  *row_index, *col_id;
-    const cs_real_t  *d_val, *x_val;
+void
+cs_equation_build_and_solve_sequence(const cs_mesh_t            *mesh,
+                                     const cs_time_step_t       *time_step,
+                                     double                      dt_cur,
+                                     int                         n_eqs,
+                                     cs_equation_t              *eqs[])
+{
+  cs_equation_t  *ref = NULL;   /* Equation owning the kept matrix */
+  cs_sles_t  *ref_sles = NULL;  /* Linear solver set up with this matrix */
 
-    cs_matrix_get_msr_arrays(eq->matrix, &row_index, &col_id, &d_val, &x_val);
+  for (int i = 0; i < n_eqs; i++) {
 
-#if defined(DEBUG) && !defined(NDEBUG) && CS_EQUATION_DBG > 1
-    cs_dbg_dump_linear_system(eq->name, size, CS_EQUATION_DBG,
-                              x, b,
-                              row_index, col_id, x_val, d_val);
-#endif
+    cs_equation_t  *eq = eqs[i];
 
-    cs_gnum_t  nnz = row_index[size];
-    if (cs_glob_n_ranks > 1) cs_parall_counter(&nnz, 1);
-    cs_log_printf(CS_LOG_DEFAULT, "  <%s/sles_cvg> code %-d n_iters %d"
-                  " residual % -8.4e nnz %lu\n",
-                  eq->name, code, n_iters, residual, nnz);
+    cs_equation_build_system(mesh, time_step, dt_cur, eq);
 
-  }
+    /* A frozen operator is owned by its equation along time steps */
+    if (eq->builder->frozen_operator) {
+      cs_equation_solve(eq);
+      continue;
+    }
 
-  if (cs_glob_n_ranks > 1) { /* Parallel mode */
+    if (ref != NULL && _same_operator(ref, eq)) {
 
-    cs_range_set_scatter(eq->rset,
-                         CS_REAL_TYPE, 1, // type and stride
-                         x,
-                         x);
+      if (eq->param->sles_verbosity > 0)
+        cs_log_printf(CS_LOG_DEFAULT,
+                      "  <%s/sles> Reuse the operator of \"%s\"\n",
+                      eq->name, ref->name);
 
-    cs_range_set_scatter(eq->rset,
-                         CS_REAL_TYPE, 1, // type and stride
-                         b,
-                         eq->rhs);
+      _solve_system(ref_sles, ref->matrix, eq);
+      cs_matrix_destroy(&(eq->matrix));
 
-  }
+    }
+    else {
 
-  if (eq->solve_ts_id > -1)
-    cs_timer_stats_stop(eq->solve_ts_id);
+      if (ref != NULL) {
+        cs_sles_free(ref_sles);
+        cs_matrix_destroy(&(ref->matrix));
+      }
 
-#if defined(DEBUG) && !defined(NDEBUG) && CS_EQUATION_DBG > 1
-  cs_dbg_array_fprintf(NULL, "sol.log", 1e-16, eq->n_sles_gather_elts, x, 6);
-  cs_dbg_array_fprintf(NULL, "rhs.log", 1e-16, eq->n_sles_gather_elts, b, 6);
-#endif
+      ref = eq;
+      ref_sles = cs_sles_find_or_add(eq->field_id, NULL);
 
-  /* Copy current field values to previous values */
-  cs_field_current_to_previous(fld);
+      _solve_system(ref_sles, ref->matrix, eq);
 
-  /* Define the new field value for the current time */
-  eq->update_field(x, eq->rhs, eq->param,
-                   eq->builder, eq->scheme_context, fld->val);
+    }
 
-  if (eq->main_ts_id > -1)
-    cs_timer_stats_stop(eq->main_ts_id);
+  } /* Loop on equations */
 
-  /* Free memory */
-  BFT_FREE(x);
-  if (b != eq->rhs)
-    BFT_FREE(b);
-  BFT_FREE(eq->rhs);
-  cs_sles_free(sles);
-  cs_matrix_destroy(&(eq->matrix));
+  if (ref != NULL) {
+    cs_sles_free(ref_sles);
+    cs_matrix_destroy(&(ref->matrix));
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -381,6 +381,33 @@ cs_equation_build_system(const cs_mesh_t            *mesh,
 void
 cs_equation_solve(cs_equation_t   *eq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and solve one after the other the linear systems of a set of
+ *         equations. Equations are expected to share the same DoF layout
+ *         (for instance, tracers). The matrix structure, the matrix assembler
+ *         and the range set are already shared among such equations; when
+ *         the matrix of an equation is moreover identical to the one of the
+ *         previous equation, the linear solver set up for the latter (e.g.
+ *         the multigrid hierarchy or the preconditioner) is reused and only
+ *         the right-hand side differs.
+ *         At most two matrices are allocated at the same time.
+ *
+ * \param[in]       mesh        pointer to a cs_mesh_t structure
+ * \param[in]       time_step   pointer to a time step structure
+ * \param[in]       dt_cur      value of the current time step
+ * \param[in]       n_eqs       number of equations
+ * \param[in, out]  eqs         array of pointers to cs_equation_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_build_and_solve_sequence(const cs_mesh_t            *mesh,
+                                     const cs_time_step_t       *time_step,
+                                     double                      dt_cur,
+                                     int                         n_eqs,
+                                     cs_equation_t              *eqs[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return a pointer to the cs_property_t structure associated to the
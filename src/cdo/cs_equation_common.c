@@ -40,6 +40,7 @@
 
 #include <bft_mem.h>
 
+#include "cs_base.h"
 #include "cs_boundary_zone.h"
 #include "cs_cdo_local.h"
 #include "cs_cdovb_scaleq.h"
@@ -52,6 +53,7 @@
 #include "cs_hho_vecteq.h"
 #include "cs_log.h"
 #include "cs_math.h"
+#include "cs_parall.h"
 #include "cs_xdef_eval.h"
 
 /*----------------------------------------------------------------------------*/
@@ -74,6 +76,35 @@ BEGIN_C_DECLS
 
 #define CS_EQUATION_COMMON_DBG  0
 
+/* Matrix-free representation of the operator related to an equation.
+   The final cellwise systems are stored (dense storage) and applied cell by
+   cell to perform a matrix-vector product. This avoids the assembly step but
+   a cell with n DoFs requires n*n values, which is in general more than the
+   memory footprint of the assembled matrix (64 values by hexahedron for
+   CDO-Vb schemes, 324 for vector-valued CDO-Fb schemes) */
+
+struct _cs_equation_mfree_t {
+
+  cs_lnum_t    n_cells;      /* number of cells */
+  cs_lnum_t    n_elts;       /* number of DoFs on the local rank */
+  cs_lnum_t    n_rows;       /* number of DoFs owned by the local rank */
+  int          stride;       /* number of DoFs by entity */
+
+  const cs_range_set_t  *rs; /* range set related to the DoFs (shared) */
+
+  cs_lnum_t   *idx;          /* shift to the DoF ids of each cell
+                                (size: n_cells + 1) */
+  cs_lnum_t   *val_idx;      /* shift to the cellwise matrix of each cell
+                                (size: n_cells + 1) */
+  cs_lnum_t   *dof_ids;      /* DoF ids of each cell */
+  double      *val;          /* packed cellwise matrices */
+
+  cs_real_t   *diag;         /* diagonal of the operator (size: n_elts) */
+  cs_real_t   *x_full;       /* work buffer (size: n_elts) */
+  cs_real_t   *y_full;       /* work buffer (size: n_elts) */
+
+};
+
 /*============================================================================
  * Local private variables
  *============================================================================*/
@@ -110,6 +141,38 @@ static cs_timer_counter_t  tcc; // connectivity building
  * Private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add a buffer of values to the global matrix. A critical section is
+ *         used unless the caller ensures that no other thread may update the
+ *         same rows at the same time.
+ *
+ * \param[in, out] mav            pointer to a matrix assembler structure
+ * \param[in]      conflict_free  true if no critical section is needed
+ * \param[in]      n              number of values to add
+ * \param[in]      r_gids         global row ids
+ * \param[in]      c_gids         global column ids
+ * \param[in]      values         values to add
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_assemble_buffer(cs_matrix_assembler_values_t   *mav,
+                 bool                            conflict_free,
+                 int                             n,
+                 const cs_gnum_t                 r_gids[],
+                 const cs_gnum_t                 c_gids[],
+                 const cs_real_t                 values[])
+{
+  if (conflict_free)
+    cs_matrix_assembler_values_add_g(mav, n, r_gids, c_gids, values);
+
+  else {
+#   pragma omp critical
+    cs_matrix_assembler_values_add_g(mav, n, r_gids, c_gids, values);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build a vertex -> vertices connectivity index
@@ -207,6 +270,52 @@ _get_f2f(const cs_cdo_connect_t     *connect)
   return f2f;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the global matrix of an equation can be kept from one time
+ *         step to another (frozen operator). This is only possible for an
+ *         unsteady equation relying on steady properties and on a steady
+ *         advection field, and for schemes which handle this mode.
+ *
+ * \param[in]  eqp       pointer to a cs_equation_param_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_operator_can_be_frozen(const cs_equation_param_t   *eqp)
+{
+  if (!eqp->frozen_operator || eqp->matrix_free || eqp->dim > 1)
+    return false;
+
+  if (eqp->space_scheme != CS_SPACE_SCHEME_CDOVB &&
+      eqp->space_scheme != CS_SPACE_SCHEME_CDOFB)
+    return false;
+
+  /* A steady equation is solved only once */
+  if (!cs_equation_param_has_time(eqp))
+    return false;
+
+  if (eqp->time_property != NULL)
+    if (!cs_property_is_steady(eqp->time_property))
+      return false;
+
+  if (cs_equation_param_has_diffusion(eqp))
+    if (!cs_property_is_steady(eqp->diffusion_property))
+      return false;
+
+  for (int i = 0; i < eqp->n_reaction_terms; i++)
+    if (!cs_property_is_steady(eqp->reaction_properties[i]))
+      return false;
+
+  if (cs_equation_param_has_convection(eqp))
+    if (!(eqp->adv_field->flag & CS_ADVECTION_FIELD_STEADY))
+      return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate and define a cs_matrix_assembler_t structure
@@ -316,6 +425,79 @@ _build_matrix_assembler(cs_lnum_t                n_elts,
   return ma;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute y = A.x where A is the operator stored in a matrix-free
+ *         way. x and y are defined on the DoFs owned by the local rank.
+ *         This function complies with cs_matrix_shell_product_t
+ *
+ * \param[in]      input    pointer to a cs_equation_mfree_t structure
+ * \param[in]      x        values of the vector to multiply
+ * \param[in, out] y        resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_mfree_product(const void        *input,
+               const cs_real_t   *x,
+               cs_real_t         *y)
+{
+  const cs_equation_mfree_t  *mf = (const cs_equation_mfree_t *)input;
+  const cs_lnum_t  n_elts = mf->n_elts;
+
+  const cs_real_t  *x_full = x;
+  cs_real_t  *y_full = mf->y_full;
+
+  /* Retrieve a view of x on all the DoFs of the local rank (the work buffer
+     owned by mf is only used in parallel) */
+  if (cs_glob_n_ranks > 1) {
+    cs_range_set_scatter(mf->rs, CS_REAL_TYPE, 1, x, mf->x_full);
+    x_full = mf->x_full;
+  }
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    y_full[i] = 0.;
+
+  /* Apply each cellwise operator and add the result */
+# pragma omp parallel for if (mf->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < mf->n_cells; c_id++) {
+
+    const cs_lnum_t  *ids = mf->dof_ids + mf->idx[c_id];
+    const double  *m = mf->val + mf->val_idx[c_id];
+    const int  n = mf->idx[c_id+1] - mf->idx[c_id];
+
+    for (int i = 0; i < n; i++) {
+
+      const double  *mi = m + i*n;
+
+      double  yi = 0.;
+      for (int j = 0; j < n; j++)
+        yi += mi[j] * x_full[ids[j]];
+
+#     pragma omp atomic
+      y_full[ids[i]] += yi;
+
+    }
+
+  } /* Loop on cells */
+
+  /* Sum contributions of distant ranks and switch to the owned DoFs */
+  if (cs_glob_n_ranks > 1) {
+
+    cs_interface_set_sum(mf->rs->ifs, n_elts, 1, false, CS_REAL_TYPE, y_full);
+    cs_range_set_gather(mf->rs, CS_REAL_TYPE, 1, y_full, y);
+
+  }
+  else {
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      y[i] = y_full[i];
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -788,6 +970,24 @@ cs_equation_init_builder(const cs_equation_param_t   *eqp,
                                   eqp->bc_defs,
                                   mesh->n_b_faces);
 
+  /* Matrix-free operator (if requested) is defined by each scheme */
+  eqb->mfree = NULL;
+
+  /* Frozen operator (if requested and possible) */
+  eqb->frozen_operator = _operator_can_be_frozen(eqp);
+  eqb->matrix_is_frozen = false;
+  eqb->frozen_dt = -1;
+
+  if (eqp->frozen_operator && !eqb->frozen_operator) {
+    cs_base_warn(__FILE__, __LINE__);
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _(" The operator of an equation can not be frozen.\n"
+                    " Only unsteady scalar-valued CDO vertex-based and"
+                    " face-based schemes\n with steady properties and a"
+                    " steady advection field are handled.\n"
+                    " The global matrix is built at each time step.\n"));
+  }
+
   /* Monitoring */
   CS_TIMER_COUNTER_INIT(eqb->tcb); // build system
   CS_TIMER_COUNTER_INIT(eqb->tcd); // build diffusion terms
@@ -824,6 +1024,8 @@ cs_equation_free_builder(cs_equation_builder_t  **p_builder)
   /* Free BC structure */
   eqb->face_bc = cs_cdo_bc_free(eqb->face_bc);
 
+  cs_equation_mfree_free(&(eqb->mfree));
+
   BFT_FREE(eqb);
 
   *p_builder = NULL;
@@ -952,6 +1154,40 @@ cs_equation_init_properties(const cs_equation_param_t     *eqp,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cache of cellwise operators (stiffness or mass matrix) if
+ *         this is requested in the settings of the equation and if the
+ *         property used to build these operators is steady
+ *
+ * \param[in]  eqp           pointer to a cs_equation_param_t structure
+ * \param[in]  pty           pointer to the related property (NULL if unity)
+ * \param[in]  c2x           pointer to a cell --> entities adjacency
+ * \param[in]  n_cell_dofs   number of additional DoFs attached to each cell
+ *
+ * \return a pointer to a new allocated cs_hodge_cache_t structure or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_equation_create_hodge_cache(const cs_equation_param_t     *eqp,
+                               const cs_property_t           *pty,
+                               const cs_adjacency_t          *c2x,
+                               int                            n_cell_dofs)
+{
+  if (eqp->hodge_cache == CS_PARAM_HODGE_CACHE_NONE)
+    return NULL;
+
+  /* Mesh is not modified during the computation in the CDO framework.
+     A property which is not steady would require to rebuild operators */
+  if (pty != NULL && !cs_property_is_steady(pty))
+    return NULL;
+
+  bool  use_float = (eqp->hodge_cache == CS_PARAM_HODGE_CACHE_FLOAT);
+
+  return cs_hodge_cache_create(c2x, n_cell_dofs, use_float);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the diffusion property inside a cell and its related quantities
@@ -1036,14 +1272,17 @@ cs_equation_set_diffusion_property_cw(const cs_equation_param_t     *eqp,
  * \brief  Assemble a cellwise system into the global algebraic system
  *
  * \param[in]      csys         cellwise view of the algebraic system
- * \param[in]      rset         pointer to a cs_range_set_t structure
- * \param[in, out] mav          pointer to a matrix assembler structure
+ * \param[in]      rset           pointer to a cs_range_set_t structure
+ * \param[in]      conflict_free  true if no other thread may assemble the same
+ *                                rows at the same time (colored cells)
+ * \param[in, out] mav            pointer to a matrix assembler structure
  */
 /*----------------------------------------------------------------------------*/
 
 void
 cs_equation_assemble_matrix(const cs_cell_sys_t            *csys,
                             const cs_range_set_t           *rset,
+                            bool                            conflict_free,
                             cs_matrix_assembler_values_t   *mav)
 {
   const cs_lnum_t  *dof_ids = csys->dof_ids;
@@ -1075,8 +1314,7 @@ cs_equation_assemble_matrix(const cs_cell_sys_t            *csys,
       bufsize += 1;
 
       if (bufsize == CS_CDO_ASSEMBLE_BUF_SIZE) {
-#       pragma omp critical
-        cs_matrix_assembler_values_add_g(mav,bufsize, r_gids, c_gids, values);
+        _assemble_buffer(mav, conflict_free, bufsize, r_gids, c_gids, values);
         bufsize = 0;
       }
 
@@ -1085,8 +1323,7 @@ cs_equation_assemble_matrix(const cs_cell_sys_t            *csys,
   } /* Loop on rows */
 
   if (bufsize > 0) {
-#   pragma omp critical
-    cs_matrix_assembler_values_add_g(mav, bufsize, r_gids, c_gids, values);
+    _assemble_buffer(mav, conflict_free, bufsize, r_gids, c_gids, values);
     bufsize = 0;
   }
 
@@ -1098,9 +1335,11 @@ cs_equation_assemble_matrix(const cs_cell_sys_t            *csys,
  *         algebraic system
  *
  * \param[in]      csys         cellwise view of the algebraic system
- * \param[in]      rset         pointer to a cs_range_set_t structure
- * \param[in]      n_x_dofs     number of DoFs per entity (= size of the block)
- * \param[in, out] mav          pointer to a matrix assembler structure
+ * \param[in]      rset           pointer to a cs_range_set_t structure
+ * \param[in]      n_x_dofs       number of DoFs per entity (= size of the block)
+ * \param[in]      conflict_free  true if no other thread may assemble the same
+ *                                rows at the same time (colored cells)
+ * \param[in, out] mav            pointer to a matrix assembler structure
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1108,6 +1347,7 @@ void
 cs_equation_assemble_block_matrix(const cs_cell_sys_t            *csys,
                                   const cs_range_set_t           *rset,
                                   int                             n_x_dofs,
+                                  bool                            conflict_free,
                                   cs_matrix_assembler_values_t   *mav)
 {
   const cs_lnum_t  *dof_ids = csys->dof_ids;
@@ -1154,9 +1394,8 @@ cs_equation_assemble_block_matrix(const cs_cell_sys_t            *csys,
           bufsize += 1;
 
           if (bufsize == CS_CDO_ASSEMBLE_BUF_SIZE) {
-#           pragma omp critical
-            cs_matrix_assembler_values_add_g(mav, bufsize,
-                                             r_gids, c_gids, values);
+            _assemble_buffer(mav, conflict_free, bufsize,
+                             r_gids, c_gids, values);
             bufsize = 0;
           }
 
@@ -1167,13 +1406,228 @@ cs_equation_assemble_block_matrix(const cs_cell_sys_t            *csys,
   } /* Loop on row blocks */
 
   if (bufsize > 0) {
-#   pragma omp critical
-    cs_matrix_assembler_values_add_g(mav, bufsize, r_gids, c_gids, values);
+    _assemble_buffer(mav, conflict_free, bufsize, r_gids, c_gids, values);
     bufsize = 0;
   }
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cs_equation_mfree_t structure storing the cellwise systems
+ *         of an equation in order to apply its operator without assembling
+ *         a global matrix. Return NULL if this is not requested.
+ *
+ * \param[in]  eqp       pointer to a cs_equation_param_t structure
+ * \param[in]  c2x       pointer to the cell --> entities adjacency
+ * \param[in]  stride    number of DoFs by entity
+ * \param[in]  rs        pointer to the related cs_range_set_t structure
+ *
+ * \return a pointer to a new allocated cs_equation_mfree_t structure or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_equation_mfree_t *
+cs_equation_mfree_create(const cs_equation_param_t     *eqp,
+                         const cs_adjacency_t          *c2x,
+                         int                            stride,
+                         const cs_range_set_t          *rs)
+{
+  if (!eqp->matrix_free)
+    return NULL;
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cs_equation_mfree_t  *mf = NULL;
+
+  BFT_MALLOC(mf, 1, cs_equation_mfree_t);
+
+  mf->n_cells = n_cells;
+  mf->n_elts = rs->n_elts[1];
+  mf->n_rows = rs->n_elts[0];
+  mf->stride = stride;
+  mf->rs = rs;
+
+  BFT_MALLOC(mf->idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(mf->val_idx, n_cells + 1, cs_lnum_t);
+
+  mf->idx[0] = mf->val_idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n = stride*(c2x->idx[c_id+1] - c2x->idx[c_id]);
+    mf->idx[c_id+1] = mf->idx[c_id] + n;
+    mf->val_idx[c_id+1] = mf->val_idx[c_id] + n*n;
+  }
+
+  BFT_MALLOC(mf->dof_ids, mf->idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(mf->val, mf->val_idx[n_cells], double);
+  BFT_MALLOC(mf->diag, mf->n_elts, cs_real_t);
+  BFT_MALLOC(mf->x_full, mf->n_elts, cs_real_t);
+  BFT_MALLOC(mf->y_full, mf->n_elts, cs_real_t);
+
+  /* Log the memory used to store the cellwise systems */
+  double  mem_count[2] = {mf->val_idx[n_cells]*sizeof(double)
+                          + mf->idx[n_cells]*sizeof(cs_lnum_t)
+                          + 3*mf->n_elts*sizeof(cs_real_t),
+                          mf->n_rows};
+
+  cs_parall_sum(2, CS_DOUBLE, mem_count);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                " -cdo- Matrix-free operator (stride %d): storage of cellwise"
+                " systems %.3f MB (%.1f bytes by DoF)\n",
+                stride, mem_count[0]/1048576.,
+                mem_count[0]/CS_MAX(mem_count[1], 1));
+
+  return mf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_equation_mfree_t structure
+ *
+ * \param[in, out]  p_mf    pointer of pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_free(cs_equation_mfree_t   **p_mf)
+{
+  if (p_mf == NULL)
+    return;
+  if (*p_mf == NULL)
+    return;
+
+  cs_equation_mfree_t  *mf = *p_mf;
+
+  BFT_FREE(mf->idx);
+  BFT_FREE(mf->val_idx);
+  BFT_FREE(mf->dof_ids);
+  BFT_FREE(mf->val);
+  BFT_FREE(mf->diag);
+  BFT_FREE(mf->x_full);
+  BFT_FREE(mf->y_full);
+
+  BFT_FREE(mf);
+  *p_mf = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a shell matrix relying on a cs_equation_mfree_t structure
+ *         to compute matrix-vector products. The diagonal is available once
+ *         \ref cs_equation_mfree_finalize has been called.
+ *
+ * \param[in]  mf      pointer to a cs_equation_mfree_t structure
+ *
+ * \return a pointer to a new allocated cs_matrix_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_equation_mfree_create_matrix(const cs_equation_mfree_t   *mf)
+{
+  assert(mf != NULL);
+
+  return cs_matrix_create_shell(mf->n_rows,
+                                false,     /* symmetric ? */
+                                mf->diag,
+                                _mfree_product,
+                                mf);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Store a cellwise system instead of assembling it into the global
+ *         algebraic system. Cellwise systems defined by blocks are handled.
+ *
+ * \param[in]      csys      cellwise view of the algebraic system
+ * \param[in, out] mf        pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_store(const cs_cell_sys_t       *csys,
+                        cs_equation_mfree_t       *mf)
+{
+  const cs_lnum_t  c_id = csys->c_id;
+  const cs_sdm_t  *m = csys->mat;
+  const int  n = mf->idx[c_id+1] - mf->idx[c_id];
+
+  cs_lnum_t  *ids = mf->dof_ids + mf->idx[c_id];
+  double  *val = mf->val + mf->val_idx[c_id];
+
+  for (int i = 0; i < n; i++)
+    ids[i] = csys->dof_ids[i];
+
+  if (m->flag & CS_SDM_BY_BLOCK) {
+
+    const cs_sdm_block_t  *bd = m->block_desc;
+    const int  nx = mf->stride;
+
+    assert(bd->n_row_blocks*nx == n);
+
+    for (int bi = 0; bi < bd->n_row_blocks; bi++) {
+      for (int bj = 0; bj < bd->n_col_blocks; bj++) {
+
+        const cs_sdm_t  *mIJ = cs_sdm_get_block(m, bi, bj);
+
+        for (short int ii = 0; ii < nx; ii++)
+          for (short int jj = 0; jj < nx; jj++)
+            val[(bi*nx + ii)*n + bj*nx + jj] = mIJ->val[ii*nx + jj];
+
+      }
+    }
+
+  }
+  else {
+
+    assert(m->n_rows == n);
+    memcpy(val, m->val, n*n*sizeof(double));
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the diagonal of the operator once all the cellwise systems
+ *         have been stored
+ *
+ * \param[in, out] mf        pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_finalize(cs_equation_mfree_t       *mf)
+{
+  const cs_lnum_t  n_elts = mf->n_elts;
+
+  cs_real_t  *diag = mf->diag;
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    diag[i] = 0.;
+
+# pragma omp parallel for if (mf->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < mf->n_cells; c_id++) {
+
+    const cs_lnum_t  *ids = mf->dof_ids + mf->idx[c_id];
+    const double  *m = mf->val + mf->val_idx[c_id];
+    const int  n = mf->idx[c_id+1] - mf->idx[c_id];
+
+    for (int i = 0; i < n; i++)
+#     pragma omp atomic
+      diag[ids[i]] += m[i*n + i];
+
+  }
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_interface_set_sum(mf->rs->ifs, n_elts, 1, false, CS_REAL_TYPE, diag);
+    cs_range_set_gather(mf->rs, CS_REAL_TYPE, 1, diag, diag);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Get the connectivity vertex->vertices for the local rank
@@ -37,6 +37,7 @@
 #include "cs_domain.h"
 #include "cs_equation_param.h"
 #include "cs_flag.h"
+#include "cs_hodge.h"
 #include "cs_matrix.h"
 #include "cs_time_step.h"
 #include "cs_timer.h"
@@ -54,6 +55,14 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*! \struct cs_equation_mfree_t
+ *  \brief Matrix-free representation of the operator of an equation. The
+ *  final cellwise systems are stored and the global matrix is never
+ *  assembled
+ */
+
+typedef struct _cs_equation_mfree_t  cs_equation_mfree_t;
+
 /*! \struct cs_equation_builder_t
  *  \brief Store common elements used when building an algebraic system
  *  related to an equation
@@ -120,6 +129,30 @@ typedef struct {
 
   cs_cdo_bc_t           *face_bc; /*!< list of faces sorted by type of BCs */
 
+  /*!
+   * @}
+   * @name Matrix-free operator
+   * @{
+   */
+
+  cs_equation_mfree_t   *mfree;   /*!< NULL if the global matrix is assembled
+                                   *   (default) */
+
+  /*!
+   * @}
+   * @name Frozen operator
+   * @{
+   *
+   * When frozen_operator is true, the global matrix (and the setup of the
+   * linear solver) is kept from one time step to another. matrix_is_frozen
+   * is then set to true if the kept matrix is valid for the current time
+   * step, so that only the right-hand side is assembled.
+   */
+
+  bool      frozen_operator;   /*!< Can the global matrix be kept ? */
+  bool      matrix_is_frozen;  /*!< Is the kept matrix used ? */
+  double    frozen_dt;         /*!< Time step used to build the kept matrix */
+
   /*!
    * @}
    * @name Performance monitoring
@@ -319,6 +352,27 @@ cs_equation_init_properties(const cs_equation_param_t     *eqp,
                             double                        *rpty_vals,
                             cs_cell_builder_t             *cb);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cache of cellwise operators (stiffness or mass matrix) if
+ *         this is requested in the settings of the equation and if the
+ *         property used to build these operators is steady
+ *
+ * \param[in]  eqp           pointer to a cs_equation_param_t structure
+ * \param[in]  pty           pointer to the related property (NULL if unity)
+ * \param[in]  c2x           pointer to a cell --> entities adjacency
+ * \param[in]  n_cell_dofs   number of additional DoFs attached to each cell
+ *
+ * \return a pointer to a new allocated cs_hodge_cache_t structure or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_equation_create_hodge_cache(const cs_equation_param_t     *eqp,
+                               const cs_property_t           *pty,
+                               const cs_adjacency_t          *c2x,
+                               int                            n_cell_dofs);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the diffusion property inside a cell and its related quantities
@@ -363,14 +417,17 @@ cs_equation_set_diffusion_property_cw(const cs_equation_param_t     *eqp,
  * \brief  Assemble a cellwise system into the global algebraic system
  *
  * \param[in]      csys         cellwise view of the algebraic system
- * \param[in]      rset         pointer to a cs_range_set_t structure
- * \param[in, out] mav          pointer to a matrix assembler structure
+ * \param[in]      rset           pointer to a cs_range_set_t structure
+ * \param[in]      conflict_free  true if no other thread may assemble the same
+ *                                rows at the same time (colored cells)
+ * \param[in, out] mav            pointer to a matrix assembler structure
  */
 /*----------------------------------------------------------------------------*/
 
 void
 cs_equation_assemble_matrix(const cs_cell_sys_t            *csys,
                             const cs_range_set_t           *rset,
+                            bool                            conflict_free,
                             cs_matrix_assembler_values_t   *mav);
 
 /*----------------------------------------------------------------------------*/
@@ -379,9 +436,11 @@ cs_equation_assemble_matrix(const cs_cell_sys_t            *csys,
  *         algebraic system
  *
  * \param[in]      csys         cellwise view of the algebraic system
- * \param[in]      rset         pointer to a cs_range_set_t structure
- * \param[in]      n_x_dofs     number of DoFs per entity (= size of the block)
- * \param[in, out] mav          pointer to a matrix assembler structure
+ * \param[in]      rset           pointer to a cs_range_set_t structure
+ * \param[in]      n_x_dofs       number of DoFs per entity (= size of the block)
+ * \param[in]      conflict_free  true if no other thread may assemble the same
+ *                                rows at the same time (colored cells)
+ * \param[in, out] mav            pointer to a matrix assembler structure
  */
 /*----------------------------------------------------------------------------*/
 
@@ -389,8 +448,82 @@ void
 cs_equation_assemble_block_matrix(const cs_cell_sys_t            *csys,
                                   const cs_range_set_t           *rset,
                                   int                             n_x_dofs,
+                                  bool                            conflict_free,
                                   cs_matrix_assembler_values_t   *mav);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cs_equation_mfree_t structure storing the cellwise systems
+ *         of an equation in order to apply its operator without assembling
+ *         a global matrix. Return NULL if this is not requested.
+ *
+ * \param[in]  eqp       pointer to a cs_equation_param_t structure
+ * \param[in]  c2x       pointer to the cell --> entities adjacency
+ * \param[in]  stride    number of DoFs by entity
+ * \param[in]  rs        pointer to the related cs_range_set_t structure
+ *
+ * \return a pointer to a new allocated cs_equation_mfree_t structure or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_equation_mfree_t *
+cs_equation_mfree_create(const cs_equation_param_t     *eqp,
+                         const cs_adjacency_t          *c2x,
+                         int                            stride,
+                         const cs_range_set_t          *rs);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_equation_mfree_t structure
+ *
+ * \param[in, out]  p_mf    pointer of pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_free(cs_equation_mfree_t   **p_mf);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a shell matrix relying on a cs_equation_mfree_t structure
+ *         to compute matrix-vector products. The diagonal is available once
+ *         \ref cs_equation_mfree_finalize has been called.
+ *
+ * \param[in]  mf      pointer to a cs_equation_mfree_t structure
+ *
+ * \return a pointer to a new allocated cs_matrix_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_equation_mfree_create_matrix(const cs_equation_mfree_t   *mf);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Store a cellwise system instead of assembling it into the global
+ *         algebraic system. Cellwise systems defined by blocks are handled.
+ *
+ * \param[in]      csys      cellwise view of the algebraic system
+ * \param[in, out] mf        pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_store(const cs_cell_sys_t       *csys,
+                        cs_equation_mfree_t       *mf);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the diagonal of the operator once all the cellwise systems
+ *         have been stored
+ *
+ * \param[in, out] mf        pointer to a cs_equation_mfree_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_mfree_finalize(cs_equation_mfree_t       *mf);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Get the connectivity vertex->vertices for the local rank
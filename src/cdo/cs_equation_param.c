@@ -348,6 +348,10 @@ cs_equation_create_param(cs_equation_type_t     type,
   eqp->space_scheme = CS_SPACE_SCHEME_CDOVB;
   eqp->dof_reduction = CS_PARAM_REDUCTION_DERHAM;
   eqp->space_poly_degree = 0;
+  eqp->hodge_cache = CS_PARAM_HODGE_CACHE_NONE;
+  eqp->build_mode = CS_PARAM_CDO_BUILD_CELLWISE;
+  eqp->matrix_free = false;
+  eqp->frozen_operator = false;
 
   /* Vertex-based schemes imply the two following discrete Hodge operators
      Default initialization is made in accordance with this choice */
@@ -557,6 +561,56 @@ cs_equation_set_param(cs_equation_param_t   *eqp,
     }
     break;
 
+  case CS_EQKEY_HODGE_CACHE:
+    if (strcmp(val, "none") == 0)
+      eqp->hodge_cache = CS_PARAM_HODGE_CACHE_NONE;
+    else if (strcmp(val, "double") == 0)
+      eqp->hodge_cache = CS_PARAM_HODGE_CACHE_DOUBLE;
+    else if (strcmp(val, "float") == 0)
+      eqp->hodge_cache = CS_PARAM_HODGE_CACHE_FLOAT;
+    else {
+      const char *_val = val;
+      bft_error(__FILE__, __LINE__, 0,
+                emsg, __func__, _val, "CS_EQKEY_HODGE_CACHE");
+    }
+    break;
+
+  case CS_EQKEY_BUILD_MODE:
+    if (strcmp(val, "cellwise") == 0)
+      eqp->build_mode = CS_PARAM_CDO_BUILD_CELLWISE;
+    else if (strcmp(val, "batched") == 0)
+      eqp->build_mode = CS_PARAM_CDO_BUILD_BATCHED;
+    else {
+      const char *_val = val;
+      bft_error(__FILE__, __LINE__, 0,
+                emsg, __func__, _val, "CS_EQKEY_BUILD_MODE");
+    }
+    break;
+
+  case CS_EQKEY_MATRIX_FREE:
+    if (strcmp(val, "true") == 0)
+      eqp->matrix_free = true;
+    else if (strcmp(val, "false") == 0)
+      eqp->matrix_free = false;
+    else {
+      const char *_val = val;
+      bft_error(__FILE__, __LINE__, 0,
+                emsg, __func__, _val, "CS_EQKEY_MATRIX_FREE");
+    }
+    break;
+
+  case CS_EQKEY_FROZEN_OPERATOR:
+    if (strcmp(val, "true") == 0)
+      eqp->frozen_operator = true;
+    else if (strcmp(val, "false") == 0)
+      eqp->frozen_operator = false;
+    else {
+      const char *_val = val;
+      bft_error(__FILE__, __LINE__, 0,
+                emsg, __func__, _val, "CS_EQKEY_FROZEN_OPERATOR");
+    }
+    break;
+
   case CS_EQKEY_HODGE_DIFF_ALGO:
     if (strcmp(val,"cost") == 0)
       eqp->diffusion_hodge.algo = CS_PARAM_HODGE_ALGO_COST;
@@ -836,6 +890,12 @@ cs_equation_param_set_sles(const char               *eqname,
 {
   const cs_param_itsol_t  itsol = eqp->itsol_info;
 
+  if (eqp->matrix_free && eqp->solver_class != CS_EQUATION_SOLVER_CLASS_CS)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: A matrix-free operator is only available with"
+              " Code_Saturne's iterative solvers.\n"
+              " Please change your settings.", eqname);
+
   switch (eqp->solver_class) {
   case CS_EQUATION_SOLVER_CLASS_CS:
     {
@@ -853,6 +913,14 @@ cs_equation_param_set_sles(const char               *eqname,
                   " Incompatible preconditioner with Code_Saturne solvers.\n"
                   " Please change your settings (try PETSc ?)");
 
+      /* Only matrix-vector products and the diagonal are available with a
+         matrix-free operator */
+      if (eqp->matrix_free && itsol.solver == CS_PARAM_ITSOL_AMG)
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Algebraic multigrid is not compatible with a"
+                  " matrix-free operator.\n"
+                  " Please change your settings.", eqname);
+
       switch (itsol.solver) { // Type of iterative solver
 
       case CS_PARAM_ITSOL_JACOBI:
@@ -1060,6 +1128,17 @@ cs_equation_summary_param(const char                  *eqname,
   cs_log_printf(CS_LOG_SETUP, "  <%s/space poly degree>  %d\n",
                 eqname, eqp->space_poly_degree);
 
+  if (eqp->hodge_cache == CS_PARAM_HODGE_CACHE_DOUBLE)
+    cs_log_printf(CS_LOG_SETUP, "  <%s/Hodge.Cache> double\n", eqname);
+  else if (eqp->hodge_cache == CS_PARAM_HODGE_CACHE_FLOAT)
+    cs_log_printf(CS_LOG_SETUP, "  <%s/Hodge.Cache> float\n", eqname);
+  if (eqp->build_mode == CS_PARAM_CDO_BUILD_BATCHED)
+    cs_log_printf(CS_LOG_SETUP, "  <%s/Build.Mode> batched\n", eqname);
+  if (eqp->matrix_free)
+    cs_log_printf(CS_LOG_SETUP, "  <%s/Matrix.Free> true\n", eqname);
+  if (eqp->frozen_operator)
+    cs_log_printf(CS_LOG_SETUP, "  <%s/Frozen.Operator> true\n", eqname);
+
   bool  unsteady = (eqp->flag & CS_EQUATION_UNSTEADY) ? true : false;
   bool  convection = (eqp->flag & CS_EQUATION_CONVECTION) ? true : false;
   bool  diffusion = (eqp->flag & CS_EQUATION_DIFFUSION) ? true : false;
@@ -184,6 +184,31 @@ typedef struct {
    */
   int                        space_poly_degree;
 
+  /*! \var hodge_cache
+   * Storage of the cellwise stiffness and mass matrices between two builds
+   * of the algebraic system. Only used when the related property is steady.
+   */
+  cs_param_hodge_cache_t     hodge_cache;
+
+  /*! \var build_mode
+   * How are traversed the cells when building the algebraic system: cell by
+   * cell or by batches of cells sharing the same type of element
+   */
+  cs_param_cdo_build_t       build_mode;
+
+  /*! \var matrix_free
+   * If true, the global matrix is not assembled. The cellwise systems are
+   * kept and the operator is applied cell by cell inside the linear solver.
+   */
+  bool                       matrix_free;
+
+  /*! \var frozen_operator
+   * If true and if the operator does not change in time, the global matrix
+   * and the setup of the linear solver are kept from one time step to
+   * another. Only the right-hand side is assembled at each time step.
+   */
+  bool                       frozen_operator;
+
   /*!
    * @}
    * @name Settings for the boundary conditions
@@ -432,6 +457,49 @@ typedef struct {
  * - or "1.5", "9" for instance
  *
  *
+ * \var CS_EQKEY_HODGE_CACHE
+ * Store the cellwise stiffness and mass matrices the first time they are
+ * built and reuse them afterwards. This is only done for a diffusion term
+ * with a steady property (the mass matrix does not depend on a property).
+ * Available choices are:
+ * - "none" (default) --> local operators are rebuilt at each build
+ * - "double" --> local operators are stored in double precision
+ * - "float" --> local operators are stored in single precision (less memory
+ *   but the algebraic system is then slightly modified)
+ *
+ * \var CS_EQKEY_BUILD_MODE
+ * Set how the cells are traversed when building the algebraic system.
+ * Available choices are:
+ * - "cellwise" (default) --> cells are processed one by one
+ * - "batched" --> cells sharing the same type of element (tetrahedra,
+ *   pyramids, prisms and hexahedra) are gathered by batches of
+ *   \ref CS_CDO_CELL_BATCH_SIZE cells and the local stiffness matrices are
+ *   computed simultaneously for all the cells of a batch. This is only
+ *   available for CDO vertex-based schemes with a scalar-valued unknown and an
+ *   isotropic diffusion property relying on the COST algorithm. Otherwise,
+ *   this setting is ignored.
+ *
+ * \var CS_EQKEY_MATRIX_FREE
+ * Do not assemble the global matrix of the algebraic system ("false" by
+ * default). When set to "true", the final cellwise systems are stored and the
+ * operator is applied cell by cell each time the iterative solver requests a
+ * matrix-vector product. Only available for scalar-valued CDO vertex-based
+ * schemes and scalar-valued or vector-valued CDO face-based schemes solved
+ * with Code_Saturne's Krylov solvers and a diagonal or polynomial
+ * preconditioner (no AMG). This saves the assembly time but not memory:
+ * dense cellwise matrices are stored (e.g. 64 values by hexahedron with
+ * CDO vertex-based schemes and 324 with vector-valued CDO face-based
+ * schemes), which is in general more than the assembled matrix. The memory
+ * used is reported in the log.
+ *
+ * \var CS_EQKEY_FROZEN_OPERATOR
+ * Keep the global matrix and the setup of the linear solver (multigrid
+ * hierarchy or preconditioner) along time steps ("false" by default). This
+ * is only taken into account for unsteady scalar-valued CDO vertex-based and
+ * face-based schemes with an assembled matrix, when all the properties and
+ * the advection field are steady and as long as the time step is constant.
+ * Only the right-hand side is then assembled at each time step.
+ *
  * \var CS_EQKEY_SOLVER_FAMILY
  * Specify which class of solver are possible. Available choises are:
  * - "cs" --> (default) List of possible iterative solvers are those of
@@ -547,8 +615,11 @@ typedef enum {
   CS_EQKEY_ADV_SCHEME,
   CS_EQKEY_BC_ENFORCEMENT,
   CS_EQKEY_BC_QUADRATURE,
+  CS_EQKEY_BUILD_MODE,
   CS_EQKEY_DOF_REDUCTION,
   CS_EQKEY_EXTRA_OP,
+  CS_EQKEY_FROZEN_OPERATOR,
+  CS_EQKEY_HODGE_CACHE,
   CS_EQKEY_HODGE_DIFF_ALGO,
   CS_EQKEY_HODGE_DIFF_COEF,
   CS_EQKEY_HODGE_TIME_ALGO,
@@ -559,6 +630,7 @@ typedef enum {
   CS_EQKEY_ITSOL_EPS,
   CS_EQKEY_ITSOL_MAX_ITER,
   CS_EQKEY_ITSOL_RESNORM,
+  CS_EQKEY_MATRIX_FREE,
   CS_EQKEY_PRECOND,
   CS_EQKEY_SLES_VERBOSITY,
   CS_EQKEY_SOLVER_FAMILY,
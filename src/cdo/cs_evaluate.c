@@ -488,374 +488,149 @@ _dcvd_by_analytic(cs_real_t                        time_eval,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Compute the integral over primal cells of a scalar-valued density
- *         field defined by an analytical function on a selection of (primal)
- *         cells
- *
- * \param[in]      time_eval     physical time at which one evaluates the term
- * \param[in]      ana               pointer to the analytic function
- * \param[in]      input             NULL or pointer cast on-the-fly
- * \param[in]      n_elts            number of elements to consider
- * \param[in]      elt_ids           pointer to the list of selected ids
- * \param[in]      compute_integral  function pointer
- * \param[in, out] values            pointer to the computed values
- */
-/*----------------------------------------------------------------------------*/
-
-static void
-_pcsd_by_analytic(cs_real_t                        time_eval,
-                  cs_analytic_func_t              *ana,
-                  void                            *input,
-                  const cs_lnum_t                  n_elts,
-                  const cs_lnum_t                 *elt_ids,
-                  cs_quadrature_tetra_integral_t  *compute_integral,
-                  cs_real_t                        values[])
-{
-  const cs_cdo_quantities_t  *quant = cs_cdo_quant;
-  const cs_real_t  *xv = quant->vtx_coord;
-  const cs_cdo_connect_t  *connect = cs_cdo_connect;
-  const cs_adjacency_t  *c2f = connect->c2f;
-  const cs_adjacency_t  *f2e = connect->f2e;
-
-# pragma omp parallel for if (n_elts > CS_THR_MIN)
-  for (cs_lnum_t id = 0; id < n_elts; id++) {
-
-    const cs_lnum_t  c_id = (elt_ids == NULL) ? id : elt_ids[id];
-    if (connect->cell_type[c_id] == FVM_CELL_TETRA) {
-
-      const cs_lnum_t  *v = connect->c2v->ids + connect->c2v->idx[c_id];
-
-      compute_integral(time_eval,
-                       xv+3*v[0], xv+3*v[1], xv+3*v[2], xv+3*v[3],
-                       quant->cell_vol[c_id],
-                       ana, input, values + c_id);
-
-    }
-    else {
-
-      const cs_real_t  *xc = quant->cell_centers + 3*c_id;
-
-      for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
-
-        const cs_lnum_t  f_id = c2f->ids[i];
-        const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
-        const double  hfco =
-          cs_math_onethird * cs_math_3_dot_product(pfq.unitv,
-                                                   quant->dedge_vector+3*i);
-        const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
-
-        if (end - start == 3) {
-
-          cs_lnum_t v0, v1, v2;
-          cs_connect_get_next_3_vertices(connect->f2e->ids, connect->e2v->ids,
-                                         start, &v0, &v1, &v2);
-          compute_integral(time_eval, xv + 3*v0, xv + 3*v1, xv + 3*v2, xc,
-                           hfco * pfq.meas,
-                           ana, input, values + c_id);
-        }
-        else {
-
-          for (cs_lnum_t j = start; j < end; j++) {
-
-            const cs_lnum_t  _2e = 2*f2e->ids[j];
-            const cs_lnum_t  v1 = connect->e2v->ids[_2e];
-            const cs_lnum_t  v2 = connect->e2v->ids[_2e+1];
-
-            compute_integral(time_eval, xv + 3*v1, xv + 3*v2, pfq.center, xc,
-                             hfco*cs_math_surftri(xv+3*v1, xv+3*v2, pfq.center),
-                             ana, input, values + c_id);
-
-          } /* Loop on edges */
-
-        } /* Current face is triangle or not ? */
-
-      } /* Loop on faces */
-
-    } /* Not a tetrahedron */
-
-  } /* Loop on cells */
-
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief  Compute the integral over primal cells of a vector-valued density
- *         field defined by an analytical function on a selection of (primal)
- *         cells
+ * \brief  Compute the integral over primal cells of a density field defined
+ *         by an analytical function on a selection of (primal) cells.
+ *         Quadrature points of the tetrahedral subdivision of several cells
+ *         are gathered in a batch so that the analytic function is called
+ *         once per batch instead of once per tetrahedron.
  *
  * \param[in]      time_eval     physical time at which one evaluates the term
- * \param[in]      ana               pointer to the analytic function
- * \param[in]      input             NULL or pointer cast on-the-fly
- * \param[in]      n_elts            number of elements to consider
- * \param[in]      elt_ids           pointer to the list of selected ids
- * \param[in]      compute_integral  function pointer
- * \param[in, out] values            pointer to the computed values
+ * \param[in]      ana           pointer to the analytic function
+ * \param[in]      input         NULL or pointer cast on-the-fly
+ * \param[in]      dim           dimension of the analytic function
+ * \param[in]      qtype         quadrature type
+ * \param[in]      n_elts        number of elements to consider
+ * \param[in]      elt_ids       pointer to the list of selected ids
+ * \param[in, out] values        pointer to the computed values
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_pcvd_by_analytic(cs_real_t                        time_eval,
-                  cs_analytic_func_t              *ana,
-                  void                            *input,
-                  const cs_lnum_t                  n_elts,
-                  const cs_lnum_t                 *elt_ids,
-                  cs_quadrature_tetra_integral_t  *compute_integral,
-                  cs_real_t                        values[])
+_pcd_by_analytic(cs_real_t                        time_eval,
+                 cs_analytic_func_t              *ana,
+                 void                            *input,
+                 int                              dim,
+                 cs_quadrature_type_t             qtype,
+                 const cs_lnum_t                  n_elts,
+                 const cs_lnum_t                 *elt_ids,
+                 cs_real_t                        values[])
 {
   const cs_cdo_quantities_t  *quant = cs_cdo_quant;
   const cs_real_t  *xv = quant->vtx_coord;
   const cs_cdo_connect_t  *connect = cs_cdo_connect;
   const cs_adjacency_t  *c2f = connect->c2f;
   const cs_adjacency_t  *f2e = connect->f2e;
-  const int  dim = 3;
-
-# pragma omp parallel for if (n_elts > CS_THR_MIN)
-  for (cs_lnum_t  id = 0; id < n_elts; id++) {
-
-    const cs_lnum_t  c_id = (elt_ids == NULL) ? id : elt_ids[id];
-    if (connect->cell_type[c_id] == FVM_CELL_TETRA) {
-
-      const cs_lnum_t  *v = connect->c2v->ids + connect->c2v->idx[c_id];
-
-      compute_integral(time_eval,
-                       xv+3*v[0], xv+3*v[1], xv+3*v[2], xv+3*v[3],
-                       quant->cell_vol[c_id],
-                       ana, input, values + dim*c_id);
-
-    }
-    else {
-
-      const cs_real_t  *xc = quant->cell_centers + 3*c_id;
-
-      for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
-
-        const cs_lnum_t  f_id = c2f->ids[i];
-        const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
-        const double hfc = cs_math_onethird *
-                cs_math_3_dot_product(pfq.unitv, quant->dedge_vector+3*i);
-        const cs_lnum_t start = f2e->idx[f_id], end = f2e->idx[f_id+1];
-
-        if (end - start == 3) {
-
-          cs_lnum_t v0, v1, v2;
-          cs_connect_get_next_3_vertices(connect->f2e->ids, connect->e2v->ids,
-                                         start, &v0, &v1, &v2);
-          compute_integral(time_eval,xv + 3*v0, xv + 3*v1, xv + 3*v2, xc,
-                           hfc * pfq.meas,
-                           ana, input, values + 3*c_id);
-        }
-        else {
-
-          for (cs_lnum_t j = start; j < end; j++) {
-
-            const cs_lnum_t  _2e = 2*f2e->ids[j];
-            const cs_lnum_t  v1 = connect->e2v->ids[_2e];
-            const cs_lnum_t  v2 = connect->e2v->ids[_2e+1];
-
-            compute_integral(time_eval, xv + 3*v1, xv + 3*v2, pfq.center, xc,
-                             hfc*cs_math_surftri(xv+3*v1, xv+3*v2, pfq.center),
-                             ana, input, values + 3*c_id);
-
-          } /* Loop on edges */
-
-        } /* Current face is triangle or not ? */
-
-      } /* Loop on faces */
-
-    } /* Not a tetrahedron */
-
-  } /* Loop on cells */
 
-}
+# pragma omp parallel if (n_elts > CS_THR_MIN)
+  {
+    /* Each thread fills its own batch. A cell is handled by only one thread
+       so that flushing a batch never conflicts with another thread. */
+    cs_quadrature_tet_batch_t  batch;
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief  Compute the average over primal cells of a scalar field defined
- *         by an analytical function on a selection of (primal) cells
- *
- * \param[in]      time_eval      physical time at which one evaluates the term
- * \param[in]      ana               pointer to the analytic function
- * \param[in]      input             NULL or pointer cast on-the-fly
- * \param[in]      n_loc_elts        number of elements to consider
- * \param[in]      elt_ids           pointer to the list of selected ids
- * \param[in]      compute_integral  function pointer
- * \param[in, out] values            pointer to the computed values
- */
-/*----------------------------------------------------------------------------*/
+    cs_quadrature_tet_batch_init(qtype, dim, time_eval, ana, input, &batch);
 
-static void
-_pcsa_by_analytic(cs_real_t                        time_eval,
-                  cs_analytic_func_t              *ana,
-                  void                            *input,
-                  const cs_lnum_t                  n_elts,
-                  const cs_lnum_t                 *elt_ids,
-                  cs_quadrature_tetra_integral_t  *compute_integral,
-                  cs_real_t                        values[])
-{
-  const cs_cdo_quantities_t  *quant = cs_cdo_quant;
-  const cs_real_t  *xv = quant->vtx_coord;
-  const cs_cdo_connect_t  *connect = cs_cdo_connect;
-  const cs_adjacency_t  *c2f = connect->c2f;
-  const cs_adjacency_t  *f2e = connect->f2e;
+#   pragma omp for schedule(static, CS_QUADRATURE_BATCH_SIZE)
+    for (cs_lnum_t id = 0; id < n_elts; id++) {
 
-# pragma omp parallel for if (n_elts > CS_THR_MIN)
-  for (cs_lnum_t id = 0; id < n_elts; id++) {
+      const cs_lnum_t  c_id = (elt_ids == NULL) ? id : elt_ids[id];
+      if (connect->cell_type[c_id] == FVM_CELL_TETRA) {
 
-    const cs_lnum_t  c_id = (elt_ids == NULL) ? id : elt_ids[id];
-    if (connect->cell_type[c_id] == FVM_CELL_TETRA) {
+        const cs_lnum_t  *v = connect->c2v->ids + connect->c2v->idx[c_id];
 
-      const cs_lnum_t  *v = connect->c2v->ids + connect->c2v->idx[c_id];
+        cs_quadrature_tet_batch_add(xv+3*v[0], xv+3*v[1], xv+3*v[2], xv+3*v[3],
+                                    quant->cell_vol[c_id], c_id,
+                                    &batch, values);
 
-      compute_integral(time_eval,
-                       xv+3*v[0], xv+3*v[1], xv+3*v[2], xv+3*v[3],
-                       quant->cell_vol[c_id],
-                       ana, input, values + c_id);
+      }
+      else {
 
-    }
-    else {
+        const cs_real_t  *xc = quant->cell_centers + 3*c_id;
 
-      const cs_real_t  *xc = quant->cell_centers + 3*c_id;
+        for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
 
-      for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
+          const cs_lnum_t  f_id = c2f->ids[i];
+          const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
+          const double  hfco =
+            cs_math_onethird * cs_math_3_dot_product(pfq.unitv,
+                                                     quant->dedge_vector+3*i);
+          const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
 
-        const cs_lnum_t  f_id = c2f->ids[i];
-        const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
-        const double  hfco =
-          cs_math_onethird * cs_math_3_dot_product(pfq.unitv,
-                                                   quant->dedge_vector+3*i);
-        const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
+          if (end - start == 3) {
 
-        if (end - start == 3) {
+            cs_lnum_t v0, v1, v2;
+            cs_connect_get_next_3_vertices(connect->f2e->ids,
+                                           connect->e2v->ids,
+                                           start, &v0, &v1, &v2);
+            cs_quadrature_tet_batch_add(xv + 3*v0, xv + 3*v1, xv + 3*v2, xc,
+                                        hfco * pfq.meas, c_id,
+                                        &batch, values);
+          }
+          else {
 
-          cs_lnum_t v0, v1, v2;
-          cs_connect_get_next_3_vertices(connect->f2e->ids, connect->e2v->ids,
-                                         start, &v0, &v1, &v2);
-          compute_integral(time_eval, xv + 3*v0, xv + 3*v1, xv + 3*v2, xc,
-                           hfco * pfq.meas,
-                           ana, input, values + c_id);
-        }
-        else {
+            for (cs_lnum_t j = start; j < end; j++) {
 
-          for (cs_lnum_t j = start; j < end; j++) {
+              const cs_lnum_t  _2e = 2*f2e->ids[j];
+              const cs_lnum_t  v1 = connect->e2v->ids[_2e];
+              const cs_lnum_t  v2 = connect->e2v->ids[_2e+1];
 
-            const cs_lnum_t  _2e = 2*f2e->ids[j];
-            const cs_lnum_t  v1 = connect->e2v->ids[_2e];
-            const cs_lnum_t  v2 = connect->e2v->ids[_2e+1];
+              cs_quadrature_tet_batch_add
+                (xv + 3*v1, xv + 3*v2, pfq.center, xc,
+                 hfco*cs_math_surftri(xv+3*v1, xv+3*v2, pfq.center), c_id,
+                 &batch, values);
 
-            compute_integral(time_eval, xv + 3*v1, xv + 3*v2, pfq.center, xc,
-                             hfco*cs_math_surftri(xv+3*v1, xv+3*v2, pfq.center),
-                             ana, input, values + c_id);
+            } /* Loop on edges */
 
-          } /* Loop on edges */
+          } /* Current face is triangle or not ? */
 
-        } /* Current face is triangle or not ? */
+        } /* Loop on faces */
 
-      } /* Loop on faces */
+      } /* Not a tetrahedron */
 
-    } /* Not a tetrahedron */
+    } /* Loop on cells */
 
-    /* Average */
-    values[c_id] /= quant->cell_vol[c_id];
+    /* Remaining quadrature points */
+    cs_quadrature_tet_batch_flush(&batch, values);
 
-  } /* Loop on cells */
+  } /* OpenMP block */
 
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Compute the average over primal cells of a vector field defined
- *         by an analytical function on a selection of (primal) cells
+ * \brief  Compute the average over primal cells of a field defined by an
+ *         analytical function on a selection of (primal) cells
  *
  * \param[in]      time_eval     physical time at which one evaluates the term
- * \param[in]      ana               pointer to the analytic function
- * \param[in]      input             NULL or pointer cast on-the-fly
- * \param[in]      n_loc_elts        number of elements to consider
- * \param[in]      elt_ids           pointer to the list of selected ids
- * \param[in]      compute_integral  function pointer
- * \param[in, out] values            pointer to the computed values
+ * \param[in]      ana           pointer to the analytic function
+ * \param[in]      input         NULL or pointer cast on-the-fly
+ * \param[in]      dim           dimension of the analytic function
+ * \param[in]      qtype         quadrature type
+ * \param[in]      n_elts        number of elements to consider
+ * \param[in]      elt_ids       pointer to the list of selected ids
+ * \param[in, out] values        pointer to the computed values
  */
 /*----------------------------------------------------------------------------*/
 
-/* Note: the only difference from the scalar version is that there's 3*c_id in
- * the values. Consider merging the two
- */
-
 static void
-_pcva_by_analytic(cs_real_t                        time_eval,
-                  cs_analytic_func_t              *ana,
-                  void                            *input,
-                  const cs_lnum_t                  n_elts,
-                  const cs_lnum_t                 *elt_ids,
-                  cs_quadrature_tetra_integral_t  *compute_integral,
-                  cs_real_t                        values[])
+_pca_by_analytic(cs_real_t                        time_eval,
+                 cs_analytic_func_t              *ana,
+                 void                            *input,
+                 int                              dim,
+                 cs_quadrature_type_t             qtype,
+                 const cs_lnum_t                  n_elts,
+                 const cs_lnum_t                 *elt_ids,
+                 cs_real_t                        values[])
 {
-  const cs_cdo_quantities_t  *quant = cs_cdo_quant;
-  const cs_real_t  *xv = quant->vtx_coord;
-  const cs_cdo_connect_t  *connect = cs_cdo_connect;
-  const cs_adjacency_t  *c2f = connect->c2f;
-  const cs_adjacency_t  *f2e = connect->f2e;
+  const cs_real_t  *cell_vol = cs_cdo_quant->cell_vol;
+
+  _pcd_by_analytic(time_eval, ana, input, dim, qtype, n_elts, elt_ids, values);
 
 # pragma omp parallel for if (n_elts > CS_THR_MIN)
-  for (cs_lnum_t  id = 0; id < n_elts; id++) {
+  for (cs_lnum_t id = 0; id < n_elts; id++) {
 
     const cs_lnum_t  c_id = (elt_ids == NULL) ? id : elt_ids[id];
-    cs_real_t *val_i = values + 3*c_id;
-
-    if (connect->cell_type[c_id] == FVM_CELL_TETRA) {
-
-      const cs_lnum_t  *v = connect->c2v->ids + connect->c2v->idx[c_id];
-
-      compute_integral(time_eval,
-                       xv+3*v[0], xv+3*v[1], xv+3*v[2], xv+3*v[3],
-                       quant->cell_vol[c_id],
-                       ana, input, val_i);
-
-    }
-    else {
-
-      const cs_real_t  *xc = quant->cell_centers + 3*c_id;
-
-      for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
-
-        const cs_lnum_t  f_id = c2f->ids[i];
-        const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
-        const double hfco =
-          cs_math_onethird * cs_math_3_dot_product(pfq.unitv,
-                                                   quant->dedge_vector+3*i);
-        const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
-
-        if (end - start == 3) {
-
-          cs_lnum_t v0, v1, v2;
-          cs_connect_get_next_3_vertices(connect->f2e->ids, connect->e2v->ids,
-                                         start, &v0, &v1, &v2);
-          compute_integral(time_eval, xv + 3*v0, xv + 3*v1, xv + 3*v2, xc,
-                           hfco * pfq.meas,
-                           ana, input, val_i);
-
-        }
-        else {
-
-          for (cs_lnum_t j = start; j < end; j++) {
-
-            const cs_lnum_t  _2e = 2*f2e->ids[j];
-            const cs_lnum_t  v1 = connect->e2v->ids[_2e];
-            const cs_lnum_t  v2 = connect->e2v->ids[_2e+1];
-
-            compute_integral(time_eval, xv + 3*v1, xv + 3*v2, pfq.center, xc,
-                             hfco*cs_math_surftri(xv+3*v1, xv+3*v2, pfq.center),
-                             ana, input, val_i);
-
-          } /* Loop on edges */
-
-        } /* Current face is triangle or not ? */
-
-      } /* Loop on faces */
-
-    } /* Not a tetrahedron */
-
-    const double _overvol = 1./quant->cell_vol[c_id];
-    for (int k = 0; k < 3; k++) val_i[k] *= _overvol;
+    const double  _overvol = 1./cell_vol[c_id];
+    for (int k = 0; k < dim; k++) values[dim*c_id+k] *= _overvol;
 
   } /* Loop on cells */
 
@@ -1722,9 +1497,9 @@ cs_evaluate_density_by_analytic(cs_flag_t           dof_flag,
   if (dof_flag & CS_FLAG_SCALAR) { /* DoF is scalar-valued */
 
     if (cs_flag_test(dof_flag, cs_flag_primal_cell))
-      _pcsd_by_analytic(time_eval, anai->func, anai->input,
-                        z->n_elts, z->elt_ids, qfunc,
-                        retval);
+      _pcd_by_analytic(time_eval, anai->func, anai->input, 1, def->qtype,
+                       z->n_elts, z->elt_ids,
+                       retval);
     else if (cs_flag_test(dof_flag, cs_flag_dual_cell))
       _dcsd_by_analytic(time_eval, anai->func, anai->input,
                         z->n_elts, z->elt_ids, qfunc,
@@ -1736,9 +1511,9 @@ cs_evaluate_density_by_analytic(cs_flag_t           dof_flag,
   else if (dof_flag & CS_FLAG_VECTOR) { /* DoF is vector-valued */
 
     if (cs_flag_test(dof_flag, cs_flag_primal_cell))
-      _pcvd_by_analytic(time_eval, anai->func, anai->input,
-                        z->n_elts, z->elt_ids, qfunc,
-                        retval);
+      _pcd_by_analytic(time_eval, anai->func, anai->input, 3, def->qtype,
+                       z->n_elts, z->elt_ids,
+                       retval);
     else if (cs_flag_test(dof_flag, cs_flag_dual_cell))
       _dcvd_by_analytic(time_eval, anai->func, anai->input,
                         z->n_elts, z->elt_ids, qfunc,
@@ -2370,22 +2145,15 @@ cs_evaluate_average_on_cells_by_analytic(const cs_xdef_t   *def,
 
   const cs_zone_t  *z = cs_volume_zone_by_id(def->z_id);
 
-  cs_quadrature_tetra_integral_t
-    *qfunc = cs_quadrature_get_tetra_integral(def->dim, def->qtype);
   cs_xdef_analytic_input_t *anai = (cs_xdef_analytic_input_t *)def->input;
 
   switch (def->dim) {
 
   case 1: /* Scalar-valued */
-    _pcsa_by_analytic(time_eval,
-                      anai->func, anai->input, z->n_elts, z->elt_ids, qfunc,
-                      retval);
-    break;
-
   case 3: /* Vector-valued */
-    _pcva_by_analytic(time_eval,
-                      anai->func, anai->input, z->n_elts, z->elt_ids, qfunc,
-                      retval);
+    _pca_by_analytic(time_eval, anai->func, anai->input, def->dim, def->qtype,
+                     z->n_elts, z->elt_ids,
+                     retval);
     break;
 
   default:
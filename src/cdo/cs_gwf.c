@@ -1418,21 +1418,24 @@ cs_gwf_compute_steady_state(const cs_mesh_t              *mesh,
 
   }
 
+  /* Tracer equations share the same DoF layout: build and solve them in a
+     row so that a linear solver can be reused when operators are identical */
+  int  n_eqs = 0;
+  cs_equation_t  **eqs = NULL;
+  BFT_MALLOC(eqs, gw->n_tracers, cs_equation_t *);
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
 
-    if (cs_equation_is_steady(tracer->eq)) {
-
-      /* Define the algebraic system */
-      cs_equation_build_system(mesh, time_step, dt_cur, tracer->eq);
+    if (cs_equation_is_steady(tracer->eq))
+      eqs[n_eqs++] = tracer->eq;
 
-      /* Solve the algebraic system */
-      cs_equation_solve(tracer->eq);
+  } /* Loop on tracer equations */
 
-    } /* Solve this equation which is steady */
+  cs_equation_build_and_solve_sequence(mesh, time_step, dt_cur, n_eqs, eqs);
 
-  } /* Loop on tracer equations */
+  BFT_FREE(eqs);
 
 }
 
@@ -1477,21 +1480,24 @@ cs_gwf_compute(const cs_mesh_t              *mesh,
 
   }
 
+  /* Tracer equations share the same DoF layout: build and solve them in a
+     row so that a linear solver can be reused when operators are identical */
+  int  n_eqs = 0;
+  cs_equation_t  **eqs = NULL;
+  BFT_MALLOC(eqs, gw->n_tracers, cs_equation_t *);
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
 
-    if (!cs_equation_is_steady(tracer->eq)) { /* unsteady ? */
-
-      /* Define the algebraic system */
-      cs_equation_build_system(mesh, time_step, dt_cur, tracer->eq);
+    if (!cs_equation_is_steady(tracer->eq)) /* unsteady ? */
+      eqs[n_eqs++] = tracer->eq;
 
-      /* Solve the algebraic system */
-      cs_equation_solve(tracer->eq);
+  } /* Loop on tracer equations */
 
-    } /* Solve this equation which is steady */
+  cs_equation_build_and_solve_sequence(mesh, time_step, dt_cur, n_eqs, eqs);
 
-  } /* Loop on tracer equations */
+  BFT_FREE(eqs);
 
 }
 
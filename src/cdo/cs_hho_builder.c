@@ -63,6 +63,9 @@ BEGIN_C_DECLS
 
 #define CS_HHO_BUILDER_DBG  0
 
+/* Max. number of Gauss points used in a quadrature rule (tetrahedron) */
+#define CS_HHO_BUILDER_N_MAX_GPTS  15
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -92,7 +95,7 @@ _fill_vol_reco_op(cs_sdm_t             *stiffness,
   const short int  gs = hhob->grad_basis->size - 1;
   const short int  cs = hhob->cell_basis->size;
 
-  /* Stiffness matrix is symmetric. Only the right upper is build */
+  /* Stiffness matrix is symmetric. Enforce it from the right upper part */
   cs_real_t  *mg = stiffness->val;
   for (short int i = 0; i < gs; i++) {
     const cs_real_t  *mg_i = mg + i*gs;
@@ -388,43 +391,45 @@ _add_tria_to_reco_op(const cs_real_3_t         xv1,
   const cs_basis_func_t  *cbf = hhob->cell_basis;
   const cs_basis_func_t  *gbf = hhob->grad_basis;
 
+  const int  n_gpts = fbf->n_gpts_tria;
   const short int  fsize = fbf->size;
   const short int  csize = cbf->size;
   const short int  gsize = gbf->size - 1;
 
   cs_real_t  *gw = cb->values;
-  cs_real_t  *f_phi = cb->values + fbf->n_gpts_tria;
-  cs_real_t  *c_phi = cb->values + fbf->n_gpts_tria + fsize;
-  cs_real_t  *g_phi = cb->values + fbf->n_gpts_tria + fsize + csize;
+  cs_real_t  *f_phi = cb->values + n_gpts;
+  cs_real_t  *c_phi = cb->values + n_gpts + fsize;
+  cs_real_t  *g_phi = cb->values + n_gpts + fsize + csize;
+
+  /* Tabulation: f_tab(j,gp) = phi_j(gp), c_tab(j,gp) = -psi_j(gp) and
+     kg_tab(i,gp) = w_gp * kappa.nfc . grad(chi_i)(gp) */
+  cs_sdm_t  *f_tab = hhob->tab_a, *c_tab = hhob->tab_b, *kg_tab = hhob->tab_c;
+
+  assert(n_gpts <= kg_tab->n_max_cols);
+  f_tab->n_rows = fsize, c_tab->n_rows = csize, kg_tab->n_rows = gsize;
+  f_tab->n_cols = c_tab->n_cols = kg_tab->n_cols = n_gpts;
 
   /* Compute Gauss points and related weights */
   fbf->quadrature_tria(xv1, xv2, xv3, surf, gpts, gw);
 
-  /* Build the stiffness matrix M_g by adding the contribution of the
-     current tetrahedron.
-     M_g is symmetric (fill the right upper part first) */
-  for (short int gp = 0; gp < fbf->n_gpts_tria; gp++) {
+  for (short int gp = 0; gp < n_gpts; gp++) {
 
     gbf->eval_all_at_point(gbf, gpts[gp], g_phi);
     cbf->eval_all_at_point(cbf, gpts[gp], c_phi);
     fbf->eval_all_at_point(fbf, gpts[gp], f_phi);
 
-    for (short int i = 0; i < gsize; i++) {
-
-      const cs_real_t  coef = gw[gp] * _dp3(kappa_nfc, g_phi + 3*(i+1));
-
-      /* cell part */
-      for (short int j = 0; j < csize; j++)
-        rc->val[j*gsize + i] -= coef * c_phi[j];
-
-      /* face part */
-      for (short int j = 0; j < fsize; j++)
-        rf->val[j*gsize + i] += coef * f_phi[j];
-
-    } /* End of loop on matrix columns */
+    for (short int i = 0; i < gsize; i++)
+      kg_tab->val[i*n_gpts + gp] = gw[gp] * _dp3(kappa_nfc, g_phi + 3*(i+1));
+    for (short int j = 0; j < csize; j++)
+      c_tab->val[j*n_gpts + gp] = -c_phi[j];
+    for (short int j = 0; j < fsize; j++)
+      f_tab->val[j*n_gpts + gp] = f_phi[j];
 
   }  /* End of loop on Gauss points */
 
+  /* rc += c_tab.kg_tab^T (cell part) and rf += f_tab.kg_tab^T (face part) */
+  cs_sdm_multiply_rowrow(c_tab, kg_tab, rc);
+  cs_sdm_multiply_rowrow(f_tab, kg_tab, rf);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -457,19 +462,24 @@ _add_tetra_to_reco_op(const cs_real_3_t         xv1,
                       cs_hho_builder_t         *hhob)
 {
   const cs_basis_func_t  *gbf = hhob->grad_basis;
+  const int  n_gpts = gbf->n_gpts_tetra;
   const short int gs = gbf->size - 1;
 
-  cs_real_3_t Kgrad_phi_i;
   cs_real_t  *gw = cb->values;
-  cs_real_t  *g_phi = cb->values + gbf->n_gpts_tetra;
+  cs_real_t  *g_phi = cb->values + n_gpts;
+
+  /* Tabulation: row i of g_tab stores grad(chi_i) at each Gauss point and
+     row i of kg_tab stores w_gp * K.grad(chi_i) at each Gauss point */
+  cs_sdm_t  *g_tab = hhob->tab_a, *kg_tab = hhob->tab_b;
+
+  assert(3*n_gpts <= g_tab->n_max_cols);
+  g_tab->n_rows = kg_tab->n_rows = gs;
+  g_tab->n_cols = kg_tab->n_cols = 3*n_gpts;
 
   /* Compute Gauss points and related weights */
   gbf->quadrature_tetra(xv1, xv2, xv3, xv4, vol, gpts, gw);
 
-  /* Build the stiffness matrix M_g by adding the contribution of the
-     current tetrahedron.
-     M_g is symmetric (fill the right upper part first) */
-  for (short int gp = 0; gp < gbf->n_gpts_tetra; gp++) {
+  for (short int gp = 0; gp < n_gpts; gp++) {
 
     const cs_real_t  w = gw[gp];
 
@@ -477,16 +487,23 @@ _add_tetra_to_reco_op(const cs_real_3_t         xv1,
 
     for (short int i = 0; i < gs; i++) {
 
-      _mv3((const cs_real_t (*)[3])cb->pty_mat, g_phi + 3*(i+1), Kgrad_phi_i);
+      const cs_real_t  *grad_phi_i = g_phi + 3*(i+1);
+      cs_real_t  *g_i = g_tab->val + i*g_tab->n_cols + 3*gp;
+      cs_real_t  *kg_i = kg_tab->val + i*kg_tab->n_cols + 3*gp;
 
-      cs_real_t  *mg_i = stiffness->val + i*gs;
-      for (short int j = i; j < gs; j++)
-        mg_i[j] += w * _dp3(Kgrad_phi_i, g_phi + 3*(j+1));
+      _mv3((const cs_real_t (*)[3])cb->pty_mat, grad_phi_i, kg_i);
+      for (int k = 0; k < 3; k++) {
+        g_i[k] = grad_phi_i[k];
+        kg_i[k] *= w;
+      }
 
-    } /* End of loop on matrix rows */
+    } /* End of loop on basis functions */
 
   }  /* End of loop on Gauss points */
 
+  /* Build the stiffness matrix M_g by adding the contribution of the
+     current tetrahedron: M_g += g_tab.kg_tab^T (symmetric product) */
+  cs_sdm_multiply_rowrow_sym(g_tab, kg_tab, stiffness);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -526,25 +543,40 @@ _add_contrib_mcg(const cs_real_3_t         xv1,
   cs_real_t  *gw = cb->values;
   cs_real_t  *c_phi = cb->values + n_gpts;
 
+  /* Tabulation: wc_tab(i,gp) = w_gp * psi_i(gp) for i < cs and
+     hc_tab(j,gp) = psi_(cs+j)(gp) for the higher-order cell basis functions */
+  cs_sdm_t  *wc_tab = hhob->tab_a, *hc_tab = hhob->tab_b;
+  cs_sdm_t  *prod = hhob->tab_c;
+
+  assert(n_gpts <= wc_tab->n_max_cols);
+  wc_tab->n_rows = cs, hc_tab->n_rows = cs_kp1 - cs;
+  wc_tab->n_cols = hc_tab->n_cols = n_gpts;
+  cs_sdm_init(cs, cs_kp1 - cs, prod);
+
   /* Compute Gauss points and related weights */
   cbf_kp1->quadrature_tetra(xv1, xv2, xv3, xv4, vol, gpts, gw);
 
-  for (short int gp = 0; gp < cbf_kp1->n_gpts_tetra; gp++) {
+  for (short int gp = 0; gp < n_gpts; gp++) {
 
     cbf_kp1->eval_all_at_point(cbf_kp1, gpts[gp], c_phi);
 
-    const cs_real_t  w = gw[gp];
-    for (short int i = 0; i < cs; i++) {
+    for (short int i = 0; i < cs; i++)
+      wc_tab->val[i*n_gpts + gp] = gw[gp] * c_phi[i];
+    for (short int j = cs; j < cs_kp1; j++)
+      hc_tab->val[(j-cs)*n_gpts + gp] = c_phi[j];
 
-      const cs_real_t  coef_i = w * c_phi[i];
-      cs_real_t  *m_cg_i = m_cg->val + i*gs;
-      for (short int j = cs; j < cs_kp1; j++)
-        m_cg_i[j-1] += coef_i * c_phi[j];
+  }  /* End of loop on Gauss points */
 
-    } /* End of loop on matrix rows */
+  cs_sdm_multiply_rowrow(wc_tab, hc_tab, prod);
 
-  }  /* End of loop on Gauss points */
+  for (short int i = 0; i < cs; i++) {
+
+    const cs_real_t  *prod_i = prod->val + i*prod->n_cols;
+    cs_real_t  *m_cg_i = m_cg->val + i*gs + cs - 1;
+    for (short int j = 0; j < cs_kp1 - cs; j++)
+      m_cg_i[j] += prod_i[j];
 
+  } /* End of loop on matrix rows */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -585,44 +617,54 @@ _add_contrib_mf_cg(const cs_real_3_t         xv1,
   cs_real_t  *f_phi = cb->values + n_gpts;
   cs_real_t  *c_phi = f_phi + fbf->size;
 
+  /* Tabulation: wf_tab(i,gp) = w_gp * phi_i(gp) and c_tab(j,gp) = psi_j(gp)
+     for all the cell basis functions of order k+1 */
+  cs_sdm_t  *wf_tab = hhob->tab_a, *c_tab = hhob->tab_b;
+  cs_sdm_t  *prod = hhob->tab_c;
+
+  assert(n_gpts <= wf_tab->n_max_cols && cs_kp1 <= prod->n_max_cols);
+  wf_tab->n_rows = fs, c_tab->n_rows = cs_kp1;
+  wf_tab->n_cols = c_tab->n_cols = n_gpts;
+  cs_sdm_init(fs, cs_kp1, prod);
+
   /* Compute Gauss points and related weights */
   fbf->quadrature_tria(xv1, xv2, xv3, surf, gpts, gw);
 
-  for (short int gp = 0; gp < fbf->n_gpts_tria; gp++) {
+  for (short int gp = 0; gp < n_gpts; gp++) {
 
     cbf_kp1->eval_all_at_point(cbf_kp1, gpts[gp], c_phi);
     fbf->eval_all_at_point(fbf, gpts[gp], f_phi);
 
-    const cs_real_t  w = gw[gp];
+    for (short int i = 0; i < fs; i++)
+      wf_tab->val[i*n_gpts + gp] = gw[gp] * f_phi[i];
+    for (short int j = 0; j < cs_kp1; j++)
+      c_tab->val[j*n_gpts + gp] = c_phi[j];
 
-    /* First block (column) c_phi0 */
-    cs_sdm_t  *m0 = cs_sdm_get_block(mf_cg, 0, 0);
-    const cs_real_t  coef0 = w * c_phi[0];
-    for (short int j = 0; j < fs; j++)
-      m0->val[j] += coef0 * f_phi[j];
+  }  /* End of loop on Gauss points */
 
-    /* Second block (c_phi_k \ 0) */
-    cs_sdm_t  *mk = cs_sdm_get_block(mf_cg, 0, 1);
+  cs_sdm_multiply_rowrow(wf_tab, c_tab, prod);
 
-    /* Third block (c_phi_k+1 \ k) */
-    cs_sdm_t  *mkp1 = cs_sdm_get_block(mf_cg, 0, 2);
+  /* Dispatch the product (fs x cs_kp1) among the three blocks:
+     c_phi0, c_phi_k \ 0 and c_phi_k+1 \ k */
+  cs_sdm_t  *m0 = cs_sdm_get_block(mf_cg, 0, 0);
+  cs_sdm_t  *mk = cs_sdm_get_block(mf_cg, 0, 1);
+  cs_sdm_t  *mkp1 = cs_sdm_get_block(mf_cg, 0, 2);
 
-    for (short int i = 0; i < fs; i++) {
-      const cs_real_t  coef_i = w * f_phi[i];
+  for (short int i = 0; i < fs; i++) {
 
-      cs_real_t  *mk_i = mk->val + i*(cs-1);
-      for (short int j = 1; j < cs; j++)
-        mk_i[j-1] += coef_i * c_phi[j];
+    const cs_real_t  *prod_i = prod->val + i*cs_kp1;
 
-      cs_real_t  *mkp1_i = mkp1->val + i*(cs_kp1-cs);
-      short int shift = 0;
-      for (short int j = cs; j < cs_kp1; j++, shift++)
-        mkp1_i[shift] += coef_i * c_phi[j];
+    m0->val[i] += prod_i[0];
 
-    } /* Loop on rows */
+    cs_real_t  *mk_i = mk->val + i*(cs-1);
+    for (short int j = 1; j < cs; j++)
+      mk_i[j-1] += prod_i[j];
 
-  }  /* End of loop on Gauss points */
+    cs_real_t  *mkp1_i = mkp1->val + i*(cs_kp1-cs);
+    for (short int j = cs; j < cs_kp1; j++)
+      mkp1_i[j-cs] += prod_i[j];
 
+  } /* Loop on rows */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -790,6 +832,15 @@ cs_hho_builder_create(int     order,
 
   BFT_FREE(block_size);
 
+  /* Tabulation of basis functions (a row stores the values or the gradient
+     of one basis function at all the Gauss points of a sub-element) */
+  const int  n_max_rows = CS_MAX(gbs + 1, fbs);
+  const int  n_max_cols = CS_MAX(3*CS_HHO_BUILDER_N_MAX_GPTS, gbs + 1);
+
+  b->tab_a = cs_sdm_create(0, n_max_rows, n_max_cols);
+  b->tab_b = cs_sdm_create(0, n_max_rows, n_max_cols);
+  b->tab_c = cs_sdm_create(0, n_max_rows, n_max_cols);
+
   return b;
 }
 
@@ -821,6 +872,9 @@ cs_hho_builder_free(cs_hho_builder_t  **p_builder)
   b->tmp = cs_sdm_free(b->tmp);
   b->bf_t = cs_sdm_free(b->bf_t);
   b->jstab = cs_sdm_free(b->jstab);
+  b->tab_a = cs_sdm_free(b->tab_a);
+  b->tab_b = cs_sdm_free(b->tab_b);
+  b->tab_c = cs_sdm_free(b->tab_c);
 
   BFT_FREE(b);
 
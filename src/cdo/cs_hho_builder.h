@@ -68,6 +68,13 @@ typedef struct {
   cs_sdm_t   *bf_t;          /* Transposed  of Bf (used in stabilization) */
   cs_sdm_t   *jstab;         /* Stabilization part related to a face */
 
+  /* Tabulation of basis functions at the Gauss points of a sub-element. One
+     row by basis function and one column by Gauss point (and component).
+     Integrals are then computed by blocked row-row matrix products */
+  cs_sdm_t   *tab_a;
+  cs_sdm_t   *tab_b;
+  cs_sdm_t   *tab_c;
+
 } cs_hho_builder_t;
 
 /*============================================================================
@@ -1208,7 +1208,8 @@ cs_hho_scaleq_build_system(const cs_mesh_t            *mesh,
       /* ======== */
 
       /* Matrix assembly */
-      cs_equation_assemble_block_matrix(csys, eqc->rs, eqc->n_face_dofs, mav);
+      cs_equation_assemble_block_matrix(csys, eqc->rs, eqc->n_face_dofs, false,
+                                        mav);
 
       /* Assemble RHS */
       for (short int i = 0; i < eqc->n_face_dofs*cm->n_fc; i++) {
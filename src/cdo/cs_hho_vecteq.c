@@ -1334,6 +1334,7 @@ cs_hho_vecteq_build_system(const cs_mesh_t            *mesh,
       cs_equation_assemble_block_matrix(csys,
                                         eqc->rs,
                                         eqc->n_face_dofs,
+                                        false,
                                         mav);
 
       /* Assemble RHS */
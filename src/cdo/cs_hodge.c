@@ -77,6 +77,10 @@ BEGIN_C_DECLS
 #define CS_HODGE_DBG       0
 #define CS_HODGE_MODULO    1
 
+/* Max. number of edges in a cell which can be treated in a batch of cells
+   (hexahedra) */
+#define CS_HODGE_BATCH_MAX_EBYC  12
+
 /* Redefined the name of functions from cs_math to get shorter names */
 #define _dp3  cs_math_3_dot_product
 
@@ -84,10 +88,32 @@ BEGIN_C_DECLS
  * Local structure definitions
  *============================================================================*/
 
+/* Cache of cellwise operators (discrete Hodge operator or stiffness matrix).
+   Each operator is symmetric and is stored in a packed way (upper triangular
+   part, row by row). */
+
+struct _cs_hodge_cache_t {
+
+  cs_lnum_t     n_cells;     /* number of cells */
+  bool          use_float;   /* store values in single precision */
+
+  cs_lnum_t    *idx;         /* shift to the packed operator of each cell
+                                (size: n_cells + 1) */
+  short int    *n_rows;      /* number of rows of the operator of each cell
+                                or 0 if this operator is not cached yet */
+
+  double       *dval;        /* packed values (double precision) or NULL */
+  float        *fval;        /* packed values (single precision) or NULL */
+
+};
+
 /*============================================================================
  * Local variables
  *============================================================================*/
 
+static int                  _n_hodge_caches = 0;
+static cs_hodge_cache_t   **_hodge_caches = NULL;
+
 /*============================================================================
  * Private constant variables
  *============================================================================*/
@@ -459,6 +485,101 @@ _compute_hodge_cost(const int       n_ent,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Define the local stiffness matrix of a CDO vertex-based scheme from
+ *          the local discrete Hodge operator (EpFd) of the cell.
+ *          Only the upper part of the Hodge operator is used.
+ *
+ * \param[in]      cm       pointer to a cs_cell_mesh_t structure
+ * \param[in]      hval     values of the local Hodge matrix (n_ec x n_ec)
+ * \param[in, out] sloc     local stiffness matrix (initialized to zero)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_define_vb_stiffness(const cs_cell_mesh_t     *cm,
+                     const double              hval[],
+                     cs_sdm_t                 *sloc)
+{
+  for (int ei = 0; ei < cm->n_ec; ei++) { /* Loop on cell edges I */
+
+    const int  shift_i = ei*cm->n_ec;
+    const short int  i1ei = cm->e2v_sgn[ei], i2ei = -i1ei;
+    const short int  i1 = cm->e2v_ids[2*ei];
+    const short int  i2 = cm->e2v_ids[2*ei+1];
+    const double  *hi = hval + shift_i;
+
+    double  *si1 = sloc->val + i1*sloc->n_rows;
+    double  *si2 = sloc->val + i2*sloc->n_rows;
+
+    /* Diagonal value */
+    const double  dval = hi[ei];
+
+    si1[i1] += dval;
+    si2[i2] += dval;
+    if (i1 < i2)
+      si1[i2] -= dval;
+    else
+      si2[i1] -= dval;
+
+    /* Compute extra-diag entries */
+    for (int ej = ei + 1; ej < cm->n_ec; ej++) { /* Loop on cell entities J */
+
+      const short int  j1ej = cm->e2v_sgn[ej], j2ej = -j1ej;
+      const short int  j1 = cm->e2v_ids[2*ej];
+      const short int  j2 = cm->e2v_ids[2*ej+1];
+
+      double  *sj1 = sloc->val + j1*sloc->n_rows;
+      double  *sj2 = sloc->val + j2*sloc->n_rows;
+
+      /* Extra-diagonal value */
+      const double xval = hi[ej];
+
+      /* Vertex i1 */
+      const double  val1 = xval * i1ei;
+      if (i1 == j1)
+        si1[j1] += 2*val1 * j1ej;
+      else if (i1 < j1)
+        si1[j1] += val1 * j1ej;
+      else
+        sj1[i1] += val1 * j1ej;
+
+      if (i1 == j2)
+        si1[j2] += 2*val1 * j2ej;
+      else if (i1 < j2)
+        si1[j2] += val1 * j2ej;
+      else
+        sj2[i1] += val1 * j2ej;
+
+      /* Vertex i2 */
+      const double  val2 = xval * i2ei;
+      if (i2 == j1)
+        si2[j1] += 2*val2 * j1ej;
+      else if (i2 < j1)
+        si2[j1] += val2 * j1ej;
+      else
+        sj1[i2] += val2 * j1ej;
+
+      if (i2 == j2)
+        si2[j2] += 2*val2 * j2ej;
+      else if (i2 < j2)
+        si2[j2] += val2 * j2ej;
+      else
+        sj2[i2] += val2 * j2ej;
+
+    } /* End of loop on J entities */
+
+  } /* End of loop on I entities */
+
+  /* Stiffness matrix is symmetric by construction */
+  for (int ei = 0; ei < sloc->n_rows; ei++) {
+    double *si = sloc->val + ei*sloc->n_rows;
+    for (int ej = 0; ej < ei; ej++)
+      si[ej] = sloc->val[ej*sloc->n_rows + ei];
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -671,105 +792,191 @@ cs_hodge_vb_cost_get_stiffness(const cs_param_hodge_t    h_info,
                         (const cs_real_t (*)[3])dq,
                         alpha, kappa, hloc);
 
-  for (int ei = 0; ei < cm->n_ec; ei++) { /* Loop on cell edges I */
+  /* Add the stabilization part to the local Hodge matrix */
+  _compute_hodge_cost(cm->n_ec, beta2, alpha, kappa, hloc->val);
 
-    const int  shift_i = ei*cm->n_ec;
-    const double  *alpha_i = alpha + shift_i;
-    const short int  i1ei = cm->e2v_sgn[ei], i2ei = -i1ei;
-    const short int  i1 = cm->e2v_ids[2*ei];
-    const short int  i2 = cm->e2v_ids[2*ei+1];
-    const double  *hi = hloc->val + shift_i;
+  /* Define the local stiffness matrix from the local Hodge matrix */
+  _define_vb_stiffness(cm, hloc->val, sloc);
 
-    double  *si1 = sloc->val + i1*sloc->n_rows;
-    double  *si2 = sloc->val + i2*sloc->n_rows;
+#if defined(DEBUG) && !defined(NDEBUG) && CS_HODGE_DBG > 1
+  if (cm->c_id % CS_HODGE_MODULO == 0) {
+    cs_log_printf(CS_LOG_DEFAULT, ">> Local stiffness matrix");
+    cs_sdm_dump(cm->c_id, NULL, NULL, sloc);
+    _check_stiffness(sloc);
+  }
+#endif
+}
 
-    /* Add contribution from the stabilization part for
-       each sub-volume related to a primal entity */
-    double  stab_part = 0;
-    for (int ek = 0; ek < cm->n_ec; ek++) /* Loop over sub-volumes */
-      stab_part += kappa[ek] * alpha_i[ek] * alpha_i[ek];
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build the local stiffness matrices of a batch of cells sharing the
+ *          same type of element using the generic COST algo.
+ *          Case of CDO vertex-based schemes with an isotropic property.
+ *          Geometrical quantities and discrete Hodge operators are stored in
+ *          an interleaved way (the index of the cell in the batch runs
+ *          fastest) so that the computations are vectorized across the batch.
+ *          The computed matrices are stored in cbatch->loc
+ *
+ * \param[in]      h_info     pointer to a cs_param_hodge_t structure
+ * \param[in, out] cbatch     pointer to a cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
 
-    /* Diagonal value: consistency part has already been computed */
-    const double  dval = hi[ei] + beta2 * stab_part;
+void
+cs_hodge_vb_cost_get_stiffness_batch(const cs_param_hodge_t    h_info,
+                                     cs_cell_batch_t          *cbatch)
+{
+  const int  bs = CS_CDO_CELL_BATCH_SIZE;
+  const int  n_cells = cbatch->n_cells;
+  const int  n_ec = cbatch->cm[0]->n_ec;
 
-    si1[i1] += dval;
-    si2[i2] += dval;
-    if (i1 < i2)
-      si1[i2] -= dval;
-    else
-      si2[i1] -= dval;
+  /* Sanity checks */
+  assert(h_info.type == CS_PARAM_HODGE_TYPE_EPFD);
+  assert(h_info.algo == CS_PARAM_HODGE_ALGO_COST);
+  assert(h_info.is_iso || h_info.is_unity);
+  assert(n_cells > 0 && n_cells <= bs);
+  assert(cbatch->type != FVM_CELL_POLY);
+
+  if (n_ec > CS_HODGE_BATCH_MAX_EBYC)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Too many edges in a cell (%d > %d).\n",
+              __func__, n_ec, CS_HODGE_BATCH_MAX_EBYC);
+
+  /* Interleaved buffers */
+  double  invcvol[CS_CDO_CELL_BATCH_SIZE], ptyval[CS_CDO_CELL_BATCH_SIZE];
+  double  pq[3*CS_HODGE_BATCH_MAX_EBYC*CS_CDO_CELL_BATCH_SIZE];
+  double  dq[3*CS_HODGE_BATCH_MAX_EBYC*CS_CDO_CELL_BATCH_SIZE];
+  double  kappa[CS_HODGE_BATCH_MAX_EBYC*CS_CDO_CELL_BATCH_SIZE];
+  double  alpha[CS_HODGE_BATCH_MAX_EBYC*CS_HODGE_BATCH_MAX_EBYC
+                *CS_CDO_CELL_BATCH_SIZE];
+  double  hval[CS_HODGE_BATCH_MAX_EBYC*CS_HODGE_BATCH_MAX_EBYC
+               *CS_CDO_CELL_BATCH_SIZE];
+
+  /* Gather geometrical quantities. Unused slots of the batch are filled with
+     the quantities of the first cell so that all computations are valid */
+  for (int l = 0; l < bs; l++) {
+
+    const int  _l = (l < n_cells) ? l : 0;
+    const cs_cell_mesh_t  *cm = cbatch->cm[_l];
+
+    assert(cs_flag_test(cm->flag,
+                        CS_CDO_LOCAL_PV | CS_CDO_LOCAL_PEQ | CS_CDO_LOCAL_DFQ |
+                        CS_CDO_LOCAL_EV));
+    assert(cm->n_ec == n_ec);
+
+    invcvol[l] = 1/cm->vol_c;
+    ptyval[l] = (h_info.is_unity) ? 1.0 : cbatch->pty_val[_l];
+
+    for (int e = 0; e < n_ec; e++) {
+      const cs_nvec3_t  dfq = cm->dface[e];
+      const cs_quant_t  peq = cm->edge[e];
+      for (int k = 0; k < 3; k++) {
+        dq[(3*e+k)*bs + l] = dfq.meas * dfq.unitv[k];
+        pq[(3*e+k)*bs + l] = peq.meas * peq.unitv[k];
+      }
+    }
 
-    /* Compute extra-diag entries */
-    for (int ej = ei + 1; ej < cm->n_ec; ej++) { /* Loop on cell entities J */
+  } /* Loop on cells of the batch */
 
-      const int  shift_j = ej*cm->n_ec;
-      const double  *alpha_j = alpha + shift_j;
-      const short int  j1ej = cm->e2v_sgn[ej], j2ej = -j1ej;
-      const short int  j1 = cm->e2v_ids[2*ej];
-      const short int  j2 = cm->e2v_ids[2*ej+1];
+  /* Compute the quantities used in the COST algo. and initialize the local
+     Hodge matrices with the consistency part (see _compute_cost_quant_iso) */
+  for (int i = 0; i < n_ec; i++) {
 
-      double  *sj1 = sloc->val + j1*sloc->n_rows;
-      double  *sj2 = sloc->val + j2*sloc->n_rows;
+    const double  *dqi = dq + 3*i*bs, *pqi = pq + 3*i*bs;
 
-      /* Add contribution from the stabilization part for
-         each sub-volume related to a primal entity */
-      stab_part = 0;
-      for (int ek = 0; ek < cm->n_ec; ek++) /* Loop over sub-volumes */
-        stab_part += kappa[ek] * alpha_i[ek] * alpha_j[ek];
+#   pragma omp simd
+    for (int l = 0; l < bs; l++) {
 
-      /* Extra-diagonal value */
-      const double xval = hi[ej] + beta2 * stab_part;
+      const double  dsvol_i = dqi[l]*pqi[l] + dqi[bs+l]*pqi[bs+l]
+        + dqi[2*bs+l]*pqi[2*bs+l];
+      const double  qmq_ii = ptyval[l] * (dqi[l]*dqi[l] + dqi[bs+l]*dqi[bs+l]
+                                          + dqi[2*bs+l]*dqi[2*bs+l]);
 
-      /* Vertex i1 */
-      const double  val1 = xval * i1ei;
-      if (i1 == j1)
-        si1[j1] += 2*val1 * j1ej;
-      else if (i1 < j1)
-        si1[j1] += val1 * j1ej;
-      else
-        sj1[i1] += val1 * j1ej;
+      alpha[(i*n_ec + i)*bs + l] = 1 - invcvol[l] * dsvol_i;
+      hval[(i*n_ec + i)*bs + l] = invcvol[l] * qmq_ii;
+      kappa[i*bs + l] = 3. * qmq_ii / dsvol_i;
 
-      if (i1 == j2)
-        si1[j2] += 2*val1 * j2ej;
-      else if (i1 < j2)
-        si1[j2] += val1 * j2ej;
-      else
-        sj2[i1] += val1 * j2ej;
+    }
 
-      /* Vertex i2 */
-      const double  val2 = xval * i2ei;
-      if (i2 == j1)
-        si2[j1] += 2*val2 * j1ej;
-      else if (i2 < j1)
-        si2[j1] += val2 * j1ej;
-      else
-        sj1[i2] += val2 * j1ej;
+    for (int j = i+1; j < n_ec; j++) {
 
-      if (i2 == j2)
-        si2[j2] += 2*val2 * j2ej;
-      else if (i2 < j2)
-        si2[j2] += val2 * j2ej;
-      else
-        sj2[i2] += val2 * j2ej;
+      const double  *dqj = dq + 3*j*bs, *pqj = pq + 3*j*bs;
 
-    } /* End of loop on J entities */
+#     pragma omp simd
+      for (int l = 0; l < bs; l++) {
 
-  } /* End of loop on I entities */
+        const double  dqj_dqi = dqj[l]*dqi[l] + dqj[bs+l]*dqi[bs+l]
+          + dqj[2*bs+l]*dqi[2*bs+l];
+        const double  pqj_dqi = pqj[l]*dqi[l] + pqj[bs+l]*dqi[bs+l]
+          + pqj[2*bs+l]*dqi[2*bs+l];
+        const double  pqi_dqj = pqi[l]*dqj[l] + pqi[bs+l]*dqj[bs+l]
+          + pqi[2*bs+l]*dqj[2*bs+l];
 
-  /* Stiffness matrix is symmetric by construction */
-  for (int ei = 0; ei < sloc->n_rows; ei++) {
-    double *si = sloc->val + ei*sloc->n_rows;
-    for (int ej = 0; ej < ei; ej++)
-      si[ej] = sloc->val[ej*sloc->n_rows + ei];
-  }
+        hval[(i*n_ec + j)*bs + l] = invcvol[l] * ptyval[l] * dqj_dqi;
+        alpha[(i*n_ec + j)*bs + l] = -invcvol[l] * pqj_dqi;
+        alpha[(j*n_ec + i)*bs + l] = -invcvol[l] * pqi_dqj;
+
+      }
+
+    } /* Loop on entities (J) */
+
+  } /* Loop on entities (I) */
+
+  /* Add the stabilization part (upper part of the Hodge matrices) */
+  const double  beta2 = h_info.coef*h_info.coef;
+
+  for (int i = 0; i < n_ec; i++) {
+
+    const double  *alpha_i = alpha + i*n_ec*bs;
+
+    for (int j = i; j < n_ec; j++) {
+
+      const double  *alpha_j = alpha + j*n_ec*bs;
+
+      double  stab_part[CS_CDO_CELL_BATCH_SIZE];
+      for (int l = 0; l < bs; l++)
+        stab_part[l] = 0;
+
+      for (int k = 0; k < n_ec; k++) { /* Loop over sub-volumes */
+#       pragma omp simd
+        for (int l = 0; l < bs; l++)
+          stab_part[l] += kappa[k*bs + l]
+            * alpha_i[k*bs + l] * alpha_j[k*bs + l];
+      }
+
+#     pragma omp simd
+      for (int l = 0; l < bs; l++)
+        hval[(i*n_ec + j)*bs + l] += beta2 * stab_part[l];
+
+    } /* Loop on entities (J) */
+
+  } /* Loop on entities (I) */
+
+  /* Scatter the Hodge matrices into the local stiffness matrices */
+  double  *hloc = alpha; /* alpha is not used anymore */
+
+  for (int l = 0; l < n_cells; l++) {
+
+    const cs_cell_mesh_t  *cm = cbatch->cm[l];
+
+    for (int i = 0; i < n_ec; i++)
+      for (int j = i; j < n_ec; j++)
+        hloc[i*n_ec + j] = hval[(i*n_ec + j)*bs + l];
+
+    cs_sdm_t  *sloc = cbatch->loc[l];
+    cs_sdm_square_init(cm->n_vc, sloc);
+
+    _define_vb_stiffness(cm, hloc, sloc);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_HODGE_DBG > 1
-  if (cm->c_id % CS_HODGE_MODULO == 0) {
-    cs_log_printf(CS_LOG_DEFAULT, ">> Local stiffness matrix");
-    cs_sdm_dump(cm->c_id, NULL, NULL, sloc);
-    _check_stiffness(sloc);
-  }
+    if (cm->c_id % CS_HODGE_MODULO == 0) {
+      cs_log_printf(CS_LOG_DEFAULT, ">> Local stiffness matrix (batch)");
+      cs_sdm_dump(cm->c_id, NULL, NULL, sloc);
+      _check_stiffness(sloc);
+    }
 #endif
+
+  } /* Loop on cells of the batch */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2142,6 +2349,211 @@ cs_hodge_compute_wbs_surfacic(const cs_face_mesh_t    *fm,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Create a cache of cellwise operators (discrete Hodge operators or
+ *          stiffness matrices). The size of the operator related to a cell
+ *          is the number of entities of this cell given by the c2x adjacency
+ *          plus n_cell_dofs.
+ *
+ * \param[in]  c2x           pointer to a cell --> entities adjacency
+ * \param[in]  n_cell_dofs   number of additional DoFs attached to each cell
+ * \param[in]  use_float     store values in single precision
+ *
+ * \return a pointer to a new allocated cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_create(const cs_adjacency_t     *c2x,
+                      int                       n_cell_dofs,
+                      bool                      use_float)
+{
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cs_hodge_cache_t  *hc = NULL;
+
+  BFT_MALLOC(hc, 1, cs_hodge_cache_t);
+
+  hc->n_cells = n_cells;
+  hc->use_float = use_float;
+
+  BFT_MALLOC(hc->idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(hc->n_rows, n_cells, short int);
+
+  hc->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n = c2x->idx[c_id+1] - c2x->idx[c_id] + n_cell_dofs;
+    hc->idx[c_id+1] = hc->idx[c_id] + n*(n+1)/2;
+    hc->n_rows[c_id] = 0;
+  }
+
+  hc->dval = NULL;
+  hc->fval = NULL;
+  if (use_float)
+    BFT_MALLOC(hc->fval, hc->idx[n_cells], float);
+  else
+    BFT_MALLOC(hc->dval, hc->idx[n_cells], double);
+
+  /* Register this cache */
+  BFT_REALLOC(_hodge_caches, _n_hodge_caches + 1, cs_hodge_cache_t *);
+  _hodge_caches[_n_hodge_caches] = hc;
+  _n_hodge_caches += 1;
+
+  return hc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free a cs_hodge_cache_t structure
+ *
+ * \param[in, out]  hc    pointer to a cs_hodge_cache_t structure to free
+ *
+ * \return a NULL pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_free(cs_hodge_cache_t     *hc)
+{
+  if (hc == NULL)
+    return hc;
+
+  /* Unregister this cache */
+  int  j = 0;
+  for (int i = 0; i < _n_hodge_caches; i++) {
+    if (_hodge_caches[i] != hc)
+      _hodge_caches[j++] = _hodge_caches[i];
+  }
+  _n_hodge_caches = j;
+  if (_n_hodge_caches == 0)
+    BFT_FREE(_hodge_caches);
+
+  BFT_FREE(hc->idx);
+  BFT_FREE(hc->n_rows);
+  BFT_FREE(hc->dval);
+  BFT_FREE(hc->fval);
+
+  BFT_FREE(hc);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Invalidate all the operators stored in a cache. They are rebuilt
+ *          at their next request.
+ *
+ * \param[in, out]  hc    pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset(cs_hodge_cache_t     *hc)
+{
+  if (hc == NULL)
+    return;
+
+# pragma omp parallel for if (hc->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < hc->n_cells; c_id++)
+    hc->n_rows[c_id] = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Invalidate all the existing caches of cellwise operators.
+ *          This function has to be called when the mesh geometry or the
+ *          value of a property used to build a cached operator is modified.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset_all(void)
+{
+  for (int i = 0; i < _n_hodge_caches; i++)
+    cs_hodge_cache_reset(_hodge_caches[i]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Retrieve a local operator for a given cell from a cache. If this
+ *          operator is not cached yet, it is built with get_op and then
+ *          stored. If hc is NULL, get_op is simply called.
+ *          The operator is returned in op which should be the matrix of the
+ *          cell builder filled by get_op (cb->loc or cb->hdg).
+ *
+ * \param[in, out] hc        pointer to a cs_hodge_cache_t structure or NULL
+ * \param[in]      get_op    function used to build the local operator
+ * \param[in]      h_info    pointer to a cs_param_hodge_t structure
+ * \param[in]      cm        pointer to a cs_cell_mesh_t structure
+ * \param[in, out] cb        pointer to a cs_cell_builder_t structure
+ * \param[in, out] op        pointer to the local operator to set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_get(cs_hodge_cache_t         *hc,
+                   cs_hodge_t               *get_op,
+                   const cs_param_hodge_t    h_info,
+                   const cs_cell_mesh_t     *cm,
+                   cs_cell_builder_t        *cb,
+                   cs_sdm_t                 *op)
+{
+  if (hc == NULL) {
+    get_op(h_info, cm, cb);
+    return;
+  }
+
+  const cs_lnum_t  c_id = cm->c_id;
+  const cs_lnum_t  shift = hc->idx[c_id];
+
+  if (hc->n_rows[c_id] > 0) { /* Unpack the cached operator */
+
+    const int  n = hc->n_rows[c_id];
+
+    op->n_rows = op->n_cols = n;
+
+    cs_lnum_t  k = shift;
+    for (int i = 0; i < n; i++) {
+      double  *op_i = op->val + i*n;
+      if (hc->use_float) {
+        for (int j = i; j < n; j++, k++)
+          op_i[j] = op->val[j*n + i] = hc->fval[k];
+      }
+      else {
+        for (int j = i; j < n; j++, k++)
+          op_i[j] = op->val[j*n + i] = hc->dval[k];
+      }
+    }
+
+  }
+  else { /* Build the operator and pack it */
+
+    get_op(h_info, cm, cb);
+
+    const int  n = op->n_rows;
+
+    assert(op->n_rows == op->n_cols);
+    assert(n*(n+1)/2 == hc->idx[c_id+1] - shift);
+
+    cs_lnum_t  k = shift;
+    for (int i = 0; i < n; i++) {
+      const double  *op_i = op->val + i*n;
+      if (hc->use_float) {
+        for (int j = i; j < n; j++, k++)
+          hc->fval[k] = op_i[j];
+      }
+      else {
+        for (int j = i; j < n; j++, k++)
+          hc->dval[k] = op_i[j];
+      }
+    }
+
+    hc->n_rows[c_id] = n;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 #undef _dp3
@@ -64,6 +64,10 @@ typedef void
              const cs_cell_mesh_t     *cm,
              cs_cell_builder_t        *cb);
 
+/* Cache of cellwise operators built with a cs_hodge_t function */
+
+typedef struct _cs_hodge_cache_t  cs_hodge_cache_t;
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -119,6 +123,25 @@ cs_hodge_vb_cost_get_stiffness(const cs_param_hodge_t    h_info,
                                const cs_cell_mesh_t     *cm,
                                cs_cell_builder_t        *cb);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build the local stiffness matrices of a batch of cells sharing the
+ *          same type of element using the generic COST algo.
+ *          Case of CDO vertex-based schemes with an isotropic property.
+ *          Geometrical quantities and discrete Hodge operators are stored in
+ *          an interleaved way (the index of the cell in the batch runs
+ *          fastest) so that the computations are vectorized across the batch.
+ *          The computed matrices are stored in cbatch->loc
+ *
+ * \param[in]      h_info     pointer to a cs_param_hodge_t structure
+ * \param[in, out] cbatch     pointer to a cs_cell_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_vb_cost_get_stiffness_batch(const cs_param_hodge_t    h_info,
+                                     cs_cell_batch_t          *cbatch);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Build a local stiffness matrix using the Voronoi algorithm
@@ -360,6 +383,87 @@ void
 cs_hodge_compute_wbs_surfacic(const cs_face_mesh_t    *fm,
                               cs_sdm_t                *hf);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Create a cache of cellwise operators (discrete Hodge operators or
+ *          stiffness matrices). The size of the operator related to a cell
+ *          is the number of entities of this cell given by the c2x adjacency
+ *          plus n_cell_dofs.
+ *
+ * \param[in]  c2x           pointer to a cell --> entities adjacency
+ * \param[in]  n_cell_dofs   number of additional DoFs attached to each cell
+ * \param[in]  use_float     store values in single precision
+ *
+ * \return a pointer to a new allocated cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_create(const cs_adjacency_t     *c2x,
+                      int                       n_cell_dofs,
+                      bool                      use_float);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free a cs_hodge_cache_t structure
+ *
+ * \param[in, out]  hc    pointer to a cs_hodge_cache_t structure to free
+ *
+ * \return a NULL pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_free(cs_hodge_cache_t     *hc);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Invalidate all the operators stored in a cache. They are rebuilt
+ *          at their next request.
+ *
+ * \param[in, out]  hc    pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset(cs_hodge_cache_t     *hc);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Invalidate all the existing caches of cellwise operators.
+ *          This function has to be called when the mesh geometry or the
+ *          value of a property used to build a cached operator is modified.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset_all(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Retrieve a local operator for a given cell from a cache. If this
+ *          operator is not cached yet, it is built with get_op and then
+ *          stored. If hc is NULL, get_op is simply called.
+ *          The operator is returned in op which should be the matrix of the
+ *          cell builder filled by get_op (cb->loc or cb->hdg).
+ *
+ * \param[in, out] hc        pointer to a cs_hodge_cache_t structure or NULL
+ * \param[in]      get_op    function used to build the local operator
+ * \param[in]      h_info    pointer to a cs_param_hodge_t structure
+ * \param[in]      cm        pointer to a cs_cell_mesh_t structure
+ * \param[in, out] cb        pointer to a cs_cell_builder_t structure
+ * \param[in, out] op        pointer to the local operator to set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_get(cs_hodge_cache_t         *hc,
+                   cs_hodge_t               *get_op,
+                   const cs_param_hodge_t    h_info,
+                   const cs_cell_mesh_t     *cm,
+                   cs_cell_builder_t        *cb,
+                   cs_sdm_t                 *op);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -134,6 +134,22 @@ typedef struct {
 
 } cs_navsto_coupling_projection_t;
 
+/*! \struct cs_navsto_coupling_monolithic_t
+ *  \brief Set of parameters specific for solving the Navier-Stokes system with
+ *         a monolithic algorithm: velocity and pressure are solved at once
+ *         with a block-preconditioned Krylov solver
+ *
+ *  All equations are not always created. It depends on the choice of the model
+ */
+
+typedef struct {
+
+  cs_equation_t  *momentum; /*!< Momentum balance equation (vector-valued).
+                                 Its linear solver settings are used to
+                                 approximate the velocity block */
+
+} cs_navsto_coupling_monolithic_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
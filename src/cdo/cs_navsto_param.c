@@ -94,7 +94,14 @@ cs_navsto_param_coupling_name[CS_NAVSTO_N_COUPLINGS][CS_BASE_STRING_LEN] =
   { N_("Uzawa-Augmented Lagrangian coupling"),
     N_("Artificial compressibility algorithm"),
     N_("Artificial compressibility solved with the VPP_eps algorithm"),
-    N_("Incremental projection algorithm")
+    N_("Incremental projection algorithm"),
+    N_("Monolithic coupling with a block-preconditioned FGMRES")
+  };
+
+static const char
+cs_navsto_param_schur_name[CS_NAVSTO_N_SCHUR_APPROX][CS_BASE_STRING_LEN] =
+  { N_("diag(B diag(A)^-1 B^T)"),
+    N_("Pressure mass matrix scaled by 1/viscosity")
   };
 
 static const char _err_empty_nsp[] =
@@ -124,6 +131,7 @@ _get_momentum_param(cs_navsto_param_t    *nsp)
   case CS_NAVSTO_COUPLING_ARTIFICIAL_COMPRESSIBILITY:
   case CS_NAVSTO_COUPLING_ARTIFICIAL_COMPRESSIBILITY_VPP:
   case CS_NAVSTO_COUPLING_UZAWA:
+  case CS_NAVSTO_COUPLING_MONOLITHIC:
     return cs_equation_param_by_name("Momentum");
 
   case CS_NAVSTO_COUPLING_PROJECTION:
@@ -179,6 +187,9 @@ cs_navsto_param_create(cs_navsto_param_model_t        model,
   param->time_state = time_state;
   param->coupling = algo_coupling;
   param->gd_scale_coef = 1.0;    /* Default value if not set by the user */
+  param->sp_eps = 1e-8;
+  param->sp_max_iter = 200;
+  param->schur_approx = CS_NAVSTO_SCHUR_DIAG_INVERSE;
   param->qtype = CS_QUADRATURE_BARY;
 
   return param;
@@ -241,6 +252,7 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
       break;
 
     case CS_NAVSTO_COUPLING_PROJECTION:
+    case CS_NAVSTO_COUPLING_MONOLITHIC:
       cs_base_warn(__FILE__, __LINE__);
       bft_printf(" Trying to set the zeta parameter with the %s\n "
                  " although this will not have use in the algorithm.\n",
@@ -266,6 +278,28 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
     }
     break;
 
+  case CS_NSKEY_SCHUR_APPROX:
+    if (strcmp(val, "diag_inverse") == 0)
+      nsp->schur_approx = CS_NAVSTO_SCHUR_DIAG_INVERSE;
+    else if (strcmp(val, "mass_scaled") == 0)
+      nsp->schur_approx = CS_NAVSTO_SCHUR_MASS_SCALED;
+    else {
+      const char *_val = val;
+      bft_error(__FILE__, __LINE__, 0,
+                _(" %s: Invalid val %s related to key CS_NSKEY_SCHUR_APPROX\n"
+                  " Choice between \"diag_inverse\" or \"mass_scaled\"."),
+                __func__, _val);
+    }
+    break;
+
+  case CS_NSKEY_SP_EPS:
+    nsp->sp_eps = atof(val);
+    break;
+
+  case CS_NSKEY_SP_MAX_ITER:
+    nsp->sp_max_iter = atoi(val);
+    break;
+
   case CS_NSKEY_SPACE_SCHEME:
     if (strcmp(val, "cdo_fb") == 0) {
       nsp->space_scheme = CS_SPACE_SCHEME_CDOFB;
@@ -461,6 +495,12 @@ cs_navsto_param_log(const cs_navsto_param_t    *nsp)
                 cs_navsto_param_time_state_name[nsp->time_state]);
   cs_log_printf(CS_LOG_SETUP, " <NavSto/Coupling> %s\n",
                 cs_navsto_param_coupling_name[nsp->coupling]);
+  if (nsp->coupling == CS_NAVSTO_COUPLING_MONOLITHIC) {
+    cs_log_printf(CS_LOG_SETUP, " <NavSto/Saddle-point> FGMRES eps: %5.3e;"
+                  " max. iter: %d\n", nsp->sp_eps, nsp->sp_max_iter);
+    cs_log_printf(CS_LOG_SETUP, " <NavSto/Schur approx.> %s\n",
+                  cs_navsto_param_schur_name[nsp->schur_approx]);
+  }
   cs_log_printf(CS_LOG_SETUP, " <NavSto/Gravity effect> %s",
                 cs_base_strtf(nsp->has_gravity));
   if (nsp->has_gravity)
@@ -512,6 +552,7 @@ cs_navsto_param_get_coupling_name(cs_navsto_param_coupling_t  coupling)
   case CS_NAVSTO_COUPLING_ARTIFICIAL_COMPRESSIBILITY_VPP:
   case CS_NAVSTO_COUPLING_UZAWA:
   case CS_NAVSTO_COUPLING_PROJECTION:
+  case CS_NAVSTO_COUPLING_MONOLITHIC:
     return cs_navsto_param_coupling_name[coupling];
 
   default:
@@ -116,6 +116,13 @@ typedef enum {
  *
  * \var CS_NAVSTO_COUPLING_PROJECTION
  * The system is solved using an incremental projection algorithm
+ *
+ * \var CS_NAVSTO_COUPLING_MONOLITHIC
+ * The velocity-pressure saddle-point system is solved at once with a
+ * flexible GMRES algorithm and a block-triangular preconditioner. The
+ * velocity block is approximated by the linear solver attached to the
+ * momentum equation (multigrid by default) and the pressure block by an
+ * approximation of the Schur complement.
  */
 
 typedef enum {
@@ -124,11 +131,34 @@ typedef enum {
   CS_NAVSTO_COUPLING_ARTIFICIAL_COMPRESSIBILITY,
   CS_NAVSTO_COUPLING_ARTIFICIAL_COMPRESSIBILITY_VPP,
   CS_NAVSTO_COUPLING_PROJECTION,
+  CS_NAVSTO_COUPLING_MONOLITHIC,
 
   CS_NAVSTO_N_COUPLINGS
 
 } cs_navsto_param_coupling_t;
 
+/*! \enum cs_navsto_param_schur_approx_t
+ *  \brief Approximation of the Schur complement used to precondition the
+ *         pressure block when a monolithic coupling is used
+ *
+ * \var CS_NAVSTO_SCHUR_DIAG_INVERSE
+ * The Schur complement is approximated by B diag(A)^-1 B^T restricted to its
+ * diagonal, where A is the velocity block and B the discrete divergence
+ *
+ * \var CS_NAVSTO_SCHUR_MASS_SCALED
+ * The Schur complement is approximated by the pressure mass matrix (lumped
+ * on cells) scaled by the inverse of the laminar viscosity
+ */
+
+typedef enum {
+
+  CS_NAVSTO_SCHUR_DIAG_INVERSE,
+  CS_NAVSTO_SCHUR_MASS_SCALED,
+
+  CS_NAVSTO_N_SCHUR_APPROX
+
+} cs_navsto_param_schur_approx_t;
+
 /*! \struct cs_navsto_param_t
  *  \brief Structure storing the parameters related to the resolution of the
  *         Navier-Stokes system
@@ -189,6 +219,23 @@ typedef struct {
    */
   cs_real_t                     gd_scale_coef;
 
+  /*!
+   * \var sp_eps
+   * Relative tolerance of the flexible GMRES algorithm used to solve the
+   * saddle-point system (only with a monolithic coupling)
+   *
+   * \var sp_max_iter
+   * Max. number of iterations of the flexible GMRES algorithm used to solve
+   * the saddle-point system (only with a monolithic coupling)
+   *
+   * \var schur_approx
+   * Approximation of the Schur complement used to precondition the pressure
+   * block (only with a monolithic coupling)
+   */
+  double                          sp_eps;
+  int                             sp_max_iter;
+  cs_navsto_param_schur_approx_t  schur_approx;
+
   /*! \var qtype
    *  A \ref cs_quadrature_type_t indicating the type of quadrature to use in
    *  all routines involving quadratures
@@ -214,6 +261,19 @@ typedef struct {
  * Set the type to use in all routines involving quadrature (similar to \ref
  * CS_EQKEY_BC_QUADRATURE)
  *
+ * \var CS_NSKEY_SCHUR_APPROX
+ * Approximation of the Schur complement used in the block preconditioner of
+ * the monolithic coupling
+ * - "diag_inverse" (default) or "mass_scaled"
+ *
+ * \var CS_NSKEY_SP_EPS
+ * Relative tolerance of the saddle-point solver (monolithic coupling)
+ * - Example: "1e-8"
+ *
+ * \var CS_NSKEY_SP_MAX_ITER
+ * Max. number of iterations of the saddle-point solver (monolithic coupling)
+ * - Example: "200"
+ *
  * \var CS_NSKEY_SPACE_SCHEME
  * Numerical scheme for the space discretization
  *
@@ -235,6 +295,9 @@ typedef enum {
   CS_NSKEY_DOF_REDUCTION,
   CS_NSKEY_GD_SCALE_COEF,
   CS_NSKEY_QUADRATURE,
+  CS_NSKEY_SCHUR_APPROX,
+  CS_NSKEY_SP_EPS,
+  CS_NSKEY_SP_MAX_ITER,
   CS_NSKEY_SPACE_SCHEME,
   CS_NSKEY_TIME_SCHEME,
   CS_NSKEY_TIME_THETA,
@@ -808,6 +808,145 @@ _projection_last_setup(const cs_cdo_connect_t     *connect,
   /* TODO */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate and initialize a context structure when the Navier-Stokes
+ *         system is coupled using a monolithic approach
+ *
+ * \param[in]  nsp    pointer to a cs_navsto_param_t structure
+ *
+ * \return a pointer to the context structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void *
+_create_monolithic_context(cs_navsto_param_t    *nsp)
+{
+  assert(nsp != NULL);
+  CS_UNUSED(nsp);
+
+  cs_navsto_coupling_monolithic_t  *nsc = NULL;
+
+  BFT_MALLOC(nsc, 1, cs_navsto_coupling_monolithic_t);
+
+  nsc->momentum = cs_equation_add("Momentum",
+                                  "velocity",
+                                  CS_EQUATION_TYPE_PREDEFINED,
+                                  3,
+                                  CS_PARAM_BC_HMG_DIRICHLET);
+
+  /* Set the default solver settings. The linear solver attached to the
+     momentum equation is used as an inexact solver for the velocity block
+     inside the saddle-point preconditioner */
+  {
+    cs_equation_param_t  *eqp = cs_equation_get_param(nsc->momentum);
+
+    cs_equation_set_param(eqp, CS_EQKEY_ITSOL, "amg");
+    cs_equation_set_param(eqp, CS_EQKEY_ITSOL_EPS, "1e-2");
+  }
+
+  return nsc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the context structure related to a monolithic approach
+ *
+ * \param[in]      nsp      pointer to a cs_navsto_param_t structure
+ * \param[in, out] context  pointer to a context structure cast on-the-fly
+ *
+ * \return a NULL pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void *
+_free_monolithic_context(const cs_navsto_param_t    *nsp,
+                         void                       *context)
+{
+  assert(nsp != NULL);
+  CS_UNUSED(nsp);
+
+  cs_navsto_coupling_monolithic_t  *nsc =
+    (cs_navsto_coupling_monolithic_t *)context;
+
+  BFT_FREE(nsc);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Start setting-up the Navier-Stokes equations when a monolithic
+ *         algorithm is used to coupled the system
+ *         No mesh information is available
+ *
+ * \param[in, out] ns       pointer to a cs_navsto_system_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_monolithic_init_setup(cs_navsto_system_t         *ns)
+{
+  assert(ns != NULL);
+
+  cs_navsto_param_t  *nsp = ns->param;
+  cs_navsto_coupling_monolithic_t  *nsc =
+    (cs_navsto_coupling_monolithic_t *)ns->context;
+
+  assert(nsp != NULL && nsc != NULL);
+
+  cs_equation_param_t  *mom_eqp = cs_equation_get_param(nsc->momentum);
+
+  /* Navier-Stokes parameters induce numerical settings for the related
+   equations */
+  _apply_param(nsp, mom_eqp);
+
+  /* Link the time property to the momentum equation */
+  switch (nsp->time_state) {
+
+  case CS_NAVSTO_TIME_STATE_UNSTEADY:
+  case CS_NAVSTO_TIME_STATE_LIMIT_STEADY:
+    cs_equation_add_time(mom_eqp, cs_property_by_name("unity"));
+    break;
+
+  default:
+    break; /* Stokes-like system: the velocity block is a diffusion one */
+  }
+
+  /* All considered models needs a viscous term */
+  cs_equation_add_diffusion(mom_eqp, ns->lami_viscosity);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Finalize the setup for the Navier-Stokes equations when a
+ *         monolithic algorithm is used to coupled the system
+ *
+ * \param[in]      connect  pointer to a cs_cdo_connect_t structure
+ * \param[in]      quant    pointer to a cs_cdo_quantities_t structure
+ * \param[in, out] ns       pointer to a cs_navsto_system_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_monolithic_last_setup(const cs_cdo_connect_t     *connect,
+                       const cs_cdo_quantities_t  *quant,
+                       cs_navsto_system_t         *ns)
+{
+  CS_UNUSED(connect);
+  CS_UNUSED(quant);
+  assert(ns != NULL);
+
+  cs_navsto_param_t  *nsp = ns->param;
+
+  assert(nsp != NULL && ns->context != NULL);
+
+  if (nsp->sp_max_iter < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid max. number of iterations (%d) for the"
+              " saddle-point solver.", __func__, nsp->sp_max_iter);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize the face values for the velocity unknowns (in case of
@@ -849,6 +988,10 @@ _init_face_velocity_values(cs_real_t    t_eval)
       ((cs_navsto_coupling_projection_t*)navsto->context)->prediction;
     break;
 
+  case CS_NAVSTO_COUPLING_MONOLITHIC:
+    first_eq = ((cs_navsto_coupling_monolithic_t*)navsto->context)->momentum;
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0, _err_invalid_coupling, __func__);
     break;
@@ -990,6 +1133,10 @@ cs_navsto_system_activate(cs_navsto_param_model_t        model,
     navsto->context = _create_projection_context(navsto->param);
     break;
 
+  case CS_NAVSTO_COUPLING_MONOLITHIC:
+    navsto->context = _create_monolithic_context(navsto->param);
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0, _err_invalid_coupling, __func__);
     return NULL;
@@ -1061,6 +1208,10 @@ cs_navsto_system_destroy(void)
     navsto->context = _free_projection_context(nsp, navsto->context);
     break;
 
+  case CS_NAVSTO_COUPLING_MONOLITHIC:
+    navsto->context = _free_monolithic_context(nsp, navsto->context);
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0, _err_invalid_coupling, __func__);
     break;
@@ -1170,6 +1321,10 @@ cs_navsto_system_init_setup(void)
     _projection_init_setup(navsto);
     break;
 
+  case CS_NAVSTO_COUPLING_MONOLITHIC:
+    _monolithic_init_setup(navsto);
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0, _err_invalid_coupling, __func__);
     break;
@@ -1248,6 +1403,13 @@ cs_navsto_system_finalize_setup(const cs_cdo_connect_t     *connect,
         _projection_last_setup(connect, quant, navsto);
         break;
 
+      case CS_NAVSTO_COUPLING_MONOLITHIC:
+        navsto->init = cs_cdofb_navsto_init_monolithic_context;
+        navsto->compute = cs_cdofb_navsto_monolithic_compute;
+
+        _monolithic_last_setup(connect, quant, navsto);
+        break;
+
       default:
         bft_error(__FILE__, __LINE__, 0, _err_invalid_coupling, __func__);
         break;
@@ -1283,6 +1445,10 @@ cs_navsto_system_finalize_setup(const cs_cdo_connect_t     *connect,
         _projection_last_setup(connect, quant, navsto);
         break;
 
+      case CS_NAVSTO_COUPLING_MONOLITHIC:
+        _monolithic_last_setup(connect, quant, navsto);
+        break;
+
       default:
         bft_error(__FILE__, __LINE__, 0, _err_invalid_coupling, __func__);
         break;
@@ -107,6 +107,28 @@ typedef struct {
 
 } cs_param_hodge_t;
 
+typedef enum {
+
+  CS_PARAM_HODGE_CACHE_NONE,   // local operators are rebuilt at each build
+  CS_PARAM_HODGE_CACHE_DOUBLE, // local operators are cached (double precision)
+  CS_PARAM_HODGE_CACHE_FLOAT,  // local operators are cached (single precision)
+  CS_PARAM_N_HODGE_CACHES
+
+} cs_param_hodge_cache_t;
+
+/* BUILD OF THE CELLWISE SYSTEMS */
+/* ============================= */
+
+typedef enum {
+
+  CS_PARAM_CDO_BUILD_CELLWISE, // cells are processed one by one
+  CS_PARAM_CDO_BUILD_BATCHED,  /* cells of the same type are gathered by
+                                  batches and local operators are computed
+                                  simultaneously for all cells of a batch */
+  CS_PARAM_CDO_N_BUILD_MODES
+
+} cs_param_cdo_build_t;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
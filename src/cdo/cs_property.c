@@ -474,6 +474,15 @@ cs_property_finalize_setup(void)
                 " %s: Property \"%s\" exists with no definition.",
                 __func__, pty->name);
 
+    /* A property is steady if all its definitions are steady */
+    bool  is_steady = true;
+    for (int id = 0; id < pty->n_definitions; id++)
+      if (!(pty->defs[id]->state & CS_FLAG_STATE_STEADY))
+        is_steady = false;
+
+    if (is_steady)
+      pty->state_flag |= CS_FLAG_STATE_STEADY;
+
   } /* Loop on properties */
 
 }
@@ -1241,7 +1250,7 @@ cs_property_log_setup(void)
 
   for (int i = 0; i < _n_properties; i++) {
 
-    bool  is_uniform = false, is_steady = true;
+    bool  is_uniform = false, is_steady = false;
     const cs_property_t  *pty = _properties[i];
 
     if (pty->state_flag & CS_FLAG_STATE_UNIFORM)  is_uniform = true;
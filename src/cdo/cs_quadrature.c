@@ -478,6 +478,124 @@ cs_quadrature_tet_15pts(const cs_real_3_t   v1,
   weights[14] = vol * _tetr_quad15w4;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize a batch of quadrature points on tetrahedra
+ *
+ * \param[in]      qtype     quadrature type
+ * \param[in]      dim       dimension of the function to integrate
+ * \param[in]      t_eval    physical time at which one evaluates the function
+ * \param[in]      ana       pointer to the analytic function
+ * \param[in]      input     NULL or pointer to a structure cast on-the-fly
+ * \param[in, out] batch     pointer to the batch to initialize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_batch_init(cs_quadrature_type_t         qtype,
+                             int                          dim,
+                             cs_real_t                    t_eval,
+                             cs_analytic_func_t          *ana,
+                             void                        *input,
+                             cs_quadrature_tet_batch_t   *batch)
+{
+  assert(batch != NULL);
+
+  if (dim != 1 && dim != 3 && dim != 9)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid dimension value %d. Only 1, 3 and 9 are valid.\n",
+              __func__, dim);
+
+  batch->t_eval = t_eval;
+  batch->ana = ana;
+  batch->input = input;
+  batch->dim = dim;
+  batch->n_tets = 0;
+
+  /* Same rules as the ones used by cs_quadrature_get_tetra_integral() */
+  switch (qtype) {
+
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+    batch->n_pts = 1;
+    batch->rule = cs_quadrature_tet_1pt;
+    break;
+  case CS_QUADRATURE_HIGHER:
+    batch->n_pts = 4;
+    batch->rule = cs_quadrature_tet_4pts;
+    break;
+  case CS_QUADRATURE_HIGHEST:
+    batch->n_pts = 5;
+    batch->rule = cs_quadrature_tet_5pts;
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid quadrature type\n", __func__);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate the analytic function at once on all the points gathered
+ *         in the batch and add the contribution of each tetrahedron to the
+ *         related entry of \p results. The batch is then emptied.
+ *
+ * \param[in, out] batch     pointer to the batch to flush
+ * \param[in, out] results   array of values (stride = batch->dim)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_batch_flush(cs_quadrature_tet_batch_t   *batch,
+                              double                       results[])
+{
+  if (batch->n_tets == 0)
+    return;
+
+  const int  n_pts = batch->n_pts;
+  const int  dim = batch->dim;
+
+  batch->ana(batch->t_eval, batch->n_tets*n_pts, NULL,
+             (const cs_real_t *)batch->gpts, false, batch->input,
+             batch->evals);
+
+  /* Reduction: same summation order as the tetra integral functions */
+  if (dim == 1) {
+
+    for (int t = 0; t < batch->n_tets; t++) {
+
+      const double  *w = batch->weights + t*n_pts;
+      const double  *f = batch->evals + t*n_pts;
+
+      double  contrib = w[0]*f[0];
+      for (int p = 1; p < n_pts; p++)
+        contrib += w[p]*f[p];
+
+      results[batch->ids[t]] += contrib;
+
+    }
+
+  }
+  else {
+
+    for (int t = 0; t < batch->n_tets; t++) {
+
+      const double  *w = batch->weights + t*n_pts;
+      const double  *f = batch->evals + t*n_pts*dim;
+      double  *_r = results + dim*batch->ids[t];
+
+      for (int p = 0; p < n_pts; p++)
+        for (int k = 0; k < dim; k++)
+          _r[k] += w[p]*f[dim*p+k];
+
+    }
+
+  }
+
+  batch->n_tets = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
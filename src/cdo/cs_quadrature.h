@@ -44,6 +44,11 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Max. number of quadrature points gathered in a batch before the analytic
+   function is called (multiple of 1, 4, 5 and 15) */
+
+#define CS_QUADRATURE_BATCH_SIZE  240
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -202,6 +207,32 @@ typedef void
                                  void                  *input,
                                  double                 results[]);
 
+/*! \struct cs_quadrature_tet_batch_t
+ *  \brief  Buffer gathering the quadrature points of several tetrahedra so
+ *          that an analytic function is evaluated once for all of them.
+ *          Each tetrahedron contributes to the entry \ref ids of the array
+ *          of results (of stride \ref dim).
+ */
+
+typedef struct {
+
+  /* Settings */
+  cs_real_t               t_eval;   /*!< time at which the function is called */
+  cs_analytic_func_t     *ana;      /*!< analytic function */
+  void                   *input;    /*!< NULL or pointer cast on-the-fly */
+  int                     dim;      /*!< dimension of the function */
+  int                     n_pts;    /*!< number of points per tetrahedron */
+  cs_quadrature_tet_t    *rule;     /*!< quadrature rule on a tetrahedron */
+
+  /* Current content */
+  int                     n_tets;   /*!< number of stored tetrahedra */
+  cs_lnum_t               ids[CS_QUADRATURE_BATCH_SIZE];
+  cs_real_3_t             gpts[CS_QUADRATURE_BATCH_SIZE];
+  double                  weights[CS_QUADRATURE_BATCH_SIZE];
+  double                  evals[9*CS_QUADRATURE_BATCH_SIZE];
+
+} cs_quadrature_tet_batch_t;
+
 
 /*============================================================================
  * Public function prototypes
@@ -491,6 +522,79 @@ cs_quadrature_tet_15pts(const cs_real_3_t   v1,
                         cs_real_3_t         gpts[],
                         double              weights[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize a batch of quadrature points on tetrahedra
+ *
+ * \param[in]      qtype     quadrature type
+ * \param[in]      dim       dimension of the function to integrate
+ * \param[in]      t_eval    physical time at which one evaluates the function
+ * \param[in]      ana       pointer to the analytic function
+ * \param[in]      input     NULL or pointer to a structure cast on-the-fly
+ * \param[in, out] batch     pointer to the batch to initialize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_batch_init(cs_quadrature_type_t         qtype,
+                             int                          dim,
+                             cs_real_t                    t_eval,
+                             cs_analytic_func_t          *ana,
+                             void                        *input,
+                             cs_quadrature_tet_batch_t   *batch);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate the analytic function at once on all the points gathered
+ *         in the batch and add the contribution of each tetrahedron to the
+ *         related entry of \p results. The batch is then emptied.
+ *
+ * \param[in, out] batch     pointer to the batch to flush
+ * \param[in, out] results   array of values (stride = batch->dim)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_batch_flush(cs_quadrature_tet_batch_t   *batch,
+                              double                       results[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add the quadrature points of a tetrahedron to a batch. The batch is
+ *         flushed into \p results before if there is not enough room left.
+ *
+ * \param[in]      v1        first point of the tetrahedron
+ * \param[in]      v2        second point of the tetrahedron
+ * \param[in]      v3        third point of the tetrahedron
+ * \param[in]      v4        fourth point of the tetrahedron
+ * \param[in]      vol       volume of the tetrahedron
+ * \param[in]      id        id of the entry in \p results to update
+ * \param[in, out] batch     pointer to a batch structure
+ * \param[in, out] results   array of values (stride = batch->dim)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_quadrature_tet_batch_add(const cs_real_3_t            v1,
+                            const cs_real_3_t            v2,
+                            const cs_real_3_t            v3,
+                            const cs_real_3_t            v4,
+                            double                       vol,
+                            cs_lnum_t                    id,
+                            cs_quadrature_tet_batch_t   *batch,
+                            double                       results[])
+{
+  if ((batch->n_tets + 1)*batch->n_pts > CS_QUADRATURE_BATCH_SIZE)
+    cs_quadrature_tet_batch_flush(batch, results);
+
+  const int  shift = batch->n_tets * batch->n_pts;
+
+  batch->rule(v1, v2, v3, v4, vol,
+              batch->gpts + shift, batch->weights + shift);
+  batch->ids[batch->n_tets] = id;
+  batch->n_tets += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the integral over an edge with the mid-point rule and add
@@ -1912,8 +1912,12 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
     const cs_real_t *xv = cm->xv;
 
     double  cell_values  = 0.0;
-    cs_quadrature_tetra_integral_t  *qfunc =
-      cs_quadrature_get_tetra_integral(1, source->qtype);
+    cs_quadrature_tet_batch_t  batch;
+
+    /* Gather all the quadrature points of the cell to evaluate the analytic
+       function once (unless the batch is full) */
+    cs_quadrature_tet_batch_init(source->qtype, 1, time_eval,
+                                 anai->func, anai->input, &batch);
 
     /* Switch according to the cell type: optimised version for tetra */
     switch (cm->type) {
@@ -1921,9 +1925,8 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
     case FVM_CELL_TETRA:
       {
         assert(cm->n_fc == 4 && cm->n_vc == 4);
-        qfunc(time_eval, xv, xv+3, xv+6, xv+9, cm->vol_c,
-              anai->func, anai->input,
-              &cell_values);
+        cs_quadrature_tet_batch_add(xv, xv+3, xv+6, xv+9, cm->vol_c, 0,
+                                    &batch, &cell_values);
       }
       break;
 
@@ -1950,10 +1953,9 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
             cs_cell_mesh_get_next_3_vertices(f2e_ids, cm->e2v_ids,
                                              &v0, &v1, &v2);
 
-            qfunc(time_eval, cm->xc, xv+3*v0, xv+3*v1, xv+3*v2,
-                  hf_coef*pfq.meas,
-                  anai->func, anai->input,
-                  &cell_values);
+            cs_quadrature_tet_batch_add(cm->xc, xv+3*v0, xv+3*v1, xv+3*v2,
+                                        hf_coef*pfq.meas, 0,
+                                        &batch, &cell_values);
           }
           break;
 
@@ -1968,8 +1970,9 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
               const double  *xv0 = xv + 3*cm->e2v_ids[2*e0];
               const double  *xv1 = xv + 3*cm->e2v_ids[2*e0+1];
 
-              qfunc(time_eval, cm->xc, pfq.center, xv0, xv1,
-                    hf_coef*tef[e], anai->func, anai->input, &cell_values);
+              cs_quadrature_tet_batch_add(cm->xc, pfq.center, xv0, xv1,
+                                          hf_coef*tef[e], 0,
+                                          &batch, &cell_values);
             }
           }
           break;
@@ -1987,6 +1990,8 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
 
     } /* End of switch on the cell-type */
 
+    cs_quadrature_tet_batch_flush(&batch, &cell_values);
+
     values[cm->n_fc] += cell_values;
 
   }  /* If not a barycentric quadrature */
@@ -2109,7 +2114,6 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
 {
   CS_UNUSED(cb);
   CS_UNUSED(input);
-  CS_UNUSED(time_eval);
 
   if (source == NULL)
     return;
@@ -2132,8 +2136,12 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
     const cs_real_t *xv = cm->xv;
 
     cs_real_3_t  cell_values = {0.0, 0.0, 0.0};
-    cs_quadrature_tetra_integral_t  *qfunc =
-      cs_quadrature_get_tetra_integral(3, source->qtype);
+    cs_quadrature_tet_batch_t  batch;
+
+    /* Gather all the quadrature points of the cell to evaluate the analytic
+       function once (unless the batch is full) */
+    cs_quadrature_tet_batch_init(source->qtype, 3, time_eval,
+                                 anai->func, anai->input, &batch);
 
     /* Switch according to the cell type: optimized version for tetra */
     switch (cm->type) {
@@ -2141,9 +2149,8 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
     case FVM_CELL_TETRA:
       {
         assert(cm->n_fc == 4 && cm->n_vc == 4);
-        qfunc(time_eval, xv, xv+3, xv+6, xv+9, cm->vol_c,
-              anai->func, anai->input,
-              cell_values);
+        cs_quadrature_tet_batch_add(xv, xv+3, xv+6, xv+9, cm->vol_c, 0,
+                                    &batch, cell_values);
       }
       break;
 
@@ -2170,10 +2177,9 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
             cs_cell_mesh_get_next_3_vertices(f2e_ids, cm->e2v_ids,
                                              &v0, &v1, &v2);
 
-            qfunc(time_eval, cm->xc, xv+3*v0, xv+3*v1, xv+3*v2,
-                  hf_coef*pfq.meas,
-                  anai->func, anai->input,
-                  cell_values);
+            cs_quadrature_tet_batch_add(cm->xc, xv+3*v0, xv+3*v1, xv+3*v2,
+                                        hf_coef*pfq.meas, 0,
+                                        &batch, cell_values);
           }
           break;
 
@@ -2188,10 +2194,9 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
               const double  *xv0 = xv + 3*cm->e2v_ids[2*e0];
               const double  *xv1 = xv + 3*cm->e2v_ids[2*e0+1];
 
-              qfunc(time_eval, cm->xc, pfq.center, xv0, xv1,
-                    hf_coef*tef[e],
-                    anai->func, anai->input,
-                    cell_values);
+              cs_quadrature_tet_batch_add(cm->xc, pfq.center, xv0, xv1,
+                                          hf_coef*tef[e], 0,
+                                          &batch, cell_values);
             }
           }
           break;
@@ -2209,6 +2214,8 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
 
     } /* End of switch on the cell-type */
 
+    cs_quadrature_tet_batch_flush(&batch, cell_values);
+
     cs_real_t *c_val = values + 3*cm->n_fc;
     c_val[0] += cell_values[0];
     c_val[1] += cell_values[1];
@@ -0,0 +1,1335 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to XDMF files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+#include "fvm_convert_array.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_file.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_xdmf.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Description of an exported mesh
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char        *name;               /* Mesh name */
+  char        *xml;                /* Topology and geometry description */
+
+  cs_gnum_t    n_g_vertices;       /* Global number of vertices */
+  cs_gnum_t    n_g_elements;       /* Global number of elements */
+
+} _xdmf_mesh_t;
+
+/*----------------------------------------------------------------------------
+ * Description of a grid (mesh and fields) at a given time step
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int          mesh_id;            /* Associated mesh id */
+  char        *mesh_xml;           /* Topology and geometry description */
+  char        *xml;                /* Attributes description */
+
+} _xdmf_grid_t;
+
+/*----------------------------------------------------------------------------
+ * Description of a time step
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int            nt;               /* Time step */
+  double         t;                /* Time value */
+
+  int            n_grids;          /* Number of grids */
+  _xdmf_grid_t  *grids;            /* Grids */
+
+} _xdmf_step_t;
+
+/*----------------------------------------------------------------------------
+ * XDMF writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char          *name;             /* Writer name */
+  char          *path;             /* Path prefix */
+
+  int            rank;             /* Rank of current process in communicator */
+  int            n_ranks;          /* Number of processes in communicator */
+
+  int            nt;               /* Current time step */
+  double         t;                /* Current time value */
+
+  int            n_meshes;         /* Number of exported meshes */
+  _xdmf_mesh_t  *meshes;           /* Exported meshes */
+
+  int            n_steps;          /* Number of time steps */
+  _xdmf_step_t  *steps;            /* Time steps */
+
+  bool           modified;         /* Is metadata file out of date ? */
+
+  char          *bin_name;         /* Current binary file name (no path) */
+  cs_file_t     *f;                /* Current binary file */
+  int            f_nt;             /* Time step associated with binary file */
+  int            f_part;           /* Part number of binary file for this
+                                      time step (if reopened after flush) */
+  cs_file_off_t  offset;           /* Current offset in binary file */
+
+#if defined(HAVE_MPI)
+  MPI_Comm       comm;             /* Associated MPI communicator */
+#endif
+
+} fvm_to_xdmf_writer_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* XDMF mixed topology element type codes */
+
+static const int  _xdmf_elt_type[] = {2,    /* FVM_EDGE */
+                                      4,    /* FVM_FACE_TRIA */
+                                      5,    /* FVM_FACE_QUAD */
+                                      3,    /* FVM_FACE_POLY */
+                                      6,    /* FVM_CELL_TETRA */
+                                      7,    /* FVM_CELL_PYRAM */
+                                      8,    /* FVM_CELL_PRISM */
+                                      9,    /* FVM_CELL_HEXA */
+                                      16};  /* FVM_CELL_POLY */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Append formatted text to a dynamically allocated string.
+ *
+ * parameters:
+ *   s      <-> pointer to string (allocated or reallocated as needed)
+ *   format <-- format string, as in printf
+ *   ...    <-- associated arguments
+ *----------------------------------------------------------------------------*/
+
+static void
+_append(char        **s,
+        const char   *format,
+        ...)
+{
+  va_list  arg_ptr;
+
+  size_t l0 = (*s != NULL) ? strlen(*s) : 0;
+
+  va_start(arg_ptr, format);
+  int l1 = vsnprintf(NULL, 0, format, arg_ptr);
+  va_end(arg_ptr);
+
+  BFT_REALLOC(*s, l0 + l1 + 1, char);
+
+  va_start(arg_ptr, format);
+  vsnprintf(*s + l0, l1 + 1, format, arg_ptr);
+  va_end(arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Append a name to a dynamically allocated string, escaping characters
+ * reserved in XML attribute values.
+ *
+ * parameters:
+ *   s    <-> pointer to string (allocated or reallocated as needed)
+ *   name <-- name to append
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_name(char        **s,
+             const char   *name)
+{
+  for (const char *c = name; *c != '\0'; c++) {
+    switch (*c) {
+    case '&':
+      _append(s, "&amp;");
+      break;
+    case '<':
+      _append(s, "&lt;");
+      break;
+    case '>':
+      _append(s, "&gt;");
+      break;
+    case '"':
+      _append(s, "&quot;");
+      break;
+    default:
+      _append(s, "%c", *c);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Append a binary DataItem element referring to the current binary file.
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   s         <-> pointer to string (allocated or reallocated as needed)
+ *   indent    <-- indentation
+ *   datatype  <-- data type
+ *   n         <-- number of rows
+ *   dim       <-- number of columns (0 for 1-d arrays)
+ *   seek      <-- offset of data in binary file
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_data_item(const fvm_to_xdmf_writer_t  *w,
+                  char                       **s,
+                  const char                  *indent,
+                  cs_datatype_t                datatype,
+                  cs_gnum_t                    n,
+                  int                          dim,
+                  cs_file_off_t                seek)
+{
+  const char *number_type = "Float";
+  int precision = cs_datatype_size[datatype];
+
+  if (datatype == CS_INT32 || datatype == CS_INT64)
+    number_type = "Int";
+  else if (datatype == CS_UINT32 || datatype == CS_UINT64)
+    number_type = "UInt";
+
+  int int_endian = 0;
+  *((char *)(&int_endian)) = '\1';
+  const char *endian = (int_endian == 1) ? "Little" : "Big";
+
+  _append(s, "%s<DataItem Dimensions=\"%llu", indent, (unsigned long long)n);
+  if (dim > 0)
+    _append(s, " %d", dim);
+  _append(s,
+          "\" NumberType=\"%s\" Precision=\"%d\" Format=\"Binary\""
+          " Endian=\"%s\" Seek=\"%llu\">",
+          number_type, precision, endian, (unsigned long long)seek);
+  _append_name(s, w->bin_name);
+  _append(s, "</DataItem>\n");
+}
+
+/*----------------------------------------------------------------------------
+ * Compute global range associated with local data.
+ *
+ * parameters:
+ *   w       <-- pointer to writer structure
+ *   n       <-- local number of values
+ *   g_start --> global start id of local values (0 to n-1), or NULL
+ *   n_g     --> global number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_global_range(const fvm_to_xdmf_writer_t  *w,
+              cs_lnum_t                    n,
+              cs_gnum_t                   *g_start,
+              cs_gnum_t                   *n_g)
+{
+  cs_gnum_t _n = n, g_end = n, _n_g = n;
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    MPI_Scan(&_n, &g_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+    _n_g = g_end;
+    MPI_Bcast(&_n_g, 1, CS_MPI_GNUM, w->n_ranks - 1, w->comm);
+  }
+#endif
+
+  if (g_start != NULL)
+    *g_start = g_end - _n;
+  *n_g = _n_g;
+}
+
+/*----------------------------------------------------------------------------
+ * Open the binary (heavy data) file associated with a time step if needed.
+ *
+ * parameters:
+ *   w  <-> pointer to writer structure
+ *   nt <-- time step number
+ *----------------------------------------------------------------------------*/
+
+static void
+_open_bin_file(fvm_to_xdmf_writer_t  *w,
+               int                    nt)
+{
+  if (w->f != NULL) {
+    if (w->f_nt == nt)
+      return;
+    w->f = cs_file_free(w->f);
+  }
+
+  /* A file closed by a flush is not reopened (as this would overwrite it),
+     so additional data for the same time step goes to a new part */
+
+  if (w->f_nt == nt && w->bin_name != NULL)
+    w->f_part += 1;
+  else
+    w->f_part = 0;
+
+  char t_stamp[64];
+  if (nt >= 0)
+    sprintf(t_stamp, ".%.5i", nt);
+  else
+    t_stamp[0] = '\0';
+  if (w->f_part > 0)
+    sprintf(t_stamp + strlen(t_stamp), "_%d", w->f_part);
+
+  BFT_REALLOC(w->bin_name, strlen(w->name) + strlen(t_stamp) + 5, char);
+  sprintf(w->bin_name, "%s%s.bin", w->name, t_stamp);
+
+  char *file_name = NULL;
+  BFT_MALLOC(file_name, strlen(w->path) + strlen(w->bin_name) + 1, char);
+  sprintf(file_name, "%s%s", w->path, w->bin_name);
+
+  cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+
+  MPI_Info hints;
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+  w->f = cs_file_open(file_name,
+                      CS_FILE_MODE_WRITE,
+                      method,
+                      hints,
+                      w->comm,
+                      w->comm);
+
+#else
+
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+  w->f = cs_file_open(file_name, CS_FILE_MODE_WRITE, method);
+
+#endif
+
+  BFT_FREE(file_name);
+
+  w->f_nt = nt;
+  w->offset = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Write partition-ordered data to the current binary file.
+ *
+ * Each rank's values are written contiguously, after those of the
+ * previous rank.
+ *
+ * parameters:
+ *   w        <-> pointer to writer structure
+ *   buf      <-- local values
+ *   datatype <-- data type
+ *   stride   <-- number of values per entity
+ *   n        <-- local number of entities
+ *   n_g      --> global number of entities
+ *
+ * returns:
+ *   offset of data in binary file
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_write_block(fvm_to_xdmf_writer_t  *w,
+             const void            *buf,
+             cs_datatype_t          datatype,
+             int                    stride,
+             cs_lnum_t              n,
+             cs_gnum_t             *n_g)
+{
+  cs_gnum_t g_start;
+  cs_file_off_t seek = w->offset;
+
+  const size_t size = cs_datatype_size[datatype];
+
+  _global_range(w, n, &g_start, n_g);
+
+  cs_file_write_block(w->f, buf, size, stride, g_start + 1, g_start + n + 1);
+
+  w->offset += (*n_g)*stride*size;
+
+  return seek;
+}
+
+/*----------------------------------------------------------------------------
+ * Write the index of rank offsets (partition_index) to the current binary
+ * file.
+ *
+ * For each rank, the global start ids of its vertices, elements, and
+ * connectivity values are written, followed by the global totals, so
+ * the array has (n_ranks + 1) rows of 3 columns.
+ *
+ * parameters:
+ *   w        <-> pointer to writer structure
+ *   n_local  <-- local vertex, element, and connectivity counts
+ *
+ * returns:
+ *   offset of index in binary file
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_write_partition_index(fvm_to_xdmf_writer_t  *w,
+                       const cs_gnum_t        n_local[3])
+{
+  int64_t *index = NULL;
+  cs_file_off_t seek = w->offset;
+
+  if (w->rank == 0)
+    BFT_MALLOC(index, (w->n_ranks + 1)*3, int64_t);
+
+  int64_t l_count[3] = {n_local[0], n_local[1], n_local[2]};
+
+  if (w->n_ranks > 1) {
+#if defined(HAVE_MPI)
+    MPI_Gather(l_count, 3, MPI_INT64_T, (index != NULL) ? index + 3 : NULL,
+               3, MPI_INT64_T, 0, w->comm);
+#endif
+  }
+  else {
+    for (int j = 0; j < 3; j++)
+      index[3+j] = l_count[j];
+  }
+
+  if (w->rank == 0) {
+    for (int j = 0; j < 3; j++)
+      index[j] = 0;
+    for (int i = 0; i < w->n_ranks; i++) {
+      for (int j = 0; j < 3; j++)
+        index[(i+1)*3 + j] += index[i*3 + j];
+    }
+  }
+
+  cs_file_write_global(w->f, index, sizeof(int64_t), (w->n_ranks + 1)*3);
+
+  w->offset += (w->n_ranks + 1)*3*sizeof(int64_t);
+
+  BFT_FREE(index);
+
+  return seek;
+}
+
+/*----------------------------------------------------------------------------
+ * Count local connectivity values of a nodal section in XDMF mixed
+ * topology form.
+ *
+ * parameters:
+ *   section <-- pointer to nodal section
+ *
+ * returns:
+ *   number of connectivity values
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_connect_size(const fvm_nodal_section_t  *section)
+{
+  cs_lnum_t retval = 0;
+
+  if (section->type == FVM_CELL_POLY) {
+    retval = section->n_elements*2 + section->face_index[section->n_elements];
+    for (cs_lnum_t i = 0; i < section->face_index[section->n_elements]; i++) {
+      cs_lnum_t face_id = CS_ABS(section->face_num[i]) - 1;
+      retval += (  section->vertex_index[face_id+1]
+                 - section->vertex_index[face_id]);
+    }
+  }
+  else if (section->type == FVM_FACE_POLY)
+    retval =   section->n_elements*2
+             + section->vertex_index[section->n_elements];
+  else if (section->type == FVM_EDGE)
+    retval = section->n_elements*4;
+  else
+    retval = section->n_elements*(section->stride + 1);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Build local connectivity of a nodal section in XDMF mixed topology form.
+ *
+ * parameters:
+ *   section    <-- pointer to nodal section
+ *   vtx_shift  <-- global id of first local vertex
+ *   connect    --> connectivity values
+ *
+ * returns:
+ *   number of connectivity values
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_build_connect(const fvm_nodal_section_t  *section,
+               cs_gnum_t                   vtx_shift,
+               int64_t                     connect[])
+{
+  cs_lnum_t k = 0;
+
+  const int64_t s = vtx_shift - 1;
+  const int64_t elt_type = _xdmf_elt_type[section->type];
+
+  if (section->type == FVM_CELL_POLY) {
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+
+      connect[k++] = elt_type;
+      connect[k++] = section->face_index[i+1] - section->face_index[i];
+
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+
+        int face_sgn = (section->face_num[j] > 0) ? 1 : -1;
+        cs_lnum_t face_id = CS_ABS(section->face_num[j]) - 1;
+        cs_lnum_t face_length = (  section->vertex_index[face_id+1]
+                                 - section->vertex_index[face_id]);
+
+        connect[k++] = face_length;
+        for (cs_lnum_t l = 0; l < face_length; l++) {
+          cs_lnum_t m =   section->vertex_index[face_id]
+                        + (face_length + (l*face_sgn))%face_length;
+          connect[k++] = section->vertex_num[m] + s;
+        }
+
+      }
+
+    }
+
+  }
+
+  else if (section->type == FVM_FACE_POLY) {
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+      connect[k++] = elt_type;
+      connect[k++] = section->vertex_index[i+1] - section->vertex_index[i];
+      for (cs_lnum_t j = section->vertex_index[i];
+           j < section->vertex_index[i+1];
+           j++)
+        connect[k++] = section->vertex_num[j] + s;
+    }
+
+  }
+
+  else {
+
+    /* Prism vertex order differs from the FVM (EnSight) order */
+
+    int vertex_order[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    if (section->type == FVM_CELL_PRISM) {
+      vertex_order[1] = 2;
+      vertex_order[2] = 1;
+      vertex_order[4] = 5;
+      vertex_order[5] = 4;
+    }
+
+    const int stride = section->stride;
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+      connect[k++] = elt_type;
+      if (section->type == FVM_EDGE)
+        connect[k++] = 2;
+      for (int j = 0; j < stride; j++)
+        connect[k++] = section->vertex_num[i*stride + vertex_order[j]] + s;
+    }
+
+  }
+
+  return k;
+}
+
+/*----------------------------------------------------------------------------
+ * Return id of a given exported mesh, or -1 if not found.
+ *
+ * parameters:
+ *   w    <-- pointer to writer structure
+ *   name <-- mesh name
+ *----------------------------------------------------------------------------*/
+
+static int
+_mesh_id(const fvm_to_xdmf_writer_t  *w,
+         const char                  *name)
+{
+  for (int i = 0; i < w->n_meshes; i++) {
+    if (strcmp(w->meshes[i].name, name) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Return pointer to grid associated with a given mesh and time step,
+ * adding it if needed.
+ *
+ * A negative time step indicates the current time step (which may itself
+ * be negative if the output is time-independent).
+ *
+ * parameters:
+ *   w          <-> pointer to writer structure
+ *   mesh_id    <-- associated mesh id
+ *   time_step  <-- time step number
+ *   time_value <-- time value
+ *
+ * returns:
+ *   pointer to grid structure
+ *----------------------------------------------------------------------------*/
+
+static _xdmf_grid_t *
+_get_grid(fvm_to_xdmf_writer_t  *w,
+          int                    mesh_id,
+          int                    time_step,
+          double                 time_value)
+{
+  _xdmf_step_t *step = NULL;
+
+  if (time_step < 0) {
+    time_step = w->nt;
+    time_value = w->t;
+  }
+
+  if (w->n_steps > 0) {
+    if (w->steps[w->n_steps - 1].nt == time_step)
+      step = w->steps + w->n_steps - 1;
+  }
+
+  if (step == NULL) {
+    BFT_REALLOC(w->steps, w->n_steps + 1, _xdmf_step_t);
+    step = w->steps + w->n_steps;
+    step->nt = time_step;
+    step->t = time_value;
+    step->n_grids = 0;
+    step->grids = NULL;
+    w->n_steps += 1;
+  }
+
+  for (int i = 0; i < step->n_grids; i++) {
+    if (step->grids[i].mesh_id == mesh_id)
+      return step->grids + i;
+  }
+
+  BFT_REALLOC(step->grids, step->n_grids + 1, _xdmf_grid_t);
+
+  _xdmf_grid_t *grid = step->grids + step->n_grids;
+  step->n_grids += 1;
+
+  const char *mesh_xml = w->meshes[mesh_id].xml;
+
+  grid->mesh_id = mesh_id;
+  BFT_MALLOC(grid->mesh_xml, strlen(mesh_xml) + 1, char);
+  strcpy(grid->mesh_xml, mesh_xml);
+  grid->xml = NULL;
+
+  return grid;
+}
+
+/*----------------------------------------------------------------------------
+ * Write the light (XML) metadata file.
+ *
+ * The whole file is rewritten, so that it is always complete and
+ * readable between time steps.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_metadata(const fvm_to_xdmf_writer_t  *w)
+{
+  if (w->rank > 0)
+    return;
+
+  char *file_name = NULL;
+  BFT_MALLOC(file_name, strlen(w->path) + strlen(w->name) + 5, char);
+  sprintf(file_name, "%s%s.xmf", w->path, w->name);
+
+  FILE *f = fopen(file_name, "w");
+
+  if (f == NULL) {
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), file_name);
+    return;
+  }
+
+  fprintf(f,
+          "<?xml version=\"1.0\" ?>\n"
+          "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+          "<Xdmf Version=\"3.0\">\n"
+          "  <Domain>\n");
+
+  bool transient = false;
+  for (int i = 0; i < w->n_steps; i++) {
+    if (w->steps[i].nt >= 0)
+      transient = true;
+  }
+
+  if (transient)
+    fprintf(f, "    <Grid Name=\"TimeSeries\" GridType=\"Collection\""
+            " CollectionType=\"Temporal\">\n");
+
+  for (int i = 0; i < w->n_steps; i++) {
+
+    const _xdmf_step_t *step = w->steps + i;
+
+    if (transient && step->nt < 0)
+      continue;
+
+    fprintf(f, "      <Grid Name=\"Step_%d\" GridType=\"Collection\""
+            " CollectionType=\"Spatial\">\n", step->nt);
+    if (transient)
+      fprintf(f, "        <Time Value=\"%.12g\" />\n", step->t);
+
+    for (int j = 0; j < step->n_grids; j++) {
+      const _xdmf_grid_t *grid = step->grids + j;
+      char *name = NULL;
+      _append_name(&name, w->meshes[grid->mesh_id].name);
+      fprintf(f, "        <Grid Name=\"%s\" GridType=\"Uniform\">\n", name);
+      fputs(grid->mesh_xml, f);
+      if (grid->xml != NULL)
+        fputs(grid->xml, f);
+      fprintf(f, "        </Grid>\n");
+      BFT_FREE(name);
+    }
+
+    fprintf(f, "      </Grid>\n");
+
+  }
+
+  if (transient)
+    fprintf(f, "    </Grid>\n");
+
+  fprintf(f,
+          "  </Domain>\n"
+          "</Xdmf>\n");
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file: \"%s\""), file_name);
+
+  BFT_FREE(file_name);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to XDMF file writer.
+ *
+ * Heavy data (coordinates, connectivity, and field values) is written in
+ * raw binary form, in partition order, to one file per time step, using
+ * the default cs_file access method (i.e. MPI-IO collective writes when
+ * available). Vertices shared by several ranks are thus duplicated. The
+ * light metadata (.xmf) file refers to this data, and also contains a
+ * reference to a "partition_index" array of rank offsets.
+ *
+ * No options are currently handled by this writer.
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- output directory prefix
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque XDMF writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_xdmf_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency,
+                        MPI_Comm                comm)
+#else
+void *
+fvm_to_xdmf_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  CS_UNUSED(options);
+  CS_UNUSED(time_dependency);
+
+  fvm_to_xdmf_writer_t  *w = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_xdmf_writer_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+  for (size_t i = 0; i < strlen(name); i++) {
+    if (w->name[i] == ' ' || w->name[i] == '\t')
+      w->name[i] = '_';
+  }
+
+  if (path != NULL) {
+    BFT_MALLOC(w->path, strlen(path) + 1, char);
+    strcpy(w->path, path);
+  }
+  else {
+    BFT_MALLOC(w->path, 1, char);
+    w->path[0] = '\0';
+  }
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+  w->nt = -1;
+  w->t = -1.;
+
+  w->n_meshes = 0;
+  w->meshes = NULL;
+
+  w->n_steps = 0;
+  w->steps = NULL;
+
+  w->modified = false;
+
+  w->bin_name = NULL;
+  w->f = NULL;
+  w->f_nt = -1;
+  w->f_part = 0;
+  w->offset = 0;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Return writer */
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to XDMF file writer.
+ *
+ * parameters:
+ *   writer <-- pointer to opaque XDMF writer structure.
+ *
+ * returns:
+ *   NULL pointer
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_xdmf_finalize_writer(void  *writer)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  fvm_to_xdmf_flush(writer);
+
+  BFT_FREE(w->bin_name);
+
+  for (int i = 0; i < w->n_steps; i++) {
+    _xdmf_step_t *step = w->steps + i;
+    for (int j = 0; j < step->n_grids; j++) {
+      BFT_FREE(step->grids[j].mesh_xml);
+      BFT_FREE(step->grids[j].xml);
+    }
+    BFT_FREE(step->grids);
+  }
+  BFT_FREE(w->steps);
+
+  for (int i = 0; i < w->n_meshes; i++) {
+    BFT_FREE(w->meshes[i].name);
+    BFT_FREE(w->meshes[i].xml);
+  }
+  BFT_FREE(w->meshes);
+
+  BFT_FREE(w->name);
+  BFT_FREE(w->path);
+
+  BFT_FREE(w);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an XDMF geometry.
+ *
+ * parameters:
+ *   writer     <-- pointer to associated writer
+ *   time_step  <-- time step number
+ *   time_value <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_set_mesh_time(void    *writer,
+                          int      time_step,
+                          double   time_value)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  if (time_step != w->nt && w->modified)
+    fvm_to_xdmf_flush(writer);
+
+  w->nt = time_step;
+  w->t = time_value;
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an XDMF file
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *   mesh   <-- pointer to nodal mesh structure that should be written
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_export_nodal(void               *writer,
+                         const fvm_nodal_t  *mesh)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  const int elt_dim = fvm_nodal_get_max_entity_dim(mesh);
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+  /* Local element and connectivity counts */
+
+  cs_lnum_t n_elts = 0, connect_size = 0;
+
+  if (elt_dim > 0) {
+    for (int i = 0; i < mesh->n_sections; i++) {
+      const fvm_nodal_section_t  *section = mesh->sections[i];
+      if (section->entity_dim < elt_dim)
+        continue;
+      n_elts += section->n_elements;
+      connect_size += _connect_size(section);
+    }
+  }
+  else
+    n_elts = n_vertices;
+
+  cs_gnum_t vtx_shift, n_g_vertices, n_g_elts, n_g_connect;
+
+  _global_range(w, n_vertices, &vtx_shift, &n_g_vertices);
+  _global_range(w, n_elts, NULL, &n_g_elts);
+
+  if (n_g_elts == 0)
+    return;
+
+  _open_bin_file(w, w->nt);
+
+  /* Vertex coordinates (always 3d) */
+
+  cs_coord_t *coords = NULL;
+  BFT_MALLOC(coords, n_vertices*3, cs_coord_t);
+
+  const int dim = mesh->dim;
+  const cs_coord_t *vertex_coords = mesh->vertex_coords;
+  const cs_lnum_t *parent_vertex_num = mesh->parent_vertex_num;
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    const cs_lnum_t j =   (parent_vertex_num != NULL)
+                        ? parent_vertex_num[i] - 1 : i;
+    for (int k = 0; k < dim; k++)
+      coords[i*3 + k] = vertex_coords[j*dim + k];
+    for (int k = dim; k < 3; k++)
+      coords[i*3 + k] = 0.;
+  }
+
+  cs_file_off_t coords_seek = _write_block(w,
+                                           coords,
+                                           CS_COORD_TYPE,
+                                           3,
+                                           n_vertices,
+                                           &n_g_vertices);
+
+  BFT_FREE(coords);
+
+  /* Connectivity, shifted by the global id of the rank's first vertex */
+
+  cs_file_off_t connect_seek = 0;
+  n_g_connect = 0;
+
+  if (elt_dim > 0) {
+
+    int64_t *connect = NULL;
+    BFT_MALLOC(connect, connect_size, int64_t);
+
+    cs_lnum_t k = 0;
+
+    for (int i = 0; i < mesh->n_sections; i++) {
+      const fvm_nodal_section_t  *section = mesh->sections[i];
+      if (section->entity_dim < elt_dim)
+        continue;
+      k += _build_connect(section, vtx_shift, connect + k);
+    }
+
+    assert(k == connect_size);
+
+    connect_seek = _write_block(w,
+                                connect,
+                                CS_INT64,
+                                1,
+                                connect_size,
+                                &n_g_connect);
+
+    BFT_FREE(connect);
+
+  }
+
+  /* Index of rank offsets */
+
+  const cs_gnum_t n_local[3] = {n_vertices, n_elts, connect_size};
+
+  cs_file_off_t index_seek = _write_partition_index(w, n_local);
+
+  /* Update metadata */
+
+  int mesh_id = _mesh_id(w, mesh->name);
+
+  if (mesh_id < 0) {
+    mesh_id = w->n_meshes;
+    BFT_REALLOC(w->meshes, w->n_meshes + 1, _xdmf_mesh_t);
+    BFT_MALLOC(w->meshes[mesh_id].name, strlen(mesh->name) + 1, char);
+    strcpy(w->meshes[mesh_id].name, mesh->name);
+    w->meshes[mesh_id].xml = NULL;
+    w->n_meshes += 1;
+  }
+
+  _xdmf_mesh_t *m = w->meshes + mesh_id;
+
+  m->n_g_vertices = n_g_vertices;
+  m->n_g_elements = n_g_elts;
+
+  BFT_FREE(m->xml);
+
+  if (elt_dim > 0) {
+    _append(&(m->xml),
+            "          <Topology TopologyType=\"Mixed\""
+            " NumberOfElements=\"%llu\">\n",
+            (unsigned long long)n_g_elts);
+    _append_data_item(w, &(m->xml), "            ",
+                      CS_INT64, n_g_connect, 0, connect_seek);
+  }
+  else
+    _append(&(m->xml),
+            "          <Topology TopologyType=\"Polyvertex\""
+            " NumberOfElements=\"%llu\" NodesPerElement=\"1\">\n",
+            (unsigned long long)n_g_elts);
+  _append(&(m->xml), "          </Topology>\n");
+
+  _append(&(m->xml), "          <Geometry GeometryType=\"XYZ\">\n");
+  _append_data_item(w, &(m->xml), "            ",
+                    CS_COORD_TYPE, n_g_vertices, 3, coords_seek);
+  _append(&(m->xml), "          </Geometry>\n");
+
+  _append(&(m->xml),
+          "          <Information Name=\"partition_index\""
+          " Value=\"vertices elements connectivity\">\n");
+  _append_data_item(w, &(m->xml), "            ",
+                    CS_INT64, w->n_ranks + 1, 3, index_seek);
+  _append(&(m->xml), "          </Information>\n");
+
+  /* Add to current time step */
+
+  _xdmf_grid_t *grid = _get_grid(w, mesh_id, w->nt, w->t);
+
+  BFT_REALLOC(grid->mesh_xml, strlen(m->xml) + 1, char);
+  strcpy(grid->mesh_xml, m->xml);
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an XDMF file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   writer           <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_export_field(void                  *writer,
+                         const fvm_nodal_t     *mesh,
+                         const char            *name,
+                         fvm_writer_var_loc_t   location,
+                         int                    dimension,
+                         cs_interlace_t         interlace,
+                         int                    n_parent_lists,
+                         const cs_lnum_t        parent_num_shift[],
+                         cs_datatype_t          datatype,
+                         int                    time_step,
+                         double                 time_value,
+                         const void      *const field_values[])
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  int mesh_id = _mesh_id(w, mesh->name);
+
+  if (mesh_id < 0 || dimension < 1)
+    return;
+
+  /* Values are written in their native precision; multidimensional
+     integer values are not handled by fvm_convert_array, so are ignored,
+     as are unsupported types. */
+
+  const cs_datatype_t dest_datatype = datatype;
+
+  if (   datatype != CS_FLOAT && datatype != CS_DOUBLE
+      && datatype != CS_INT32 && datatype != CS_INT64
+      && datatype != CS_UINT32 && datatype != CS_UINT64)
+    return;
+
+  if (   dimension > 1
+      && datatype != CS_FLOAT && datatype != CS_DOUBLE)
+    return;
+
+  const int elt_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  if (location == FVM_WRITER_PER_ELEMENT && elt_dim == 0)
+    return;
+
+  /* Gather local values in partition order */
+
+  cs_lnum_t n_elts = 0;
+
+  if (location == FVM_WRITER_PER_NODE)
+    n_elts = mesh->n_vertices;
+  else {
+    for (int i = 0; i < mesh->n_sections; i++) {
+      if (mesh->sections[i]->entity_dim == elt_dim)
+        n_elts += mesh->sections[i]->n_elements;
+    }
+  }
+
+  const size_t dest_size = cs_datatype_size[dest_datatype];
+
+  unsigned char *values = NULL;
+  BFT_MALLOC(values, n_elts*dimension*dest_size, unsigned char);
+
+  if (location == FVM_WRITER_PER_NODE)
+    fvm_convert_array(dimension,
+                      0,
+                      dimension,
+                      0,
+                      mesh->n_vertices,
+                      interlace,
+                      datatype,
+                      dest_datatype,
+                      n_parent_lists,
+                      parent_num_shift,
+                      mesh->parent_vertex_num,
+                      field_values,
+                      values);
+
+  else {
+
+    size_t start_id = 0;
+    cs_lnum_t src_shift = 0;
+
+    for (int i = 0; i < mesh->n_sections; i++) {
+
+      const fvm_nodal_section_t  *section = mesh->sections[i];
+
+      if (section->entity_dim < elt_dim)
+        continue;
+
+      fvm_convert_array(dimension,
+                        0,
+                        dimension,
+                        src_shift,
+                        section->n_elements + src_shift,
+                        interlace,
+                        datatype,
+                        dest_datatype,
+                        n_parent_lists,
+                        parent_num_shift,
+                        section->parent_element_num,
+                        field_values,
+                        values + start_id);
+
+      start_id += section->n_elements*dimension*dest_size;
+      if (n_parent_lists == 0)
+        src_shift += section->n_elements;
+
+    }
+
+  }
+
+  /* Symmetric tensors: XDMF Tensor6 order is (xx, xy, xz, yy, yz, zz) */
+
+  if (dimension == 6) {
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      if (dest_datatype == CS_DOUBLE) {
+        double *v = (double *)values + i*6;
+        double t[6] = {v[0], v[3], v[5], v[1], v[4], v[2]};
+        for (int j = 0; j < 6; j++)
+          v[j] = t[j];
+      }
+      else {
+        float *v = (float *)values + i*6;
+        float t[6] = {v[0], v[3], v[5], v[1], v[4], v[2]};
+        for (int j = 0; j < 6; j++)
+          v[j] = t[j];
+      }
+    }
+  }
+
+  /* Write values */
+
+  _xdmf_grid_t *grid = _get_grid(w, mesh_id, time_step, time_value);
+
+  _open_bin_file(w, (time_step < 0) ? w->nt : time_step);
+
+  cs_gnum_t n_g_elts = 0;
+  cs_file_off_t seek = _write_block(w,
+                                    values,
+                                    dest_datatype,
+                                    dimension,
+                                    n_elts,
+                                    &n_g_elts);
+
+  BFT_FREE(values);
+
+  /* Update metadata */
+
+  const char *attribute_type = "Matrix";
+  switch (dimension) {
+  case 1:
+    attribute_type = "Scalar";
+    break;
+  case 3:
+    attribute_type = "Vector";
+    break;
+  case 6:
+    attribute_type = "Tensor6";
+    break;
+  case 9:
+    attribute_type = "Tensor";
+    break;
+  default:
+    break;
+  }
+
+  _append(&(grid->xml), "          <Attribute Name=\"");
+  _append_name(&(grid->xml), name);
+  _append(&(grid->xml), "\" AttributeType=\"%s\" Center=\"%s\">\n",
+          attribute_type,
+          (location == FVM_WRITER_PER_NODE) ? "Node" : "Cell");
+  _append_data_item(w, &(grid->xml), "            ",
+                    dest_datatype, n_g_elts, (dimension > 1) ? dimension : 0,
+                    seek);
+  _append(&(grid->xml), "          </Attribute>\n");
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * In this case, the current binary file is closed and the light (XML)
+ * metadata file is updated.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_flush(void  *writer)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  if (w->f != NULL)
+    w->f = cs_file_free(w->f);
+
+  if (w->modified)
+    _write_metadata(w);
+
+  w->modified = false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
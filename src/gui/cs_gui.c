@@ -5969,6 +5969,8 @@ cs_gui_partition(void)
       a = CS_PARTITION_SCOTCH;
     else if (!strcmp(part_name, "metis"))
       a = CS_PARTITION_METIS;
+    else if (!strcmp(part_name, "multilevel"))
+      a = CS_PARTITION_MULTILEVEL;
     else if (!strcmp(part_name, "block"))
       a = CS_PARTITION_BLOCK;
     BFT_FREE(part_name);
@@ -94,6 +94,7 @@
 #include "cs_lagr_tracking.h"
 #include "cs_lagr_print.h"
 #include "cs_lagr_poisson.h"
+#include "cs_lagr_population.h"
 #include "cs_lagr_post.h"
 #include "cs_lagr_sde.h"
 #include "cs_lagr_sde_model.h"
@@ -2046,6 +2047,12 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
       }
 
+      /* Parcel population control (merging and splitting)
+         ------------------------------------------------- */
+
+      if (cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order)
+        cs_lagr_population_control();
+
       /* Compute adhesion for reentrainement model
          ----------------------------------------- */
 
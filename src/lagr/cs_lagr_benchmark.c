@@ -0,0 +1,635 @@
+/*============================================================================
+ * Lagrangian module performance benchmark
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_parall.h"
+#include "cs_random.h"
+#include "cs_time_step.h"
+#include "cs_timer.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_new.h"
+#include "cs_lagr_particle.h"
+#include "cs_lagr_sde.h"
+#include "cs_lagr_stat.h"
+#include "cs_lagr_tracking.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_benchmark.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_lagr_benchmark.c
+
+  \brief Lagrangian module performance benchmark.
+
+  Particles are injected at random positions in all cells of the current
+  mesh, and transported in a prescribed flow (uniform velocity combined
+  with a solid rotation around the z axis) with turbulent dispersion,
+  rebounding on all boundaries. The time step is chosen so that particles
+  cross about one cell per time step.
+
+  For each number of particles per cell and each number of threads,
+  the time spent in the integration of the stochastic differential
+  equations, in particle tracking (including particle set synchronization
+  and migration between ranks), and in the update of volume statistics is
+  logged. Scaling with the number of MPI ranks is obtained by running the
+  benchmark with different numbers of ranks on the same mesh.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Number of timed stages */
+
+#define CS_LAGR_BENCHMARK_N_STAGES 4
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Numbers of particles injected per cell */
+
+static const int _n_particles_per_cell[] = {1, 4, 16};
+
+static const char *_stage_name[] = {N_("SDE"),
+                                    N_("Tracking"),
+                                    N_("(sync.)"),
+                                    N_("Statistics")};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Define prescribed fluid flow fields.
+ *
+ * The velocity is the sum of a uniform velocity along x and of a solid
+ * rotation around the z axis passing through the mesh bounding box center,
+ * whose maximum velocity in that box is of the same magnitude.
+ *
+ * parameters:
+ *   u_ref <-- reference velocity
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_flow(cs_real_t  u_ref)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)m->vtx_coord;
+
+  /* Bounding box */
+
+  cs_real_t b_min[3] = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
+  cs_real_t b_max[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
+    for (int j = 0; j < 3; j++) {
+      b_min[j] = CS_MIN(b_min[j], vtx_coord[i][j]);
+      b_max[j] = CS_MAX(b_max[j], vtx_coord[i][j]);
+    }
+  }
+
+  cs_parall_min(3, CS_REAL_TYPE, b_min);
+  cs_parall_max(3, CS_REAL_TYPE, b_max);
+
+  cs_real_t center[3];
+  for (int j = 0; j < 3; j++)
+    center[j] = 0.5*(b_min[j] + b_max[j]);
+
+  cs_real_t r_max = 0.5*sqrt(  cs_math_sq(b_max[0] - b_min[0])
+                             + cs_math_sq(b_max[1] - b_min[1]));
+  cs_real_t omega = (r_max > 0) ? u_ref / r_max : 0.;
+
+  /* Fields */
+
+  cs_field_t *f_vel
+    = cs_field_find_or_create("velocity",
+                              CS_FIELD_INTENSIVE | CS_FIELD_VARIABLE,
+                              CS_MESH_LOCATION_CELLS,
+                              3,
+                              true);  /* has previous */
+
+  cs_field_t *f_rho
+    = cs_field_find_or_create("density",
+                              CS_FIELD_INTENSIVE | CS_FIELD_PROPERTY,
+                              CS_MESH_LOCATION_CELLS,
+                              1,
+                              false);
+
+  cs_field_t *f_mu
+    = cs_field_find_or_create("molecular_viscosity",
+                              CS_FIELD_INTENSIVE | CS_FIELD_PROPERTY,
+                              CS_MESH_LOCATION_CELLS,
+                              1,
+                              false);
+
+  cs_field_t *fields[3] = {f_vel, f_rho, f_mu};
+  for (int i = 0; i < 3; i++) {
+    if (fields[i]->val == NULL)
+      cs_field_allocate_values(fields[i]);
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    const cs_real_t x = cell_cen[c_id][0] - center[0];
+    const cs_real_t y = cell_cen[c_id][1] - center[1];
+    const cs_real_t u[3] = {u_ref - omega*y, omega*x, 0.};
+    for (int t_id = 0; t_id < f_vel->n_time_vals; t_id++) {
+      for (int j = 0; j < 3; j++)
+        f_vel->vals[t_id][c_id*3 + j] = u[j];
+    }
+    f_rho->val[c_id] = 1.;
+    f_mu->val[c_id] = 1.e-5;
+  }
+
+  /* Map fields to Lagrangian module */
+
+  cs_lagr_extra_module_t *extra = cs_get_lagr_extra_module();
+
+  extra->vel = f_vel;
+  extra->cromf = f_rho;
+  extra->viscl = f_mu;
+}
+
+/*----------------------------------------------------------------------------
+ * Define Lagrangian model options and structures for the benchmark.
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_lagr_setup(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  /* Time scheme: one-way coupling, first order, turbulent dispersion,
+     steady statistics */
+
+  cs_lagr_time_scheme_t *lagr_time_scheme = cs_glob_lagr_time_scheme;
+
+  lagr_time_scheme->iilagr = 1;
+  lagr_time_scheme->isttio = 1;
+  lagr_time_scheme->t_order = 1;
+  lagr_time_scheme->idistu = 1;
+
+  cs_glob_lagr_stat_options->idstnt = 1;
+  cs_glob_lagr_stat_options->nstist = 1;
+
+  cs_lagr_particle_attr_initialize();
+
+  /* Volume statistics */
+
+  cs_lagr_stat_activate(CS_LAGR_STAT_CUMULATIVE_WEIGHT);
+  cs_lagr_stat_activate_attr(CS_LAGR_VELOCITY);
+
+  cs_lagr_stat_initialize();
+
+  /* Particles rebound on all boundaries */
+
+  cs_lagr_zone_data_t *bcs = cs_lagr_get_boundary_conditions();
+
+  for (int z_id = 0; z_id < bcs->n_zones; z_id++)
+    bcs->zone_type[z_id] = CS_LAGR_REBOUND;
+
+  BFT_REALLOC(bcs->elt_type, m->n_b_faces, char);
+  for (cs_lnum_t i = 0; i < m->n_b_faces; i++)
+    bcs->elt_type[i] = CS_LAGR_REBOUND;
+
+  cs_lagr_get_internal_conditions();
+
+  /* Tracking structures and particle set */
+
+  cs_lagr_tracking_initialize();
+}
+
+/*----------------------------------------------------------------------------
+ * Replace the current particle set with particles injected at random
+ * positions in each cell.
+ *
+ * parameters:
+ *   n_per_cell <-- number of particles per cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_inject_particles(cs_lnum_t  n_per_cell)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_inject = n_cells * n_per_cell;
+
+  const cs_real_3_t *vel
+    = (const cs_real_3_t *)cs_glob_lagr_extra_module->vel->val;
+
+  /* Particles of 10 microns diameter, with a density of 1000 */
+
+  const cs_real_t d_p = 1.e-5;
+  const cs_real_t m_p = 1.e3 * cs_math_pi * cs_math_pow3(d_p) / 6.;
+
+  cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  p_set->n_particles = 0;
+
+  if (cs_lagr_particle_set_resize(n_inject) < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Lagrangian benchmark: %d particles per cell exceed\n"
+                "the global maximum number of particles."),
+              (int)n_per_cell);
+
+  memset(p_set->p_buffer, 0, n_inject*p_set->p_am->extents);
+
+  cs_lnum_t *cell_particle_idx;
+  BFT_MALLOC(cell_particle_idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    cell_particle_idx[i] = i*n_per_cell;
+
+  cs_lagr_new_v(p_set, n_cells, NULL, cell_particle_idx);
+
+  BFT_FREE(cell_particle_idx);
+
+  for (cs_lnum_t p_id = 0; p_id < n_inject; p_id++) {
+
+    cs_lnum_t c_id
+      = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_NUM) - 1;
+
+    cs_real_t *p_vel
+      = cs_lagr_particles_attr(p_set, p_id, CS_LAGR_VELOCITY);
+    cs_real_t *p_vel_seen
+      = cs_lagr_particles_attr(p_set, p_id, CS_LAGR_VELOCITY_SEEN);
+
+    for (int j = 0; j < 3; j++) {
+      p_vel[j] = vel[c_id][j];
+      p_vel_seen[j] = vel[c_id][j];
+    }
+
+    cs_lagr_particles_set_lnum(p_set, p_id, CS_LAGR_REBOUND_ID, -1);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_STAT_WEIGHT, 1.);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_DIAMETER, d_p);
+    cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_MASS, m_p);
+
+  }
+
+  p_set->n_particles = n_inject;
+}
+
+/*----------------------------------------------------------------------------
+ * Run Lagrangian time steps and measure the time spent in each stage.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for measure (< 0 for single time step)
+ *   u_ref     <-- reference velocity
+ *   dt        <-- time step
+ *   t_stage   --> wall-clock time for each stage (accumulated)
+ *
+ * returns:
+ *   number of time steps run
+ *----------------------------------------------------------------------------*/
+
+static int
+_time_steps(double     t_measure,
+            cs_real_t  u_ref,
+            cs_real_t  dt,
+            double     t_stage[CS_LAGR_BENCHMARK_N_STAGES])
+{
+  const int n_steps_min = 5;
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  /* Particle and fluid time scales (of the order of the time step,
+     and distinct so as to avoid singular SDE coefficients), and
+     diffusion coefficient for 10% velocity fluctuations */
+
+  const cs_real_t taup_ref = 0.5*dt;
+  const cs_real_t tlag_ref = 2.*dt;
+  const cs_real_t bx_ref = 0.1*u_ref * sqrt(2./tlag_ref);
+
+  cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  cs_real_t *taup = NULL;
+  cs_real_3_t *tlag = NULL, *piil = NULL;
+  cs_real_33_t *bx = NULL;
+
+  cs_real_3_t *gradpr;
+  BFT_MALLOC(gradpr, n_cells_ext, cs_real_3_t);
+  memset(gradpr, 0, n_cells_ext*sizeof(cs_real_3_t));
+
+  for (int i = 0; i < CS_LAGR_BENCHMARK_N_STAGES; i++)
+    t_stage[i] = 0.;
+
+  cs_timer_counter_t t_sync_0 = cs_lagr_tracking_get_sync_timer();
+
+  cs_glob_lagr_time_step->dtp = dt;
+
+  int n_steps = 0;
+  double t_run = 0.;
+
+  while (t_run < t_measure || (t_measure >= 0 && n_steps < n_steps_min)) {
+
+    const cs_lnum_t n_particles = p_set->n_particles;
+
+    cs_time_step_increment(dt);
+    cs_glob_lagr_time_step->nor = 1;
+    cs_glob_lagr_time_step->ttclag += dt;
+
+    /* Prescribed particle characteristic times */
+
+    BFT_REALLOC(taup, n_particles, cs_real_t);
+    BFT_REALLOC(tlag, n_particles, cs_real_3_t);
+    BFT_REALLOC(piil, n_particles, cs_real_3_t);
+    BFT_REALLOC(bx, n_particles, cs_real_33_t);
+
+    for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+      taup[p_id] = taup_ref;
+      for (int j = 0; j < 3; j++) {
+        tlag[p_id][j] = tlag_ref;
+        piil[p_id][j] = 0.;
+        for (int k = 0; k < 3; k++)
+          bx[p_id][j][k] = bx_ref;
+      }
+      cs_lagr_particles_set_lnum(p_set, p_id, CS_LAGR_RANK_ID,
+                                 cs_glob_rank_id);
+      cs_lagr_particles_current_to_previous(p_set, p_id);
+    }
+
+    cs_lnum_t nresnew = 0;
+
+    double t0 = cs_timer_wtime();
+
+    cs_lagr_sde(dt,
+                (const cs_real_t *)taup,
+                (const cs_real_3_t *)tlag,
+                (const cs_real_3_t *)piil,
+                (const cs_real_33_t *)bx,
+                NULL,
+                (const cs_real_3_t *)gradpr,
+                NULL,
+                NULL,
+                NULL,
+                &nresnew);
+
+    double t1 = cs_timer_wtime();
+
+    cs_lagr_tracking_particle_movement(NULL);
+
+    double t2 = cs_timer_wtime();
+
+    cs_lagr_stat_update();
+
+    double t3 = cs_timer_wtime();
+
+    t_stage[0] += t1 - t0;
+    t_stage[1] += t2 - t1;
+    t_stage[3] += t3 - t2;
+
+    n_steps++;
+
+    /* Use the same stopping criterion on all ranks */
+
+    t_run = t_stage[0] + t_stage[1] + t_stage[3];
+    cs_parall_max(1, CS_DOUBLE, &t_run);
+
+    if (t_measure < 0)
+      break;
+  }
+
+  cs_timer_counter_t t_sync_1 = cs_lagr_tracking_get_sync_timer();
+  t_stage[2] = (t_sync_1.wall_nsec - t_sync_0.wall_nsec) * 1.e-9;
+
+  BFT_FREE(bx);
+  BFT_FREE(piil);
+  BFT_FREE(tlag);
+  BFT_FREE(taup);
+  BFT_FREE(gradpr);
+
+  return n_steps;
+}
+
+/*----------------------------------------------------------------------------
+ * Log stage timings for a given benchmark configuration.
+ *
+ * Times are given per time step, as the maximum over ranks; the load
+ * imbalance is the ratio of maximum to mean total time over ranks.
+ *
+ * parameters:
+ *   n_threads     <-- number of threads
+ *   n_steps       <-- number of time steps run
+ *   n_g_particles <-- global number of particles
+ *   t_stage       <-- wall-clock time for each stage
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_stage_times(int           n_threads,
+                 int           n_steps,
+                 cs_gnum_t     n_g_particles,
+                 const double  t_stage[CS_LAGR_BENCHMARK_N_STAGES])
+{
+  double t_max[CS_LAGR_BENCHMARK_N_STAGES + 1];
+
+  for (int i = 0; i < CS_LAGR_BENCHMARK_N_STAGES; i++)
+    t_max[i] = t_stage[i] / n_steps;
+
+  t_max[CS_LAGR_BENCHMARK_N_STAGES]
+    = (t_stage[0] + t_stage[1] + t_stage[3]) / n_steps;
+
+  double t_mean = t_max[CS_LAGR_BENCHMARK_N_STAGES];
+
+  cs_parall_max(CS_LAGR_BENCHMARK_N_STAGES + 1, CS_DOUBLE, t_max);
+  cs_parall_sum(1, CS_DOUBLE, &t_mean);
+  t_mean /= cs_glob_n_ranks;
+
+  const double t_tot = t_max[CS_LAGR_BENCHMARK_N_STAGES];
+  const double t_part = (n_g_particles > 0) ? t_tot*1.e9/n_g_particles : 0.;
+  const double imbalance = (t_mean > 0) ? t_tot / t_mean : 1.;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %7d %6d %12.5e %12.5e %12.5e %12.5e %12.5e %9.3f\n",
+                n_threads, n_steps,
+                t_max[0], t_max[1], t_max[2], t_max[3],
+                t_part, imbalance);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run Lagrangian module benchmark.
+ *
+ * Particles are transported in a prescribed flow on the current mesh,
+ * for several numbers of particles per cell and of threads, and the time
+ * spent in the main stages of a Lagrangian time step is logged.
+ *
+ * \param[in]  mpi_trace_mode  indicates if timing mode (0) or MPI
+ *                             trace-friendly mode (1) is to be used
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_benchmark(int  mpi_trace_mode)
+{
+  const double t_measure = (mpi_trace_mode) ? -1.0 : 2.0;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  const int n_threads_max = cs_glob_n_threads;
+
+  /* Mean cell size, so that particles cross about one cell per step */
+
+  cs_real_t vol_tot = 0.;
+  for (cs_lnum_t i = 0; i < m->n_cells; i++)
+    vol_tot += cell_vol[i];
+  cs_parall_sum(1, CS_REAL_TYPE, &vol_tot);
+
+  const cs_real_t u_ref = 1.;
+  const cs_real_t h = cbrt(vol_tot / CS_MAX(m->n_g_cells, 1));
+  const cs_real_t dt = h / u_ref;
+
+  cs_get_glob_time_step_options()->dtref = dt;
+
+  _define_flow(u_ref);
+  _define_lagr_setup();
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Lagrangian module benchmark\n"
+                  "===========================\n\n"
+                  "  Mean cell size:    %12.5e\n"
+                  "  Time step:         %12.5e\n\n"
+                  "  Wall-clock times per time step (maximum over ranks);\n"
+                  "  %s includes %s time, and ns/part. is based on\n"
+                  "  the total time per time step.\n"),
+                h, dt, _(_stage_name[1]), _(_stage_name[2]));
+
+  int n_configs = sizeof(_n_particles_per_cell) / sizeof(int);
+
+  for (int c_id = 0; c_id < n_configs; c_id++) {
+
+    const cs_lnum_t n_per_cell = _n_particles_per_cell[c_id];
+
+    cs_gnum_t n_g_particles = m->n_cells * n_per_cell;
+    cs_parall_counter(&n_g_particles, 1);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "  Particles per cell: %d (total: %llu)\n\n"
+                    "  Threads  Steps %12s %12s %12s %12s %12s %9s\n"),
+                  (int)n_per_cell, (unsigned long long)n_g_particles,
+                  _(_stage_name[0]), _(_stage_name[1]), _(_stage_name[2]),
+                  _(_stage_name[3]), _("ns/part."), _("Imbalance"));
+
+    /* Loop on number of threads (powers of 2 and maximum) */
+
+    int n_threads = 1;
+
+    while (n_threads <= n_threads_max) {
+
+#if defined(HAVE_OPENMP)
+      omp_set_num_threads(n_threads);
+#endif
+      cs_glob_n_threads = n_threads;
+
+      /* Use identical initial conditions for each configuration */
+
+      cs_random_seed(cs_glob_rank_id + 1);
+
+      _inject_particles(n_per_cell);
+
+      double t_stage[CS_LAGR_BENCHMARK_N_STAGES];
+
+      int n_steps = _time_steps(t_measure, u_ref, dt, t_stage);
+
+      _log_stage_times(n_threads, n_steps, n_g_particles, t_stage);
+
+      if (n_threads < n_threads_max)
+        n_threads = CS_MIN(n_threads*2, n_threads_max);
+      else
+        break;
+
+    }
+
+    cs_log_printf_flush(CS_LOG_PERFORMANCE);
+
+  }
+
+  /* Restore initial state */
+
+#if defined(HAVE_OPENMP)
+  omp_set_num_threads(n_threads_max);
+#endif
+  cs_glob_n_threads = n_threads_max;
+
+  cs_glob_lagr_particle_set->n_particles = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
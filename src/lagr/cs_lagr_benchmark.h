@@ -0,0 +1,68 @@
+#ifndef __CS_LAGR_BENCHMARK_H__
+#define __CS_LAGR_BENCHMARK_H__
+
+/*============================================================================
+ * Lagrangian module performance benchmark
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run Lagrangian module benchmark.
+ *
+ * Particles are transported in a prescribed flow on the current mesh,
+ * for several numbers of particles per cell and of threads, and the time
+ * spent in the main stages of a Lagrangian time step is logged.
+ *
+ * \param[in]  mpi_trace_mode  indicates if timing mode (0) or MPI
+ *                             trace-friendly mode (1) is to be used
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_benchmark(int  mpi_trace_mode);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_BENCHMARK_H__ */
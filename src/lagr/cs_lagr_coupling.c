@@ -196,6 +196,7 @@ cs_lagr_coupling(cs_real_t taup[],
   /* Finalisation des forces externes (Si la particule a interagit avec     */
   /* une frontiere du domaine de calcul, on degenere a l'ordre 1).     */
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
     cs_real_t aux1 = dtp / taup[npt];
@@ -211,6 +212,7 @@ cs_lagr_coupling(cs_real_t taup[],
 
   }
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
     cs_real_t  p_stat_w = cs_lagr_particles_get_real(p_set, npt, CS_LAGR_STAT_WEIGHT);
@@ -229,6 +231,17 @@ cs_lagr_coupling(cs_real_t taup[],
 
   }
 
+  /* Index of particles by cell: source terms are then gathered for each
+     cell from its particles instead of being scattered from each particle
+     to its cell, so that cell loops may be threaded without write
+     conflicts. Particles keep their relative order in each cell, so
+     the summation order (and thus the result) is the same as with
+     a loop on particles. */
+
+  cs_lnum_t *cell_idx = NULL, *p_ids = NULL;
+
+  cs_lagr_particle_set_index_by_cell(p_set, ncel, &cell_idx, &p_ids);
+
   /* ====================================================================   */
   /* 3. TERMES SOURCES DE QUANTITE DE MOUVEMENT    */
   /* ====================================================================   */
@@ -240,36 +253,41 @@ cs_lagr_coupling(cs_real_t taup[],
     else
       t_st_vel = st_vel;
 
-    for (cs_lnum_t i = 0; i < ncel; i++) {
+    cs_real_t *tslag_li = tslag + (lag_st->itsli-1) * ncelet;
+
+#   pragma omp parallel for if (ncel > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < ncel; iel++) {
+
       for (cs_lnum_t j = 0; j < 3; j++)
-        t_st_vel[i][j] = 0;
-    }
+        t_st_vel[iel][j] = 0;
 
-    for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+      for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+        cs_lnum_t npt = p_ids[i];
+
+        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
 
-      cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
-                                                      CS_LAGR_STAT_WEIGHT);
+        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
+                                                        CS_LAGR_STAT_WEIGHT);
 
-      cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_DIAMETER);
-      cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_MASS);
-      cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am,
-                                                    CS_LAGR_MASS);
+        cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                             CS_LAGR_DIAMETER);
+        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                             CS_LAGR_MASS);
+        cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am,
+                                                      CS_LAGR_MASS);
 
-      cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+        /* Volume et masse des particules dans la maille */
+        volp[iel] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
+        volm[iel] += p_stat_w * prev_p_mass;
 
-      /* Volume et masse des particules dans la maille */
-      volp[iel] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
-      volm[iel] += p_stat_w * prev_p_mass;
+        /* TS de QM   */
+        t_st_vel[iel][0] += - auxl1[npt];
+        t_st_vel[iel][1] += - auxl2[npt];
+        t_st_vel[iel][2] += - auxl3[npt];
+        tslag_li[iel] += - 2.0 * p_stat_w * p_mass / taup[npt];
 
-      /* TS de QM   */
-      t_st_vel[iel][0] += - auxl1[npt];
-      t_st_vel[iel][1] += - auxl2[npt];
-      t_st_vel[iel][2] += - auxl3[npt];
-      tslag[iel + (lag_st->itsli-1) * ncelet] += - 2.0 * p_stat_w * p_mass / taup[npt];
+      }
 
     }
 
@@ -283,31 +301,37 @@ cs_lagr_coupling(cs_real_t taup[],
       /* (difficile d'ecrire quoi que ce soit sur v2, qui perd son sens de */
       /*  "composante de Rij")     */
 
-      for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+      cs_real_t *tslag_ke = tslag + (lag_st->itske-1) * ncelet;
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t iel = 0; iel < ncel; iel++) {
+
+        for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
 
-        cs_lnum_t  iel         = cs_lagr_particle_get_cell_id(particle, p_am);
-        cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1,
+          cs_lnum_t npt = p_ids[i];
+
+          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+
+          cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1,
+                                                           CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am,
                                                          CS_LAGR_VELOCITY_SEEN);
-        cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am,
-                                                       CS_LAGR_VELOCITY_SEEN);
 
-        cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
-        cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
-        cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
+          cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
+          cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
+          cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
 
-        tslag[iel + (lag_st->itske-1) * ncelet] += - uuf * auxl1[npt]
-                                                   - vvf * auxl2[npt]
-                                                   - wwf * auxl3[npt];
+          tslag_ke[iel] += - uuf * auxl1[npt]
+                           - vvf * auxl2[npt]
+                           - wwf * auxl3[npt];
 
-      }
+        }
 
-      for (cs_lnum_t iel = 0; iel < ncel; iel++)
-        tslag[iel + (lag_st->itske-1) * ncelet]
-          += - extra->vel->val[iel * 3    ] * t_st_vel[iel][0]
-             - extra->vel->val[iel * 3 + 1] * t_st_vel[iel][1]
-             - extra->vel->val[iel * 3 + 2] * t_st_vel[iel][2];
+        tslag_ke[iel] += - extra->vel->val[iel * 3    ] * t_st_vel[iel][0]
+                         - extra->vel->val[iel * 3 + 1] * t_st_vel[iel][1]
+                         - extra->vel->val[iel * 3 + 2] * t_st_vel[iel][2];
+
+      }
 
     }
     else if (extra->itytur == 3) {
@@ -317,35 +341,35 @@ cs_lagr_coupling(cs_real_t taup[],
       else
         t_st_rij = st_rij;
 
-      for (cs_lnum_t i = 0; i < ncel; i++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t iel = 0; iel < ncel; iel++) {
+
         for (cs_lnum_t j = 0; j < 6; j++)
-          t_st_rij[i][j] = 0;
-      }
+          t_st_rij[iel][j] = 0;
 
-      for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+        for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+          cs_lnum_t npt = p_ids[i];
 
-        cs_lnum_t  iel         = cs_lagr_particle_get_cell_id(particle, p_am);
+          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
 
-        cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1,
+          cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1,
+                                                           CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am,
                                                          CS_LAGR_VELOCITY_SEEN);
-        cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am,
-                                                       CS_LAGR_VELOCITY_SEEN);
 
-        cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
-        cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
-        cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
+          cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
+          cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
+          cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
 
-        t_st_rij[iel][0] += - 2.0 * uuf * auxl1[npt];
-        t_st_rij[iel][1] += - 2.0 * vvf * auxl2[npt];
-        t_st_rij[iel][2] += - 2.0 * wwf * auxl3[npt];
-        t_st_rij[iel][3] += - uuf * auxl2[npt] - vvf * auxl1[npt];
-        t_st_rij[iel][4] += - vvf * auxl3[npt] - wwf * auxl2[npt];
-        t_st_rij[iel][5] += - uuf * auxl3[npt] - wwf * auxl1[npt];
+          t_st_rij[iel][0] += - 2.0 * uuf * auxl1[npt];
+          t_st_rij[iel][1] += - 2.0 * vvf * auxl2[npt];
+          t_st_rij[iel][2] += - 2.0 * wwf * auxl3[npt];
+          t_st_rij[iel][3] += - uuf * auxl2[npt] - vvf * auxl1[npt];
+          t_st_rij[iel][4] += - vvf * auxl3[npt] - wwf * auxl2[npt];
+          t_st_rij[iel][5] += - uuf * auxl3[npt] - wwf * auxl1[npt];
 
-      }
-      for (cs_lnum_t iel = 0; iel < ncel; iel++) {
+        }
 
         t_st_rij[iel][0] += - 2.0 * extra->vel->val[iel * 3    ]
                                   * t_st_vel[iel][0];
@@ -379,18 +403,24 @@ cs_lagr_coupling(cs_real_t taup[],
       && (   cs_glob_lagr_specific_physics->impvar == 1
           || cs_glob_lagr_specific_physics->idpvar == 1)) {
 
-    for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+    cs_real_t *tslag_mas = tslag + (lag_st->itsmas-1) * ncelet;
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+#   pragma omp parallel for if (ncel > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < ncel; iel++) {
 
-      cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
-      cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-      cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+      for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
 
-      /* Dans saturne TSmasse > 0 ===> Apport de masse sur le fluide  */
-      cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+        unsigned char *particle = p_set->p_buffer + p_am->extents * p_ids[i];
+
+        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+        cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
 
-      tslag[iel + (lag_st->itsmas-1) * ncelet] += - p_stat_w * (p_mass - prev_p_mass) / dtp;
+        /* Dans saturne TSmasse > 0 ===> Apport de masse sur le fluide  */
+
+        tslag_mas[iel] += - p_stat_w * (p_mass - prev_p_mass) / dtp;
+
+      }
 
     }
 
@@ -402,41 +432,50 @@ cs_lagr_coupling(cs_real_t taup[],
 
   if (cs_glob_lagr_source_terms->ltsthe == 1) {
 
+    cs_real_t *tslag_te = tslag + (lag_st->itste-1) * ncelet;
+    cs_real_t *tslag_ti = tslag + (lag_st->itsti-1) * ncelet;
+
     if (   cs_glob_lagr_model->physical_model == 1
         && cs_glob_lagr_specific_physics->itpvar == 1) {
 
-      for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
-
-        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
-        cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
-        cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
-        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-        cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
-        cs_real_t  prev_p_cp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
-        cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
-        cs_real_t  prev_p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
-        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
-
-        tslag[iel + (lag_st->itste-1) * ncelet] += - (p_mass * p_tmp * p_cp
-                                - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
-        tslag[iel + (lag_st->itsti-1) * ncelet] += tempct[nbpart + npt] * p_stat_w;
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t iel = 0; iel < ncel; iel++) {
 
-      }
-      if (extra->radiative_model > 0) {
+        for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
 
-        for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+          cs_lnum_t npt = p_ids[i];
 
           unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
-          cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
-          cs_real_t  p_diam = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_DIAMETER);
-          cs_real_t  p_eps = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_EMISSIVITY);
+          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+          cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
+          cs_real_t  prev_p_cp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
           cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
+          cs_real_t  prev_p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
           cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
 
-          cs_real_t aux1 = cs_math_pi * p_diam * p_diam * p_eps
-                          * (extra->luminance->val[iel] - 4.0 * _c_stephan * pow (p_tmp, 4));
+          tslag_te[iel] += - (p_mass * p_tmp * p_cp
+                              - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
+          tslag_ti[iel] += tempct[nbpart + npt] * p_stat_w;
 
-          tslag[iel + (lag_st->itste-1) * ncelet] += aux1 * p_stat_w;
+        }
+
+        if (extra->radiative_model > 0) {
+
+          for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
+
+            unsigned char *particle = p_set->p_buffer + p_am->extents * p_ids[i];
+            cs_real_t  p_diam = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_DIAMETER);
+            cs_real_t  p_eps = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_EMISSIVITY);
+            cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
+            cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+
+            cs_real_t aux1 = cs_math_pi * p_diam * p_diam * p_eps
+                            * (extra->luminance->val[iel] - 4.0 * _c_stephan * pow (p_tmp, 4));
+
+            tslag_te[iel] += aux1 * p_stat_w;
+
+          }
 
         }
 
@@ -450,30 +489,36 @@ cs_lagr_coupling(cs_real_t taup[],
 
       else {
 
-        for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#       pragma omp parallel for if (ncel > CS_THR_MIN)
+        for (cs_lnum_t iel = 0; iel < ncel; iel++) {
 
-          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+          for (cs_lnum_t i = cell_idx[iel]; i < cell_idx[iel+1]; i++) {
 
-          cs_lnum_t iel  = cs_lagr_particle_get_cell_id(particle, p_am);
-          cs_lnum_t icha = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_COAL_NUM);
+            cs_lnum_t npt = p_ids[i];
 
-          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
-          cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_TEMPERATURE);
-          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
+            unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
 
-          cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-          cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
-          cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
+            cs_lnum_t icha = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_COAL_NUM);
 
-          cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+            cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+            cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_TEMPERATURE);
+            cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
+
+            cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+            cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
+            cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
 
-          tslag[iel + (lag_st->itste-1) * ncelet]  += - (  p_mass * p_tmp * p_cp
-                                             - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
-          tslag[iel + (lag_st->itsti-1) * ncelet] += tempct[nbpart + npt] * p_stat_w;
-          tslag[iel + (lag_st->itsmv1[icha]-1) * ncelet] += p_stat_w * cpgd1[npt];
-          tslag[iel + (lag_st->itsmv2[icha]-1) * ncelet] += p_stat_w * cpgd2[npt];
-          tslag[iel + (lag_st->itsco-1) * ncelet] += p_stat_w * cpght[npt];
-          tslag[iel + (lag_st->itsfp4-1) * ncelet] = 0.0;
+            cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+
+            tslag_te[iel]  += - (  p_mass * p_tmp * p_cp
+                                 - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
+            tslag_ti[iel] += tempct[nbpart + npt] * p_stat_w;
+            tslag[iel + (lag_st->itsmv1[icha]-1) * ncelet] += p_stat_w * cpgd1[npt];
+            tslag[iel + (lag_st->itsmv2[icha]-1) * ncelet] += p_stat_w * cpgd2[npt];
+            tslag[iel + (lag_st->itsco-1) * ncelet] += p_stat_w * cpght[npt];
+            tslag[iel + (lag_st->itsfp4-1) * ncelet] = 0.0;
+
+          }
 
         }
 
@@ -483,6 +528,9 @@ cs_lagr_coupling(cs_real_t taup[],
 
   }
 
+  BFT_FREE(p_ids);
+  BFT_FREE(cell_idx);
+
   /* ====================================================================   */
   /* 7. Verif que le taux volumique maximal TVMAX admissible de particules  */
   /*    ne soit pas depasse dans quelques cellules.     */
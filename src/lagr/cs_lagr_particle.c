@@ -1210,6 +1210,281 @@ cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
   *((cs_lnum_t *)(p_buf + p_am->displ[1][CS_LAGR_RANK_ID])) = cs_glob_rank_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute for a range of particles
+ *        to a contiguous array.
+ *
+ * This allows computational kernels to work on a structure of arrays
+ * representation of the attributes they need, rather than on the
+ * complete particle data. Values of multiple-component attributes are
+ * interlaced, so that component j of particle i is placed at
+ * vals[(i - s_id)*count + j].
+ *
+ * \param[in]   particles  associated particle set
+ * \param[in]   s_id       id of first particle
+ * \param[in]   e_id       past-the-end particle id
+ * \param[in]   time_id    0 for current, 1 for previous
+ * \param[in]   attr       requested attribute id
+ * \param[out]  vals       attribute values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_gather(const cs_lagr_particle_set_t  *particles,
+                         cs_lnum_t                      s_id,
+                         cs_lnum_t                      e_id,
+                         int                            time_id,
+                         cs_lagr_attribute_t            attr,
+                         void                          *vals)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  assert(p_am->count[time_id][attr] > 0);
+
+  const size_t extents = p_am->extents;
+  const unsigned char *p_buf
+    = particles->p_buffer + extents*s_id + p_am->displ[time_id][attr];
+
+  const cs_lnum_t n_elts = e_id - s_id;
+
+  if (p_am->datatype[attr] == CS_REAL_TYPE) {
+    const int count = p_am->count[time_id][attr];
+    cs_real_t *_vals = vals;
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      const cs_real_t *p_vals = (const cs_real_t *)(p_buf + extents*i);
+      for (int j = 0; j < count; j++)
+        _vals[i*count + j] = p_vals[j];
+    }
+  }
+  else {
+    const size_t size = p_am->size[attr];
+    unsigned char *_vals = vals;
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      memcpy(_vals + size*i, p_buf + extents*i, size);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute for a range of particles
+ *        from a contiguous array.
+ *
+ * This is the reverse operation of \ref cs_lagr_particles_gather.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       s_id       id of first particle
+ * \param[in]       e_id       past-the-end particle id
+ * \param[in]       time_id    0 for current, 1 for previous
+ * \param[in]       attr       requested attribute id
+ * \param[in]       vals       attribute values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_scatter(cs_lagr_particle_set_t  *particles,
+                          cs_lnum_t                s_id,
+                          cs_lnum_t                e_id,
+                          int                      time_id,
+                          cs_lagr_attribute_t      attr,
+                          const void              *vals)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  assert(p_am->count[time_id][attr] > 0);
+
+  const size_t extents = p_am->extents;
+  unsigned char *p_buf
+    = particles->p_buffer + extents*s_id + p_am->displ[time_id][attr];
+
+  const cs_lnum_t n_elts = e_id - s_id;
+
+  if (p_am->datatype[attr] == CS_REAL_TYPE) {
+    const int count = p_am->count[time_id][attr];
+    const cs_real_t *_vals = vals;
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      cs_real_t *p_vals = (cs_real_t *)(p_buf + extents*i);
+      for (int j = 0; j < count; j++)
+        p_vals[j] = _vals[i*count + j];
+    }
+  }
+  else {
+    const size_t size = p_am->size[attr];
+    const unsigned char *_vals = vals;
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      memcpy(p_buf + extents*i, _vals + size*i, size);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder particles of a set by cell.
+ *
+ * A counting sort is used, so that particles in a given cell remain
+ * in the same relative order. Particles with a negative cell number
+ * (deposited particles) are sorted based on the absolute value of that
+ * number.
+ *
+ * If the cell_idx argument is non-NULL, it is filled with the
+ * cell->particles index, so that particles in cell i have ids
+ * cell_idx[i] to cell_idx[i+1] - 1.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       n_cells    number of cells
+ * \param[out]      cell_idx   cell->particles index (size: n_cells + 1),
+ *                             or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_idx[])
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  const cs_lnum_t n_particles = particles->n_particles;
+  const size_t extents = p_am->extents;
+  const ptrdiff_t cell_num_displ = p_am->displ[0][CS_LAGR_CELL_NUM];
+
+  cs_lnum_t *_cell_idx = cell_idx;
+  unsigned char *swap_buffer;
+
+  if (cell_idx == NULL)
+    BFT_MALLOC(_cell_idx, n_cells+1, cs_lnum_t);
+  BFT_MALLOC(swap_buffer, extents * ((size_t)n_particles), unsigned char);
+
+  /* Cell index (count first) and copy of unordered particle data */
+
+  for (cs_lnum_t i = 0; i < n_cells+1; i++)
+    _cell_idx[i] = 0;
+
+  memcpy(swap_buffer, particles->p_buffer, extents * ((size_t)n_particles));
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+
+    cs_lnum_t cell_num
+      = *((const cs_lnum_t *)(swap_buffer + extents*i + cell_num_displ));
+
+    assert(cell_num != 0);
+
+    _cell_idx[CS_ABS(cell_num)] += 1;
+
+  }
+
+  /* Convert count to index */
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _cell_idx[i+1] += _cell_idx[i];
+
+  assert(n_particles == _cell_idx[n_cells]);
+
+  /* Now copy particle data (using the index start as a position counter) */
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+
+    cs_lnum_t cell_num
+      = *((const cs_lnum_t *)(swap_buffer + extents*i + cell_num_displ));
+
+    cs_lnum_t cell_id = CS_ABS(cell_num) - 1;
+
+    cs_lnum_t particle_id = _cell_idx[cell_id];
+
+    _cell_idx[cell_id] += 1;
+
+    memcpy(particles->p_buffer + extents*particle_id,
+           swap_buffer + extents*i,
+           extents);
+
+  }
+
+  BFT_FREE(swap_buffer);
+
+  /* Restore index (shifted by one position in the copy loop) */
+
+  if (cell_idx != NULL) {
+    for (cs_lnum_t i = n_cells; i > 0; i--)
+      cell_idx[i] = cell_idx[i-1];
+    cell_idx[0] = 0;
+  }
+  else
+    BFT_FREE(_cell_idx);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build an index of particles of a set by cell, without reordering
+ *        the particles.
+ *
+ * Particles keep their relative order inside each cell, so that
+ * accumulation over a cell's particles follows the particle set order.
+ * Particles with a negative cell number (deposited particles) are indexed
+ * based on the absolute value of that number, and particles with no
+ * associated cell are ignored.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   particles  associated particle set
+ * \param[in]   n_cells    number of cells
+ * \param[out]  cell_idx   cell->particles index (size: n_cells + 1)
+ * \param[out]  p_ids      ids of particles, by cell
+ *                         (size: cell_idx[n_cells])
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_index_by_cell(const cs_lagr_particle_set_t   *particles,
+                                   cs_lnum_t                       n_cells,
+                                   cs_lnum_t                     **cell_idx,
+                                   cs_lnum_t                     **p_ids)
+{
+  const cs_lagr_attribute_map_t *p_am = particles->p_am;
+  const cs_lnum_t n_particles = particles->n_particles;
+
+  cs_lnum_t *_cell_idx, *_p_ids, *p_cell_id;
+
+  BFT_MALLOC(_cell_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(p_cell_id, n_particles, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    _cell_idx[i] = 0;
+
+# pragma omp parallel for if (n_particles > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    const unsigned char *particle = particles->p_buffer + p_am->extents * p_id;
+    p_cell_id[p_id] = cs_lagr_particle_get_cell_id(particle, p_am);
+  }
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    if (p_cell_id[p_id] >= 0)
+      _cell_idx[p_cell_id[p_id] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _cell_idx[i+1] += _cell_idx[i];
+
+  BFT_MALLOC(_p_ids, _cell_idx[n_cells], cs_lnum_t);
+
+  /* Use shifted index as insertion counters */
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    cs_lnum_t c_id = p_cell_id[p_id];
+    if (c_id >= 0) {
+      _p_ids[_cell_idx[c_id]] = p_id;
+      _cell_idx[c_id] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    _cell_idx[i] = _cell_idx[i-1];
+  _cell_idx[0] = 0;
+
+  BFT_FREE(p_cell_id);
+
+  *cell_idx = _cell_idx;
+  *p_ids = _p_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
@@ -1362,6 +1362,110 @@ void
 cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
                                       cs_lnum_t                particle_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute for a range of particles
+ *        to a contiguous array.
+ *
+ * This allows computational kernels to work on a structure of arrays
+ * representation of the attributes they need, rather than on the
+ * complete particle data. Values of multiple-component attributes are
+ * interlaced, so that component j of particle i is placed at
+ * vals[(i - s_id)*count + j].
+ *
+ * \param[in]   particles  associated particle set
+ * \param[in]   s_id       id of first particle
+ * \param[in]   e_id       past-the-end particle id
+ * \param[in]   time_id    0 for current, 1 for previous
+ * \param[in]   attr       requested attribute id
+ * \param[out]  vals       attribute values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_gather(const cs_lagr_particle_set_t  *particles,
+                         cs_lnum_t                      s_id,
+                         cs_lnum_t                      e_id,
+                         int                            time_id,
+                         cs_lagr_attribute_t            attr,
+                         void                          *vals);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute for a range of particles
+ *        from a contiguous array.
+ *
+ * This is the reverse operation of \ref cs_lagr_particles_gather.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       s_id       id of first particle
+ * \param[in]       e_id       past-the-end particle id
+ * \param[in]       time_id    0 for current, 1 for previous
+ * \param[in]       attr       requested attribute id
+ * \param[in]       vals       attribute values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_scatter(cs_lagr_particle_set_t  *particles,
+                          cs_lnum_t                s_id,
+                          cs_lnum_t                e_id,
+                          int                      time_id,
+                          cs_lagr_attribute_t      attr,
+                          const void              *vals);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder particles of a set by cell.
+ *
+ * A counting sort is used, so that particles in a given cell remain
+ * in the same relative order. Particles with a negative cell number
+ * (deposited particles) are sorted based on the absolute value of that
+ * number.
+ *
+ * If the cell_idx argument is non-NULL, it is filled with the
+ * cell->particles index, so that particles in cell i have ids
+ * cell_idx[i] to cell_idx[i+1] - 1.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       n_cells    number of cells
+ * \param[out]      cell_idx   cell->particles index (size: n_cells + 1),
+ *                             or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_idx[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build an index of particles of a set by cell, without reordering
+ *        the particles.
+ *
+ * Particles keep their relative order inside each cell, so that
+ * accumulation over a cell's particles follows the particle set order.
+ * Particles with a negative cell number (deposited particles) are indexed
+ * based on the absolute value of that number, and particles with no
+ * associated cell are ignored.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   particles  associated particle set
+ * \param[in]   n_cells    number of cells
+ * \param[out]  cell_idx   cell->particles index (size: n_cells + 1)
+ * \param[out]  p_ids      ids of particles, by cell
+ *                         (size: cell_idx[n_cells])
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_index_by_cell(const cs_lagr_particle_set_t   *particles,
+                                   cs_lnum_t                       n_cells,
+                                   cs_lnum_t                     **cell_idx,
+                                   cs_lnum_t                     **p_ids);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
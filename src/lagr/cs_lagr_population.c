@@ -0,0 +1,667 @@
+/*============================================================================
+ * Particle population control (parcel merging and splitting)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_mesh.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_population.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_lagr_population.c
+
+  \brief Particle population control.
+
+  When a cell contains more than a given number of parcels, statistically
+  similar parcels (i.e. of a same class, with close diameters and
+  velocities) are merged, conserving statistical weight, mass, momentum
+  and thermal energy. When a cell contains fewer than a given number of
+  parcels, the parcels with highest statistical weight are split into
+  two identical parcels of half weight, which then diverge through the
+  stochastic part of the trajectory equations.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Sort key for parcels in a given cell */
+
+typedef struct {
+
+  int        class_id;   /* statistical class */
+  cs_real_t  key;        /* diameter (merging) or opposite of weight
+                            (splitting) */
+  cs_lnum_t  p_id;       /* particle id */
+
+} cs_lagr_parcel_key_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_lagr_population_options_t _lagr_population_options
+  = {.n_max_per_cell = 0,
+     .n_min_per_cell = 0,
+     .merge_tolerance = 0.1,
+     .split_weight_min = 2.};
+
+/*============================================================================
+ * Global variables
+ *============================================================================*/
+
+cs_lagr_population_options_t *cs_glob_lagr_population_options
+  = &_lagr_population_options;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a particle is in the flow (i.e. neither deposited nor rolling).
+ *
+ * parameters:
+ *   particle <-- pointer to particle data
+ *   p_am     <-- pointer to particle attribute map
+ *
+ * returns:
+ *   true if particle is in the flow, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_in_flow(const unsigned char            *particle,
+         const cs_lagr_attribute_map_t  *p_am)
+{
+  if (cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_NUM) < 1)
+    return false;
+
+  if (p_am->size[CS_LAGR_DEPOSITION_FLAG] > 0) {
+    if (   cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG)
+        != CS_LAGR_PART_IN_FLOW)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Return statistical class of a particle.
+ *
+ * parameters:
+ *   particle <-- pointer to particle data
+ *   p_am     <-- pointer to particle attribute map
+ *
+ * returns:
+ *   statistical class of particle (0 if classes are not used)
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_class_id(const unsigned char            *particle,
+          const cs_lagr_attribute_map_t  *p_am)
+{
+  int class_id = 0;
+
+  if (p_am->size[CS_LAGR_STAT_CLASS] > 0)
+    class_id = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
+
+  return class_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare parcel keys (for qsort): by class, then key, then particle id.
+ *
+ * parameters:
+ *   x <-- pointer to first key
+ *   y <-- pointer to second key
+ *
+ * returns:
+ *   -1 if x < y, 1 if x > y, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_parcel_keys(const void  *x,
+                     const void  *y)
+{
+  const cs_lagr_parcel_key_t *k0 = x;
+  const cs_lagr_parcel_key_t *k1 = y;
+
+  if (k0->class_id < k1->class_id)
+    return -1;
+  else if (k0->class_id > k1->class_id)
+    return 1;
+  else if (k0->key < k1->key)
+    return -1;
+  else if (k0->key > k1->key)
+    return 1;
+  else if (k0->p_id < k1->p_id)
+    return -1;
+  else if (k0->p_id > k1->p_id)
+    return 1;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if two parcels are similar enough to be merged.
+ *
+ * parameters:
+ *   p0   <-- pointer to first particle data
+ *   p1   <-- pointer to second particle data
+ *   p_am <-- pointer to particle attribute map
+ *   tol  <-- relative tolerance on diameter and velocity
+ *
+ * returns:
+ *   true if parcels may be merged, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_similar_parcels(const unsigned char            *p0,
+                 const unsigned char            *p1,
+                 const cs_lagr_attribute_map_t  *p_am,
+                 cs_real_t                       tol)
+{
+  cs_real_t d0 = cs_lagr_particle_get_real(p0, p_am, CS_LAGR_DIAMETER);
+  cs_real_t d1 = cs_lagr_particle_get_real(p1, p_am, CS_LAGR_DIAMETER);
+
+  if (fabs(d0 - d1) > tol*fmax(d0, d1))
+    return false;
+
+  const cs_real_t *v0
+    = cs_lagr_particle_attr_const(p0, p_am, CS_LAGR_VELOCITY);
+  const cs_real_t *v1
+    = cs_lagr_particle_attr_const(p1, p_am, CS_LAGR_VELOCITY);
+
+  cs_real_t dv2 = 0, v0_2 = 0, v1_2 = 0;
+  for (int i = 0; i < 3; i++) {
+    dv2 += (v0[i] - v1[i])*(v0[i] - v1[i]);
+    v0_2 += v0[i]*v0[i];
+    v1_2 += v1[i]*v1[i];
+  }
+
+  if (dv2 > tol*tol*fmax(v0_2, v1_2))
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Merge a parcel into another one.
+ *
+ * Statistical weight, mass, momentum and thermal energy are conserved,
+ * as well as the total volume of particles. Other attributes (such as
+ * coordinates) are those of the parcel with the highest mass.
+ *
+ * parameters:
+ *   p_keep <-> pointer to data of particle which is kept
+ *   p_drop <-- pointer to data of particle merged into p_keep
+ *   p_am   <-- pointer to particle attribute map
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_parcels(unsigned char                  *p_keep,
+               const unsigned char            *p_drop,
+               const cs_lagr_attribute_map_t  *p_am)
+{
+  const cs_real_t w0 = cs_lagr_particle_get_real(p_keep, p_am,
+                                                 CS_LAGR_STAT_WEIGHT);
+  const cs_real_t w1 = cs_lagr_particle_get_real(p_drop, p_am,
+                                                 CS_LAGR_STAT_WEIGHT);
+  const cs_real_t m0 = cs_lagr_particle_get_real(p_keep, p_am,
+                                                 CS_LAGR_MASS);
+  const cs_real_t m1 = cs_lagr_particle_get_real(p_drop, p_am,
+                                                 CS_LAGR_MASS);
+
+  const cs_real_t w = w0 + w1;
+  const cs_real_t wm = w0*m0 + w1*m1;
+
+  /* Weight and mass fractions */
+
+  const cs_real_t a0 = w0/w, a1 = w1/w;
+  cs_real_t b0 = a0, b1 = a1;
+  if (wm > 0) {
+    b0 = w0*m0/wm;
+    b1 = w1*m1/wm;
+  }
+
+  /* Thermal energy (before mass and specific heat are updated) */
+
+  if (p_am->size[CS_LAGR_TEMPERATURE] > 0) {
+
+    cs_real_t cp0 = 1, cp1 = 1;
+    if (p_am->size[CS_LAGR_CP] > 0) {
+      cp0 = cs_lagr_particle_get_real(p_keep, p_am, CS_LAGR_CP);
+      cp1 = cs_lagr_particle_get_real(p_drop, p_am, CS_LAGR_CP);
+      cs_lagr_particle_set_real(p_keep, p_am, CS_LAGR_CP, b0*cp0 + b1*cp1);
+    }
+
+    const cs_real_t e0 = b0*cp0, e1 = b1*cp1;
+
+    if (e0 + e1 > 0) {
+
+      const int n_layers
+        = p_am->size[CS_LAGR_TEMPERATURE] / sizeof(cs_real_t);
+
+      cs_real_t *t0 = cs_lagr_particle_attr(p_keep, p_am, CS_LAGR_TEMPERATURE);
+      const cs_real_t *t1
+        = cs_lagr_particle_attr_const(p_drop, p_am, CS_LAGR_TEMPERATURE);
+
+      for (int l = 0; l < n_layers; l++)
+        t0[l] = (e0*t0[l] + e1*t1[l]) / (e0 + e1);
+
+    }
+
+  }
+
+  /* Momentum (mass-weighted velocities) */
+
+  const cs_lagr_attribute_t v_attr[] = {CS_LAGR_VELOCITY,
+                                        CS_LAGR_VELOCITY_SEEN};
+
+  for (int i = 0; i < 2; i++) {
+    cs_real_t *v0 = cs_lagr_particle_attr(p_keep, p_am, v_attr[i]);
+    const cs_real_t *v1 = cs_lagr_particle_attr_const(p_drop, p_am, v_attr[i]);
+    for (int j = 0; j < 3; j++)
+      v0[j] = b0*v0[j] + b1*v1[j];
+  }
+
+  /* Volume-conserving diameter */
+
+  {
+    const cs_real_t d0 = cs_lagr_particle_get_real(p_keep, p_am,
+                                                   CS_LAGR_DIAMETER);
+    const cs_real_t d1 = cs_lagr_particle_get_real(p_drop, p_am,
+                                                   CS_LAGR_DIAMETER);
+    cs_lagr_particle_set_real(p_keep, p_am, CS_LAGR_DIAMETER,
+                              cbrt(a0*d0*d0*d0 + a1*d1*d1*d1));
+  }
+
+  /* Weight-averaged attributes */
+
+  const cs_lagr_attribute_t w_attr[] = {CS_LAGR_RESIDENCE_TIME,
+                                        CS_LAGR_FLUID_TEMPERATURE,
+                                        CS_LAGR_EMISSIVITY};
+
+  for (int i = 0; i < 3; i++) {
+    if (p_am->size[w_attr[i]] > 0) {
+      const cs_real_t x0 = cs_lagr_particle_get_real(p_keep, p_am, w_attr[i]);
+      const cs_real_t x1 = cs_lagr_particle_get_real(p_drop, p_am, w_attr[i]);
+      cs_lagr_particle_set_real(p_keep, p_am, w_attr[i], a0*x0 + a1*x1);
+    }
+  }
+
+  /* Mass and weight */
+
+  cs_lagr_particle_set_real(p_keep, p_am, CS_LAGR_MASS, wm/w);
+  cs_lagr_particle_set_real(p_keep, p_am, CS_LAGR_STAT_WEIGHT, w);
+}
+
+/*----------------------------------------------------------------------------
+ * Merge similar parcels in a cell, until the number of parcels in the
+ * flow is reduced to a given maximum or no similar parcels remain.
+ *
+ * parameters:
+ *   p_set  <-> pointer to particle set
+ *   s_id   <-- id of first particle in cell
+ *   e_id   <-- past-the-end id of particles in cell
+ *   n_max  <-- target maximum number of parcels in the flow
+ *   tol    <-- relative tolerance on diameter and velocity
+ *   keys   --- work array for parcel keys (size: e_id - s_id)
+ *   p_flag <-> particle flag (0: kept, 1: removed, 2: split)
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_cell_parcels(cs_lagr_particle_set_t  *p_set,
+                    cs_lnum_t                s_id,
+                    cs_lnum_t                e_id,
+                    cs_lnum_t                n_max,
+                    cs_real_t                tol,
+                    cs_lagr_parcel_key_t     keys[],
+                    char                     p_flag[])
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  const size_t extents = p_am->extents;
+
+  while (true) {
+
+    /* Candidate parcels, sorted by class and diameter */
+
+    cs_lnum_t n_c = 0;
+
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      const unsigned char *particle = p_set->p_buffer + extents*j;
+      if (p_flag[j] == 0 && _in_flow(particle, p_am)) {
+        keys[n_c].class_id = _class_id(particle, p_am);
+        keys[n_c].key = cs_lagr_particle_get_real(particle, p_am,
+                                                  CS_LAGR_DIAMETER);
+        keys[n_c].p_id = j;
+        n_c++;
+      }
+    }
+
+    if (n_c <= n_max)
+      break;
+
+    qsort(keys, n_c, sizeof(cs_lagr_parcel_key_t), _compare_parcel_keys);
+
+    /* Merge neighboring parcels in sort order */
+
+    const cs_lnum_t n_excess = n_c - n_max;
+    cs_lnum_t n_merged = 0;
+
+    cs_lnum_t k = 0;
+    while (k + 1 < n_c && n_merged < n_excess) {
+
+      cs_lnum_t j0 = keys[k].p_id, j1 = keys[k+1].p_id;
+      unsigned char *p0 = p_set->p_buffer + extents*j0;
+      unsigned char *p1 = p_set->p_buffer + extents*j1;
+
+      if (   keys[k].class_id == keys[k+1].class_id
+          && _similar_parcels(p0, p1, p_am, tol)) {
+
+        /* Keep the parcel with highest mass */
+
+        cs_real_t wm0
+          =   cs_lagr_particle_get_real(p0, p_am, CS_LAGR_STAT_WEIGHT)
+            * cs_lagr_particle_get_real(p0, p_am, CS_LAGR_MASS);
+        cs_real_t wm1
+          =   cs_lagr_particle_get_real(p1, p_am, CS_LAGR_STAT_WEIGHT)
+            * cs_lagr_particle_get_real(p1, p_am, CS_LAGR_MASS);
+
+        if (wm1 > wm0) {
+          _merge_parcels(p1, p0, p_am);
+          p_flag[j0] = 1;
+        }
+        else {
+          _merge_parcels(p0, p1, p_am);
+          p_flag[j1] = 1;
+        }
+
+        n_merged++;
+        k += 2;
+
+      }
+      else
+        k += 1;
+
+    }
+
+    if (n_merged == 0)
+      break;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Select parcels to split in a cell, by decreasing statistical weight.
+ *
+ * parameters:
+ *   p_set  <-- pointer to particle set
+ *   s_id   <-- id of first particle in cell
+ *   e_id   <-- past-the-end id of particles in cell
+ *   n_min  <-- target minimum number of parcels in the flow
+ *   w_min  <-- minimum statistical weight of split parcels
+ *   keys   --- work array for parcel keys (size: e_id - s_id)
+ *   p_flag <-> particle flag (0: kept, 1: removed, 2: split)
+ *
+ * returns:
+ *   number of parcels to split
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_select_cell_splits(const cs_lagr_particle_set_t  *p_set,
+                    cs_lnum_t                      s_id,
+                    cs_lnum_t                      e_id,
+                    cs_lnum_t                      n_min,
+                    cs_real_t                      w_min,
+                    cs_lagr_parcel_key_t           keys[],
+                    char                           p_flag[])
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  const size_t extents = p_am->extents;
+
+  cs_lnum_t n_in_flow = 0, n_c = 0;
+
+  for (cs_lnum_t j = s_id; j < e_id; j++) {
+    const unsigned char *particle = p_set->p_buffer + extents*j;
+    if (_in_flow(particle, p_am)) {
+      n_in_flow++;
+      cs_real_t w = cs_lagr_particle_get_real(particle, p_am,
+                                              CS_LAGR_STAT_WEIGHT);
+      if (w >= w_min) {
+        keys[n_c].class_id = 0;
+        keys[n_c].key = -w;
+        keys[n_c].p_id = j;
+        n_c++;
+      }
+    }
+  }
+
+  if (n_in_flow == 0 || n_in_flow >= n_min || n_c == 0)
+    return 0;
+
+  qsort(keys, n_c, sizeof(cs_lagr_parcel_key_t), _compare_parcel_keys);
+
+  cs_lnum_t n_split = CS_MIN(n_min - n_in_flow, n_c);
+
+  for (cs_lnum_t k = 0; k < n_split; k++)
+    p_flag[keys[k].p_id] = 2;
+
+  return n_split;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge or split parcels so as to bound the number of parcels
+ *        per cell.
+ *
+ * Only particles in the flow are considered. Merged parcels conserve
+ * statistical weight, mass, momentum and thermal energy; split parcels
+ * share their statistical weight equally.
+ *
+ * Particles are reordered by cell.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void)
+{
+  const cs_lagr_population_options_t *options
+    = cs_glob_lagr_population_options;
+
+  if (options->n_max_per_cell < 1 && options->n_min_per_cell < 1)
+    return;
+
+  /* Coal particles carry many coupled attributes; not handled here */
+
+  if (cs_glob_lagr_model->physical_model == 2)
+    return;
+
+  cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  const size_t extents = p_am->extents;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  /* Group particles by cell */
+
+  cs_lnum_t *cell_idx;
+  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
+
+  cs_lagr_particle_set_sort_by_cell(p_set, n_cells, cell_idx);
+
+  cs_lnum_t n_max_c = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    n_max_c = CS_MAX(n_max_c, cell_idx[c_id+1] - cell_idx[c_id]);
+
+  char *p_flag;
+  BFT_MALLOC(p_flag, n_particles, char);
+  for (cs_lnum_t j = 0; j < n_particles; j++)
+    p_flag[j] = 0;
+
+  cs_lnum_t *split_idx;
+  BFT_MALLOC(split_idx, n_cells+1, cs_lnum_t);
+  split_idx[0] = 0;
+
+  /* Merge parcels or select parcels to split, cell by cell */
+
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+    cs_lagr_parcel_key_t *keys;
+    BFT_MALLOC(keys, n_max_c, cs_lagr_parcel_key_t);
+
+#   pragma omp for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+      const cs_lnum_t s_id = cell_idx[c_id];
+      const cs_lnum_t e_id = cell_idx[c_id+1];
+
+      split_idx[c_id+1] = 0;
+
+      if (options->n_max_per_cell > 0 && e_id - s_id > options->n_max_per_cell)
+        _merge_cell_parcels(p_set, s_id, e_id,
+                            options->n_max_per_cell,
+                            options->merge_tolerance,
+                            keys, p_flag);
+
+      else if (e_id - s_id < options->n_min_per_cell)
+        split_idx[c_id+1]
+          = _select_cell_splits(p_set, s_id, e_id,
+                                options->n_min_per_cell,
+                                options->split_weight_min,
+                                keys, p_flag);
+
+    }
+
+    BFT_FREE(keys);
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    split_idx[c_id+1] += split_idx[c_id];
+
+  /* Append split parcels */
+
+  cs_lnum_t n_split = split_idx[n_cells];
+
+  if (n_split > 0) {
+
+    cs_lagr_particle_set_resize(n_particles + n_split);
+
+    if (p_set->n_particles_max < n_particles + n_split) {
+      for (cs_lnum_t j = 0; j < n_particles; j++) {
+        if (p_flag[j] == 2)
+          p_flag[j] = 0;
+      }
+      n_split = 0;
+    }
+
+    else {
+
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        cs_lnum_t k = n_particles + split_idx[c_id];
+        for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
+          if (p_flag[j] == 2) {
+            unsigned char *particle = p_set->p_buffer + extents*j;
+            cs_real_t w = cs_lagr_particle_get_real(particle, p_am,
+                                                    CS_LAGR_STAT_WEIGHT);
+            cs_lagr_particle_set_real(particle, p_am,
+                                      CS_LAGR_STAT_WEIGHT, 0.5*w);
+            memcpy(p_set->p_buffer + extents*k, particle, extents);
+            k++;
+          }
+        }
+      }
+
+    }
+
+  }
+
+  BFT_FREE(split_idx);
+  BFT_FREE(cell_idx);
+
+  /* Remove merged parcels (keeping relative order) */
+
+  cs_lnum_t particle_count = 0;
+
+  for (cs_lnum_t j = 0; j < n_particles + n_split; j++) {
+    if (j < n_particles && p_flag[j] == 1)
+      continue;
+    if (particle_count < j)
+      memcpy(p_set->p_buffer + extents*particle_count,
+             p_set->p_buffer + extents*j,
+             extents);
+    particle_count++;
+  }
+
+  p_set->n_particles = particle_count;
+
+  BFT_FREE(p_flag);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,97 @@
+#ifndef __CS_LAGR_POPULATION_H__
+#define __CS_LAGR_POPULATION_H__
+
+/*============================================================================
+ * Particle population control (parcel merging and splitting)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Particle population control options */
+
+typedef struct {
+
+  /*! number of parcels in a cell above which statistically similar parcels
+    of a same class are merged (0: no merging) */
+  int        n_max_per_cell;
+
+  /*! number of parcels in a cell below which parcels are split
+    (0: no splitting) */
+  int        n_min_per_cell;
+
+  /*! relative tolerance on diameter and velocity below which
+    two parcels are considered similar */
+  cs_real_t  merge_tolerance;
+
+  /*! minimum statistical weight of a parcel for it to be split */
+  cs_real_t  split_weight_min;
+
+} cs_lagr_population_options_t;
+
+/*=============================================================================
+ * Global variables
+ *============================================================================*/
+
+/* Pointer to global population control options structure */
+
+extern cs_lagr_population_options_t  *cs_glob_lagr_population_options;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge or split parcels so as to bound the number of parcels
+ *        per cell.
+ *
+ * Only particles in the flow are considered. Merged parcels conserve
+ * statistical weight, mass, momentum and thermal energy; split parcels
+ * share their statistical weight equally.
+ *
+ * Particles are reordered by cell.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_POPULATION_H__ */
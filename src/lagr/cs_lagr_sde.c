@@ -71,6 +71,47 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Number of particles handled together by the 1st order integration kernels */
+
+#define CS_LAGR_SDE_BATCH_SIZE  64
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Batch of particles for the 1st order integration kernels.
+   Values are stored component by component, so that the integration
+   loops have unit stride over the particles of a batch. */
+
+typedef struct {
+
+  cs_lnum_t  n;                                   /* number of particles */
+  cs_lnum_t  p_id[CS_LAGR_SDE_BATCH_SIZE];        /* particle ids */
+
+  cs_real_t  taup[CS_LAGR_SDE_BATCH_SIZE];        /* dynamic time */
+  cs_real_t  ddbr[CS_LAGR_SDE_BATCH_SIZE];        /* Brownian diffusion */
+
+  cs_real_t  tlag[3][CS_LAGR_SDE_BATCH_SIZE];     /* fluid time */
+  cs_real_t  bx2[3][CS_LAGR_SDE_BATCH_SIZE];      /* squared diffusion
+                                                     coefficient */
+  cs_real_t  tci[3][CS_LAGR_SDE_BATCH_SIZE];      /* II*TL + <u> */
+  cs_real_t  force[3][CS_LAGR_SDE_BATCH_SIZE];    /* forces * taup */
+  cs_real_t  gauss[3][3][CS_LAGR_SDE_BATCH_SIZE]; /* gaussian variables */
+
+  cs_real_t  old_vel[3][CS_LAGR_SDE_BATCH_SIZE];
+  cs_real_t  old_vel_seen[3][CS_LAGR_SDE_BATCH_SIZE];
+  cs_real_t  old_coords[3][CS_LAGR_SDE_BATCH_SIZE];
+
+  cs_real_t  vel[3][CS_LAGR_SDE_BATCH_SIZE];
+  cs_real_t  vel_seen[3][CS_LAGR_SDE_BATCH_SIZE];
+  cs_real_t  coords[3][CS_LAGR_SDE_BATCH_SIZE];
+
+} cs_lagr_sde_batch_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -88,306 +129,549 @@ static const double _k_boltz = 1.38e-23;
  * Private function definitions
  *============================================================================*/
 
-/*----------------------------------------------------------------------------*/
-/* \brief Integration of SDEs by 1st order scheme
+/*----------------------------------------------------------------------------
+ * Compute the fluid temperature seen by the 1st order scheme in a given cell.
  *
- * \param[in]  taup      temps caracteristique dynamique
- * \param[in]  tlag      temps caracteristique fluide
- * \param[in]  piil      terme dans l'integration des eds up
- * \param[in]  bx        caracteristiques de la turbulence
- * \param[in]  vagaus    variables aleatoires gaussiennes
- * \param[in]  gradpr    pressure gradient
- * \param[in]  romp      masse volumique des particules
- * \param[in]  fextla    champ de forces exterieur utilisateur (m/s2)
- * \param[out] terbru
- */
-/*------------------------------------------------------------------------------*/
+ * parameters:
+ *   extra   <-- pointer to Lagrangian extra module
+ *   cell_id <-- cell id
+ *
+ * returns:
+ *   fluid temperature (in Kelvin)
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_fluid_temperature(cs_lagr_extra_module_t  *extra,
+                   cs_lnum_t                cell_id)
+{
+  cs_real_t tkelvi =  273.15;
+  cs_real_t tempf;
+
+  if (   cs_glob_physical_model_flag[CS_COMBUSTION_COAL] >= 0
+      || cs_glob_physical_model_flag[CS_COMBUSTION_PCLC] >= 0)
+    tempf = extra->t_gaz->val[cell_id];
+
+  else if (   cs_glob_physical_model_flag[CS_COMBUSTION_3PT] >= 0
+           || cs_glob_physical_model_flag[CS_COMBUSTION_EBU] >= 0
+           || cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] >= 0
+           || cs_glob_physical_model_flag[CS_JOULE_EFFECT] >= 0)
+    tempf = extra->temperature->val[cell_id];
+
+  else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
+           && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS)
+    tempf = extra->scal_t->val[cell_id] + tkelvi;
+
+  else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
+           && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_KELVIN)
+    tempf = extra->scal_t->val[cell_id];
+
+  else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY) {
+
+    cs_lnum_t mode  = 1;
+    CS_PROCF (usthht,USTHHT) (&mode, &(extra->scal_t->val[cell_id]), &tempf);
+
+    tempf = tempf + tkelvi;
+
+  }
+
+  else
+    tempf = cs_glob_fluid_properties->t0;
+
+  return tempf;
+}
+
+/*----------------------------------------------------------------------------
+ * Gather particle and fluid values used by the 1st order integration
+ * kernels for a batch of particles.
+ *
+ * The particle ids of the batch must be set before calling this function.
+ *
+ * parameters:
+ *   p_set  <-- pointer to particle set
+ *   taup   <-- dynamic characteristic time
+ *   tlag   <-- fluid characteristic time
+ *   piil   <-- term in integration of U-P SDEs
+ *   bx     <-- turbulence characteristics
+ *   vagaus <-- gaussian random variables
+ *   gradpr <-- pressure gradient
+ *   romp   <-- particle density
+ *   fextla <-- user external force field (m/s2)
+ *   brown  <-- compute Brownian diffusion coefficient ?
+ *   b      <-> batch of particles
+ *----------------------------------------------------------------------------*/
 
 static void
-_lages1(cs_real_t           dtp,
-        const cs_real_t     taup[],
-        const cs_real_3_t   tlag[],
-        const cs_real_3_t   piil[],
-        const cs_real_33_t  bx[],
-        const cs_real_33_t  vagaus[],
-        const cs_real_3_t   gradpr[],
-        const cs_real_t     romp[],
-        const cs_real_t     brgaus[],
-        cs_real_t          *terbru,
-        cs_real_3_t        *fextla)
+_sde_batch_gather(const cs_lagr_particle_set_t  *p_set,
+                  const cs_real_t                taup[],
+                  const cs_real_3_t              tlag[],
+                  const cs_real_3_t              piil[],
+                  const cs_real_33_t             bx[],
+                  const cs_real_33_t             vagaus[],
+                  const cs_real_3_t              gradpr[],
+                  const cs_real_t                romp[],
+                  const cs_real_3_t              fextla[],
+                  bool                           brown,
+                  cs_lagr_sde_batch_t           *b)
 {
-  /* Particles management */
-  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
   const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
 
   cs_lagr_extra_module_t *extra = cs_get_lagr_extra_module();
 
-  /* Initialisations*/
-
   const cs_real_t  *grav  = cs_glob_physical_constants->gravity;
+  const cs_real_t  *vel_f = extra->vel->vals[1];
 
-  cs_real_t tkelvi =  273.15;
+  const cs_lnum_t nor = cs_glob_lagr_time_step->nor;
 
-  cs_real_t vitf = 0.0;
+  /* Added-mass coefficients (reducing to the standard force otherwise) */
 
-  cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
-  cs_real_t ter1f, ter2f, ter3f;
-  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
-  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
-  cs_real_t p11, p21, p22, p31, p32, p33;
-  cs_real_t omega2, gama2, omegam;
-  cs_real_t grga2, gagam, gaome;
-  cs_real_t tbrix1, tbrix2, tbriu;
+  cs_real_t am_num = 1.0, am_den = 0.0;
+  if (cs_glob_lagr_time_scheme->iadded_mass != 0) {
+    am_num = 1.0 + 0.5 * cs_glob_lagr_time_scheme->added_mass_const;
+    am_den = 0.5 * cs_glob_lagr_time_scheme->added_mass_const;
+  }
 
-  cs_lnum_t nor = cs_glob_lagr_time_step->nor;
+  for (cs_lnum_t i = 0; i < b->n; i++) {
 
-  cs_real_t added_mass_const = cs_glob_lagr_time_scheme->added_mass_const;
+    const cs_lnum_t ip = b->p_id[i];
+    const unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
 
-  /* Integrate SDE's over particles */
+    const cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_am);
 
-  for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+    const cs_real_t *old_part_vel
+      = cs_lagr_particle_attr_n_const(particle, p_am, 1, CS_LAGR_VELOCITY);
+    const cs_real_t *old_part_vel_seen
+      = cs_lagr_particle_attr_n_const(particle, p_am, 1,
+                                      CS_LAGR_VELOCITY_SEEN);
+    const cs_real_t *old_part_coords
+      = cs_lagr_particle_attr_n_const(particle, p_am, 1, CS_LAGR_COORDS);
 
-    unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+    const cs_real_t rom = extra->cromf->val[cell_id];
 
-    cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_am);
+    b->taup[i] = taup[ip];
 
-    if (cell_id >= 0) {
+    for (cs_lnum_t id = 0; id < 3; id++) {
 
-      cs_real_t *old_part_vel      = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY);
-      cs_real_t *old_part_vel_seen = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_vel          = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY);
-      cs_real_t *part_vel_seen     = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_coords       = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_COORDS);
-      cs_real_t *old_part_coords   = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_COORDS);
+      b->tlag[id][i] = tlag[ip][id];
+      b->bx2[id][i] = cs_math_sq(bx[ip][id][nor-1]);
+      b->tci[id][i] = piil[ip][id] * tlag[ip][id] + vel_f[cell_id*3 + id];
+      b->force[id][i] = (  - gradpr[cell_id][id] / romp[ip] * am_num
+                         / (1.0 + am_den * rom / romp[ip])
+                         + grav[id] + fextla[ip][id]) * taup[ip];
 
-      cs_real_t rom = extra->cromf->val[cell_id];
+      for (cs_lnum_t k = 0; k < 3; k++)
+        b->gauss[k][id][i] = vagaus[ip][id][k];
 
-      for (cs_lnum_t id = 0; id < 3; id++) {
+      b->old_vel[id][i] = old_part_vel[id];
+      b->old_vel_seen[id][i] = old_part_vel_seen[id];
+      b->old_coords[id][i] = old_part_coords[id];
 
-        vitf = extra->vel->vals[1][cell_id * 3 + id];
+    }
 
-        /* --> (2.1) Calcul preliminaires :    */
-        /* ----------------------------   */
-        /* calcul de II*TL+<u> et [(grad<P>/rhop+g)*tau_p+<Uf>] ?  */
+    if (brown) {
+      cs_real_t tempf = _fluid_temperature(extra, cell_id);
+      cs_real_t p_mass = cs_lagr_particle_get_real(particle, p_am,
+                                                   CS_LAGR_MASS);
+      b->ddbr[i] = sqrt(2.0 * _k_boltz * tempf / (p_mass * taup[ip]));
+    }
 
-        cs_real_t tci = piil[ip][id] * tlag[ip][id] + vitf;
-        cs_real_t force = 0.0;
+  }
+}
 
-        if (cs_glob_lagr_time_scheme->iadded_mass == 0)
-          force = (- gradpr[cell_id][id] / romp[ip]
-                   + grav[id] + fextla[ip][id]) * taup[ip];
+/*----------------------------------------------------------------------------
+ * Scatter updated particle coordinates, velocity and velocity seen
+ * from a batch of particles.
+ *
+ * parameters:
+ *   p_set <-> pointer to particle set
+ *   b     <-- batch of particles
+ *----------------------------------------------------------------------------*/
 
-        /* Added-mass term?     */
-        else
-          force =   (- gradpr[cell_id][id] / romp[ip]
-                     * (1.0 + 0.5 * added_mass_const)
-                  / (1.0 + 0.5 * added_mass_const * rom / romp[ip])
-                  + grav[id] + fextla[ip][id]) * taup[ip];
-
-
-        /* --> (2.2) Calcul des coefficients/termes deterministes */
-        /* ----------------------------------------------------    */
-
-        aux1 = exp(-dtp / taup[ip]);
-        aux2 = exp(-dtp / tlag[ip][id]);
-        aux3 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
-        aux4 = tlag[ip][id] / (tlag[ip][id] + taup[ip]);
-        aux5 = tlag[ip][id] * (1.0 - aux2);
-        aux6 = pow(bx[ip][id][nor-1],2.0) * tlag[ip][id];
-        aux7 = tlag[ip][id] - taup[ip];
-        aux8 = pow(bx[ip][id][nor-1],2.0) * pow(aux3, 2);
-
-        /* --> trajectory terms */
-        cs_real_t aa = taup[ip] * (1.0 - aux1);
-        cs_real_t bb = (aux5 - aa) * aux3;
-        cs_real_t cc = dtp - aa - bb;
-
-        ter1x = aa * old_part_vel[id];
-        ter2x = bb * old_part_vel_seen[id];
-        ter3x = cc * tci;
-        ter4x = (dtp - aa) * force;
-
-        /* --> flow-seen velocity terms   */
-        ter1f = old_part_vel_seen[id] * aux2;
-        ter2f = tci * (1.0 - aux2);
-
-        /* --> termes pour la vitesse des particules     */
-        cs_real_t dd = aux3 * (aux2 - aux1);
-        cs_real_t ee = 1.0 - aux1;
-
-        ter1p = old_part_vel[id] * aux1;
-        ter2p = old_part_vel_seen[id] * dd;
-        ter3p = tci * (ee - dd);
-        ter4p = force * ee;
-
-        /* --> integrale sur la vitesse du fluide vu     */
-        gama2  = 0.5 * (1.0 - aux2 * aux2);
-        p11   = sqrt(gama2 * aux6);
-        ter3f = p11 * vagaus[ip][id][0];
-
-        /* --> integral for the particles velocity  */
-        aux9  = 0.5 * tlag[ip][id] * (1.0 - aux2 * aux2);
-        aux10 = 0.5 * taup[ip] * (1.0 - aux1 * aux1);
-        aux11 =   taup[ip] * tlag[ip][id]
-                * (1.0 - aux1 * aux2)
-                / (taup[ip] + tlag[ip][id]);
-
-        grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
-        gagam = (aux9 - aux11) * (aux8 / aux3);
-
-        if (CS_ABS(p11) > cs_math_epzero) {
-
-          p21 = gagam / p11;
-          p22 = grga2 - pow(p21, 2);
-          p22 = sqrt(CS_MAX(0.0, p22));
+static void
+_sde_batch_scatter(cs_lagr_particle_set_t     *p_set,
+                   const cs_lagr_sde_batch_t  *b)
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
 
-        }
-        else {
+  for (cs_lnum_t i = 0; i < b->n; i++) {
 
-          p21 = 0.0;
-          p22 = 0.0;
+    unsigned char *particle = p_set->p_buffer + p_am->extents * b->p_id[i];
 
-        }
+    cs_real_t *part_vel
+      = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY);
+    cs_real_t *part_vel_seen
+      = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
+    cs_real_t *part_coords
+      = cs_lagr_particle_attr(particle, p_am, CS_LAGR_COORDS);
 
-        ter5p = p21 * vagaus[ip][id][0] + p22 * vagaus[ip][id][1];
-
-        /* --> (2.3) Calcul des coefficients pour les integrales stochastiques :  */
-        /* --> integrale sur la position des particules  */
-        gaome = ( (tlag[ip][id] - taup[ip]) * (aux5 - aa)
-                  - tlag[ip][id] * aux9
-                  - taup[ip] * aux10
-                  + (tlag[ip][id] + taup[ip]) * aux11)
-                * aux8;
-        omegam = aux3 * ( (tlag[ip][id] - taup[ip]) * (1.0 - aux2)
-                          - 0.5 * tlag[ip][id] * (1.0 - aux2 * aux2)
-                          + pow(taup[ip],2) / (tlag[ip][id] + taup[ip]) * (1.0 - aux1 * aux2)
-                          ) * aux6;
-        omega2 =   aux7 * (aux7 * dtp - 2.0 * (tlag[ip][id] * aux5 - taup[ip] * aa))
-                 + 0.5 * tlag[ip][id] * tlag [ip][id] * aux5 * (1.0 + aux2)
-                 + 0.5 * taup[ip] * taup[ip] * aa * (1.0 + aux1)
-                 - 2.0 * aux4 * tlag[ip][id] * taup[ip] * taup[ip] * (1.0 - aux1* aux2);
-        omega2 = aux8 * omega2;
-
-        if (p11 > cs_math_epzero)
-          p31 = omegam / p11;
-        else
-          p31 = 0.0;
+    for (cs_lnum_t id = 0; id < 3; id++) {
+      part_coords[id] = b->coords[id][i];
+      part_vel_seen[id] = b->vel_seen[id][i];
+      part_vel[id] = b->vel[id][i];
+    }
 
-        if (p22 > cs_math_epzero)
-          p32 = (gaome - p31 * p21) / p22;
-        else
-          p32 = 0.0;
+  }
+}
 
-        p33 = omega2 - pow(p31, 2) - pow(p32, 2);
-        p33 = sqrt(CS_MAX(0.0, p33));
-        ter5x = p31 * vagaus[ip][id][0] + p32 * vagaus[ip][id][1] + p33 * vagaus[ip][id][2];
+/*----------------------------------------------------------------------------
+ * Integrate SDEs by the 1st order scheme for a batch of particles.
+ *
+ * parameters:
+ *   dtp    <-- Lagrangian time step
+ *   brgaus <-- gaussian variables for Brownian motion, or NULL
+ *   terbru --> Brownian velocity term, or NULL
+ *   b      <-> batch of particles
+ *----------------------------------------------------------------------------*/
 
-        /* --> (2.3) Calcul des Termes dans le cas du mouvement Brownien :   */
-        if (cs_glob_lagr_brownian->lamvbr == 1) {
+static void
+_sde_batch_lages1(cs_real_t             dtp,
+                  const cs_real_t       brgaus[],
+                  cs_real_t            *terbru,
+                  cs_lagr_sde_batch_t  *b)
+{
+  const cs_lnum_t n = b->n;
+  const cs_real_t *taup = b->taup;
+
+  for (cs_lnum_t id = 0; id < 3; id++) {
+
+    const cs_real_t *tlag = b->tlag[id];
+    const cs_real_t *bx2 = b->bx2[id];
+    const cs_real_t *tci = b->tci[id];
+    const cs_real_t *force = b->force[id];
+    const cs_real_t *g0 = b->gauss[0][id];
+    const cs_real_t *g1 = b->gauss[1][id];
+    const cs_real_t *g2 = b->gauss[2][id];
+    const cs_real_t *old_vel = b->old_vel[id];
+    const cs_real_t *old_vel_seen = b->old_vel_seen[id];
+    const cs_real_t *old_coords = b->old_coords[id];
+
+    cs_real_t *vel = b->vel[id];
+    cs_real_t *vel_seen = b->vel_seen[id];
+    cs_real_t *coords = b->coords[id];
+
+#   pragma omp simd
+    for (cs_lnum_t i = 0; i < n; i++) {
+
+      /* Deterministic coefficients and terms */
+
+      cs_real_t aux1 = exp(-dtp / taup[i]);
+      cs_real_t aux2 = exp(-dtp / tlag[i]);
+      cs_real_t aux3 = tlag[i] / (tlag[i] - taup[i]);
+      cs_real_t aux4 = tlag[i] / (tlag[i] + taup[i]);
+      cs_real_t aux5 = tlag[i] * (1.0 - aux2);
+      cs_real_t aux6 = bx2[i] * tlag[i];
+      cs_real_t aux7 = tlag[i] - taup[i];
+      cs_real_t aux8 = bx2[i] * cs_math_sq(aux3);
+
+      /* trajectory terms */
+      cs_real_t aa = taup[i] * (1.0 - aux1);
+      cs_real_t bb = (aux5 - aa) * aux3;
+      cs_real_t cc = dtp - aa - bb;
+
+      cs_real_t ter1x = aa * old_vel[i];
+      cs_real_t ter2x = bb * old_vel_seen[i];
+      cs_real_t ter3x = cc * tci[i];
+      cs_real_t ter4x = (dtp - aa) * force[i];
+
+      /* flow-seen velocity terms */
+      cs_real_t ter1f = old_vel_seen[i] * aux2;
+      cs_real_t ter2f = tci[i] * (1.0 - aux2);
+
+      /* particle velocity terms */
+      cs_real_t dd = aux3 * (aux2 - aux1);
+      cs_real_t ee = 1.0 - aux1;
+
+      cs_real_t ter1p = old_vel[i] * aux1;
+      cs_real_t ter2p = old_vel_seen[i] * dd;
+      cs_real_t ter3p = tci[i] * (ee - dd);
+      cs_real_t ter4p = force[i] * ee;
+
+      /* integral on the flow-seen velocity */
+      cs_real_t gama2 = 0.5 * (1.0 - aux2 * aux2);
+      cs_real_t p11 = sqrt(gama2 * aux6);
+      cs_real_t ter3f = p11 * g0[i];
 
-          /* Calcul de la temperature du fluide en fonction du type  */
-          /* d'ecoulement    */
-          cs_real_t tempf;
-          if (   cs_glob_physical_model_flag[CS_COMBUSTION_COAL] >= 0
-              || cs_glob_physical_model_flag[CS_COMBUSTION_PCLC] >= 0)
-            tempf = extra->t_gaz->val[cell_id];
+      /* integral on the particle velocity */
+      cs_real_t aux9  = 0.5 * tlag[i] * (1.0 - aux2 * aux2);
+      cs_real_t aux10 = 0.5 * taup[i] * (1.0 - aux1 * aux1);
+      cs_real_t aux11 =   taup[i] * tlag[i] * (1.0 - aux1 * aux2)
+                        / (taup[i] + tlag[i]);
 
-          else if (   cs_glob_physical_model_flag[CS_COMBUSTION_3PT] >= 0
-                   || cs_glob_physical_model_flag[CS_COMBUSTION_EBU] >= 0
-                   || cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] >= 0
-                   || cs_glob_physical_model_flag[CS_JOULE_EFFECT] >= 0)
-            tempf = extra->temperature->val[cell_id];
+      cs_real_t grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
+      cs_real_t gagam = (aux9 - aux11) * (aux8 / aux3);
 
-          else if (   cs_glob_thermal_model->itherm ==
-                              CS_THERMAL_MODEL_TEMPERATURE
-                   && cs_glob_thermal_model->itpscl ==
-                              CS_TEMPERATURE_SCALE_CELSIUS)
-            tempf = extra->scal_t->val[cell_id] + tkelvi;
+      cs_real_t p21 = (CS_ABS(p11) > cs_math_epzero) ? gagam / p11 : 0.0;
+      cs_real_t p22 = (CS_ABS(p11) > cs_math_epzero) ?
+        sqrt(CS_MAX(0.0, grga2 - cs_math_sq(p21))) : 0.0;
+
+      cs_real_t ter5p = p21 * g0[i] + p22 * g1[i];
+
+      /* integral on the particle position */
+      cs_real_t gaome = (  (tlag[i] - taup[i]) * (aux5 - aa)
+                         - tlag[i] * aux9
+                         - taup[i] * aux10
+                         + (tlag[i] + taup[i]) * aux11) * aux8;
+      cs_real_t omegam = aux3 * (  (tlag[i] - taup[i]) * (1.0 - aux2)
+                                 - 0.5 * tlag[i] * (1.0 - aux2 * aux2)
+                                 +   cs_math_sq(taup[i]) / (tlag[i] + taup[i])
+                                   * (1.0 - aux1 * aux2)) * aux6;
+      cs_real_t omega2
+        =   aux7 * (aux7 * dtp - 2.0 * (tlag[i] * aux5 - taup[i] * aa))
+          + 0.5 * tlag[i] * tlag[i] * aux5 * (1.0 + aux2)
+          + 0.5 * taup[i] * taup[i] * aa * (1.0 + aux1)
+          - 2.0 * aux4 * tlag[i] * taup[i] * taup[i] * (1.0 - aux1 * aux2);
+      omega2 = aux8 * omega2;
+
+      cs_real_t p31 = (p11 > cs_math_epzero) ? omegam / p11 : 0.0;
+      cs_real_t p32 = (p22 > cs_math_epzero) ? (gaome - p31 * p21) / p22 : 0.0;
+      cs_real_t p33
+        = sqrt(CS_MAX(0.0, omega2 - cs_math_sq(p31) - cs_math_sq(p32)));
+
+      cs_real_t ter5x = p31 * g0[i] + p32 * g1[i] + p33 * g2[i];
+
+      coords[i] = old_coords[i] + ter1x + ter2x + ter3x + ter4x + ter5x;
+      vel_seen[i] = ter1f + ter2f + ter3f;
+      vel[i] = ter1p + ter2p + ter3p + ter4p + ter5p;
 
-          else if (   cs_glob_thermal_model->itherm ==
-                              CS_THERMAL_MODEL_TEMPERATURE
-                   && cs_glob_thermal_model->itpscl ==
-                              CS_TEMPERATURE_SCALE_KELVIN)
-            tempf = extra->scal_t->val[cell_id];
+    }
 
-          else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY){
+    /* Brownian motion terms */
 
-            cs_lnum_t mode  = 1;
-            CS_PROCF (usthht,USTHHT) (&mode, &(extra->scal_t->val[cell_id]), &tempf);
+    if (brgaus != NULL) {
 
-            tempf = tempf + tkelvi;
+      const cs_real_t *ddbr = b->ddbr;
 
-          }
+      for (cs_lnum_t i = 0; i < n; i++) {
 
-          else
-            tempf = cs_glob_fluid_properties->t0;
+        const cs_lnum_t ip = b->p_id[i];
 
-          cs_real_t p_mass = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
+        cs_real_t aux1 = exp(-dtp / taup[i]);
 
-          cs_real_t ddbr = sqrt(2.0 * _k_boltz * tempf / (p_mass * taup[ip]));
+        cs_real_t tix2 =   cs_math_sq(taup[i] * ddbr[i])
+                         * (dtp - taup[i] * (1.0 - aux1) * (3.0 - aux1) / 2.0);
+        cs_real_t tiu2 =   ddbr[i] * ddbr[i] * taup[i]
+                         * (1.0 - exp(-2.0 * dtp / taup[i])) / 2.0;
+        cs_real_t tixiu = cs_math_sq(ddbr[i] * taup[i] * (1.0 - aux1)) / 2.0;
 
-          cs_real_t tix2 = pow((taup[ip] * ddbr), 2) * (dtp - taup[ip] * (1.0 - aux1) * (3.0 - aux1) / 2.0);
-          cs_real_t tiu2 = ddbr * ddbr * taup[ip] * (1.0 - exp( -2.0 * dtp / taup[ip])) / 2.0;
+        cs_real_t tbrix2 = tix2 - (tixiu * tixiu) / tiu2;
+        cs_real_t tbrix1 = 0.0, tbriu = 0.0;
 
-          cs_real_t tixiu  = pow((ddbr * taup[ip] * (1.0 - aux1)), 2) / 2.0;
+        if (tbrix2 > 0.0)
+          tbrix2 = sqrt(tbrix2) * brgaus[ip*6 + id];
+        else
+          tbrix2 = 0.0;
 
-          tbrix2 = tix2 - (tixiu * tixiu) / tiu2;
+        if (tiu2 > 0.0) {
+          tbrix1 = tixiu / sqrt(tiu2) * brgaus[ip*6 + id + 3];
+          tbriu = sqrt(tiu2) * brgaus[ip*6 + id + 3];
+          terbru[ip] = sqrt(tiu2);
+        }
+        else
+          terbru[ip] = 0.0;
 
-          if (tbrix2 > 0.0)
-            tbrix2    = sqrt(tbrix2) * brgaus[ip * 6 + id];
-          else
-            tbrix2    = 0.0;
+        b->coords[id][i] += tbrix1;
+        b->coords[id][i] += tbrix2;
+        b->vel[id][i] += tbriu;
 
-          if (tiu2 > 0.0)
-            tbrix1    = tixiu / sqrt(tiu2) * brgaus[ip * 6 + id + 3];
-          else
-            tbrix1    = 0.0;
+      }
 
-          if (tiu2 > 0.0) {
+    }
 
-            tbriu      = sqrt(tiu2) * brgaus[ip * 6 + id + 3];
-            terbru[ip] = sqrt(tiu2);
+  }
+}
 
-          }
-          else {
+/*----------------------------------------------------------------------------
+ * Integrate SDEs by the 1st order scheme for a batch of particles located
+ * outside the near-wall region when the deposition submodel is active.
+ *
+ * parameters:
+ *   dtp <-- Lagrangian time step
+ *   b   <-> batch of particles
+ *----------------------------------------------------------------------------*/
 
-            tbriu     = 0.0;
-            terbru[ip]  = 0.0;
+static void
+_sde_batch_lagdep(cs_real_t             dtp,
+                  cs_lagr_sde_batch_t  *b)
+{
+  const cs_lnum_t n = b->n;
+  const cs_real_t *taup = b->taup;
+
+  for (cs_lnum_t id = 0; id < 3; id++) {
+
+    const cs_real_t *tlag = b->tlag[id];
+    const cs_real_t *bx2 = b->bx2[id];
+    const cs_real_t *tci = b->tci[id];
+    const cs_real_t *force = b->force[id];
+    const cs_real_t *g0 = b->gauss[0][id];
+    const cs_real_t *g1 = b->gauss[1][id];
+    const cs_real_t *g2 = b->gauss[2][id];
+    const cs_real_t *old_vel = b->old_vel[id];
+    const cs_real_t *old_vel_seen = b->old_vel_seen[id];
+    const cs_real_t *old_coords = b->old_coords[id];
+
+    cs_real_t *vel = b->vel[id];
+    cs_real_t *vel_seen = b->vel_seen[id];
+    cs_real_t *coords = b->coords[id];
+
+#   pragma omp simd
+    for (cs_lnum_t i = 0; i < n; i++) {
+
+      /* Deterministic coefficients and terms */
+
+      cs_real_t aux1 = exp(-dtp / taup[i]);
+      cs_real_t aux2 = exp(-dtp / tlag[i]);
+      cs_real_t aux3 = tlag[i] / (tlag[i] - taup[i]);
+      cs_real_t aux4 = tlag[i] / (tlag[i] + taup[i]);
+      cs_real_t aux5 = tlag[i] * (1.0 - aux2);
+      cs_real_t aux6 = bx2[i] * tlag[i];
+      cs_real_t aux7 = tlag[i] - taup[i];
+      cs_real_t aux8 = bx2[i] * cs_math_sq(aux3);
+
+      /* trajectory terms */
+      cs_real_t aa = taup[i] * (1.0 - aux1);
+      cs_real_t bb = (aux5 - aa) * aux3;
+      cs_real_t cc = dtp - aa - bb;
+
+      cs_real_t ter1x = aa * old_vel[i];
+      cs_real_t ter2x = bb * old_vel_seen[i];
+      cs_real_t ter3x = cc * tci[i];
+      cs_real_t ter4x = (dtp - aa) * force[i];
+
+      /* flow-seen velocity terms */
+      cs_real_t ter1f = old_vel_seen[i] * aux2;
+      cs_real_t ter2f = tci[i] * (1.0 - aux2);
+
+      /* particle velocity terms */
+      cs_real_t dd = aux3 * (aux2 - aux1);
+      cs_real_t ee = 1.0 - aux1;
+
+      cs_real_t ter1p = old_vel[i] * aux1;
+      cs_real_t ter2p = old_vel_seen[i] * dd;
+      cs_real_t ter3p = tci[i] * (ee - dd);
+      cs_real_t ter4p = force[i] * ee;
+
+      /* integral on the particle position */
+      cs_real_t gama2 = 0.5 * (1.0 - aux2 * aux2);
+      cs_real_t omegam = aux3 * (  (tlag[i] - taup[i]) * (1.0 - aux2)
+                                 - 0.5 * tlag[i] * (1.0 - aux2 * aux2)
+                                 +   cs_math_sq(taup[i]) / (tlag[i] + taup[i])
+                                   * (1.0 - aux1 * aux2)) * aux6;
+      cs_real_t omega2
+        =   aux7 * (aux7 * dtp - 2.0 * (tlag[i] * aux5 - taup[i] * aa))
+          + 0.5 * tlag[i] * tlag[i] * aux5 * (1.0 + aux2)
+          + 0.5 * taup[i] * taup[i] * aa * (1.0 + aux1)
+          - 2.0 * aux4 * tlag[i] * taup[i] * taup[i] * (1.0 - aux1 * aux2);
+      omega2 = aux8 * omega2;
+
+      cs_real_t p21 = (CS_ABS(gama2) > cs_math_epzero) ?
+        omegam / sqrt(gama2) : 0.0;
+      cs_real_t p22 = (CS_ABS(gama2) > cs_math_epzero) ?
+        sqrt(CS_MAX(0.0, omega2 - cs_math_sq(p21))) : 0.0;
+
+      cs_real_t ter5x = p21 * g0[i] + p22 * g1[i];
+
+      /* integral on the flow-seen velocity */
+      cs_real_t p11 = sqrt(gama2 * aux6);
+      cs_real_t ter3f = p11 * g0[i];
+
+      /* integral on the particle velocity */
+      cs_real_t aux9  = 0.5 * tlag[i] * (1.0 - aux2 * aux2);
+      cs_real_t aux10 = 0.5 * taup[i] * (1.0 - aux1 * aux1);
+      cs_real_t aux11 =   taup[i] * tlag[i] * (1.0 - aux1 * aux2)
+                        / (taup[i] + tlag[i]);
 
-          }
+      cs_real_t grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
+      cs_real_t gagam = (aux9 - aux11) * (aux8 / aux3);
+      cs_real_t gaome = (  (tlag[i] - taup[i]) * (aux5 - aa)
+                         - tlag[i] * aux9
+                         - taup[i] * aux10
+                         + (tlag[i] + taup[i]) * aux11) * aux8;
 
-        }
-        else {
+      cs_real_t p31 = (p11 > cs_math_epzero) ? gagam / p11 : 0.0;
+      cs_real_t p32 = (p22 > cs_math_epzero) ? (gaome - p31 * p21) / p22 : 0.0;
+      cs_real_t p33
+        = sqrt(CS_MAX(0.0, grga2 - cs_math_sq(p31) - cs_math_sq(p32)));
 
-          tbrix1  = 0.0;
-          tbrix2  = 0.0;
-          tbriu   = 0.0;
+      cs_real_t ter5p = p31 * g0[i] + p32 * g1[i] + p33 * g2[i];
 
-        }
+      coords[i] = old_coords[i] + ter1x + ter2x + ter3x + ter4x + ter5x;
+      vel_seen[i] = ter1f + ter2f + ter3f;
+      vel[i] = ter1p + ter2p + ter3p + ter4p + ter5p;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* \brief Integration of SDEs by 1st order scheme
+ *
+ * Particles are handled by batches of CS_LAGR_SDE_BATCH_SIZE particles,
+ * which may be distributed among threads.
+ *
+ * \param[in]  taup      temps caracteristique dynamique
+ * \param[in]  tlag      temps caracteristique fluide
+ * \param[in]  piil      terme dans l'integration des eds up
+ * \param[in]  bx        caracteristiques de la turbulence
+ * \param[in]  vagaus    variables aleatoires gaussiennes
+ * \param[in]  gradpr    pressure gradient
+ * \param[in]  romp      masse volumique des particules
+ * \param[in]  fextla    champ de forces exterieur utilisateur (m/s2)
+ * \param[out] terbru
+ */
+/*------------------------------------------------------------------------------*/
+
+static void
+_lages1(cs_real_t           dtp,
+        const cs_real_t     taup[],
+        const cs_real_3_t   tlag[],
+        const cs_real_3_t   piil[],
+        const cs_real_33_t  bx[],
+        const cs_real_33_t  vagaus[],
+        const cs_real_3_t   gradpr[],
+        const cs_real_t     romp[],
+        const cs_real_t     brgaus[],
+        cs_real_t          *terbru,
+        cs_real_3_t        *fextla)
+{
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
 
-        /* Finalisation des ecritures */
+  const cs_lnum_t n_particles = p_set->n_particles;
+  const cs_lnum_t n_batches =   (n_particles + CS_LAGR_SDE_BATCH_SIZE - 1)
+                              / CS_LAGR_SDE_BATCH_SIZE;
 
-        /* --> trajectoire */
-        part_coords[id] = old_part_coords[id] + ter1x + ter2x + ter3x
-                                              + ter4x + ter5x + tbrix1 + tbrix2;
+  const bool brown = (cs_glob_lagr_brownian->lamvbr == 1) ? true : false;
 
-        /* --> vitesse fluide vu     */
-        part_vel_seen[id] = ter1f + ter2f + ter3f;
+  /* The user enthalpy to temperature conversion is not assumed thread-safe */
 
-        /* --> vitesse particules    */
-        part_vel[id] = ter1p + ter2p + ter3p + ter4p + ter5p + tbriu;
+  bool threaded = true;
+  if (brown && cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY)
+    threaded = false;
 
-      }
+  /* Integrate SDE's over batches of particles */
+
+# pragma omp parallel for if (threaded && n_particles > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_batches; b_id++) {
 
+    cs_lagr_sde_batch_t  b;
 
+    const cs_lnum_t s_id = b_id * CS_LAGR_SDE_BATCH_SIZE;
+    const cs_lnum_t e_id = CS_MIN(s_id + CS_LAGR_SDE_BATCH_SIZE, n_particles);
+
+    b.n = 0;
+    for (cs_lnum_t ip = s_id; ip < e_id; ip++) {
+      const unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+      if (cs_lagr_particle_get_cell_id(particle, p_am) >= 0)
+        b.p_id[b.n++] = ip;
     }
 
+    _sde_batch_gather(p_set, taup, tlag, piil, bx, vagaus, gradpr, romp,
+                      (const cs_real_3_t *)fextla, brown, &b);
+
+    _sde_batch_lages1(dtp, (brown) ? brgaus : NULL, terbru, &b);
+
+    _sde_batch_scatter(p_set, &b);
+
   }
 }
 
@@ -765,14 +1049,14 @@ _lagesd(cs_real_t           dtp,
 
   /* Lift force and torque on a deposited particle   */
   cs_real_t lift_force[1];
-  cs_real_t lift_torque[3];
+  cs_real_t lift_torque[3] = {0., 0., 0.};
 
   /* Gravity force and torque on a deposited particle   */
   cs_real_t grav_force[3];
-  cs_real_t grav_torque[3];
+  cs_real_t grav_torque[3] = {0., 0., 0.};
 
   /* Adhesion force and torque on a deposited particle   */
-  cs_real_t adhes_torque[3];
+  cs_real_t adhes_torque[3] = {0., 0., 0.};
 
   /* Map field arrays     */
   cs_real_t *vela = extra->vel->vals[1];
@@ -2092,33 +2376,19 @@ _lagdep(cs_real_t           dtp,
 
   cs_lagr_extra_module_t *extra = cs_get_lagr_extra_module();
 
-  /* Initialisations*/
-  cs_real_3_t grav    = {cs_glob_physical_constants->gravity[0],
-                         cs_glob_physical_constants->gravity[1],
-                         cs_glob_physical_constants->gravity[2]};
-
-
   cs_real_t tkelvi =  273.15;
 
-  cs_real_t vitf = 0.0;
-
-  cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
-  cs_real_t ter1f, ter2f, ter3f;
-  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
-  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
-  cs_real_t p11, p21, p22, p31, p32, p33;
-  cs_real_t omega2, gama2, omegam;
-  cs_real_t grga2, gagam, gaome;
-
-  cs_lnum_t nor = cs_glob_lagr_time_step->nor;
-
-  cs_real_t added_mass_const = cs_glob_lagr_time_scheme->added_mass_const;
-
   /* Interface location between near-wall region   */
   /* and core of the flow (normalized units)  */
 
   cs_real_t depint      = 100.0;
 
+  /* Particles outside the near-wall region, integrated by batches */
+
+  cs_lnum_t n_bulk = 0;
+  cs_lnum_t *bulk_id;
+  BFT_MALLOC(bulk_id, p_set->n_particles, cs_lnum_t);
+
   /* loop on the particles  */
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
@@ -2130,55 +2400,6 @@ _lagdep(cs_real_t           dtp,
         cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG)
         != CS_LAGR_PART_IMPOSED_MOTION) {
 
-      cs_real_t *old_part_vel      = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY);
-      cs_real_t *old_part_vel_seen = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_vel          = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY);
-      cs_real_t *part_vel_seen     = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_coords       = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_COORDS);
-      cs_real_t *old_part_coords   = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_COORDS);
-
-      cs_real_t romf = extra->cromf->val[cell_id];
-
-      /* Fluid temperature computation depending on the type of flow  */
-      cs_real_t tempf;
-
-      if (   cs_glob_physical_model_flag[CS_COMBUSTION_COAL] >= 0
-          || cs_glob_physical_model_flag[CS_COMBUSTION_PCLC] >= 0
-          || cs_glob_physical_model_flag[CS_COMBUSTION_FUEL] >= 0)
-        tempf = extra->t_gaz->val[cell_id];
-
-      else if (   cs_glob_physical_model_flag[CS_COMBUSTION_3PT] >= 0
-               || cs_glob_physical_model_flag[CS_COMBUSTION_EBU] >= 0
-               || cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] >= 0
-               || cs_glob_physical_model_flag[CS_JOULE_EFFECT] >= 0)
-        tempf = extra->temperature->val[cell_id];
-
-      else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
-               && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS)
-        tempf = extra->scal_t->val[cell_id] + tkelvi;
-
-      else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
-               && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_KELVIN)
-        tempf = extra->scal_t->val[cell_id];
-
-      else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY){
-
-        cs_lnum_t mode  = 1;
-        CS_PROCF (usthht,USTHHT) (&mode, &(extra->scal_t->val[cell_id]), &tempf);
-
-        tempf = tempf + tkelvi;
-
-      }
-
-      else
-        tempf = cs_glob_fluid_properties->t0;
-
       /* If y^+ is greater than the interface location,
          the standard model is applied
          ============================================== */
@@ -2189,147 +2410,49 @@ _lagdep(cs_real_t           dtp,
 
         cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_MARKO_VALUE, -1);
 
-        for (cs_lnum_t id = 0; id < 3; id++) {
-
-          vitf = extra->vel->vals[1][cell_id * 3 + id];
-
-          /* --> (2.1) Calcul preliminaires :    */
-          /* ----------------------------   */
-          /* calcul de II*TL+<u> et [(grad<P>/rhop+g)*tau_p+<Uf>] ?  */
-
-          cs_real_t tci = piil[ip][id] * tlag[ip][id] + vitf;
-          cs_real_t force = 0.0;
-
-          if (cs_glob_lagr_time_scheme->iadded_mass == 0)
-            force = (- gradpr[cell_id][id] / romp[ip]
-                     + grav[id] + fextla[ip][id]) * taup[ip];
-
-          /* Added-mass term?     */
-          else
-            force =   (- gradpr[cell_id][id] / romp[ip]
-                  * (1.0 + 0.5 * added_mass_const)
-                  / (1.0 + 0.5 * added_mass_const * romf / romp[ip])
-                  + grav[id] + fextla[ip][id])* taup[ip];
-
-
-          /* --> (2.2) Calcul des coefficients/termes deterministes */
-          /* ----------------------------------------------------    */
-
-          aux1 = exp(-dtp / taup[ip]);
-          aux2 = exp(-dtp / tlag[ip][id]);
-          aux3 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
-          aux4 = tlag[ip][id] / (tlag[ip][id] + taup[ip]);
-          aux5 = tlag[ip][id] * (1.0 - aux2);
-          aux6 = pow(bx[ip][id][nor-1], 2.0) * tlag[ip][id];
-          aux7 = tlag[ip][id] - taup[ip];
-          aux8 = pow(bx[ip][id][nor-1], 2.0) * pow(aux3, 2);
-
-          /* --> trajectory terms */
-          cs_real_t aa = taup[ip] * (1.0 - aux1);
-          cs_real_t bb = (aux5 - aa) * aux3;
-          cs_real_t cc = dtp - aa - bb;
-
-          ter1x = aa * old_part_vel[id];
-          ter2x = bb * old_part_vel_seen[id];
-          ter3x = cc * tci;
-          ter4x = (dtp - aa) * force;
-
-          /* --> flow-seen velocity terms   */
-          ter1f = old_part_vel_seen[id] * aux2;
-          ter2f = tci * (1.0 - aux2);
-
-          /* --> termes pour la vitesse des particules     */
-          cs_real_t dd = aux3 * (aux2 - aux1);
-          cs_real_t ee = 1.0 - aux1;
-
-          ter1p = old_part_vel[id] * aux1;
-          ter2p = old_part_vel_seen[id] * dd;
-          ter3p = tci * (ee - dd);
-          ter4p = force * ee;
-
-          /* --> (2.3) Coefficients computation for the stochastic integral    */
-          /* --> Integral for particles position */
-          gama2  = 0.5 * (1.0 - aux2 * aux2);
-          omegam = aux3 * ( (tlag[ip][id] - taup[ip]) * (1.0 - aux2)
-                                  - 0.5 * tlag[ip][id] * (1.0 - aux2 * aux2)
-                                  + pow(taup[ip],2) / (tlag[ip][id] + taup[ip])
-                                  * (1.0 - aux1 * aux2)
-                                  ) * aux6;
-          omega2 =  aux7 * (aux7 * dtp - 2.0 * (tlag[ip][id] * aux5 - taup[ip] * aa))
-                   + 0.5 * tlag[ip][id] * tlag[ip][id] * aux5 * (1.0 + aux2)
-                   + 0.5 * taup[ip] * taup[ip] * aa * (1.0 + aux1)
-                   - 2.0 * aux4 * tlag[ip][id] * taup[ip] * taup[ip] * (1.0 - aux1 * aux2);
-          omega2 = aux8 * omega2;
-
-          if (CS_ABS(gama2) > cs_math_epzero) {
+        bulk_id[n_bulk++] = ip;
 
-            p21 = omegam / sqrt(gama2);
-            p22 = omega2 - pow(p21, 2);
-            p22 = sqrt(CS_MAX(0.0, p22));
+      }
 
-          }
-          else {
+      /* Otherwise, the deposition submodel is applied
+       * ============================================= */
 
-            p21 = 0.0;
-            p22 = 0.0;
+      else if (cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG)
+          != CS_LAGR_PART_TO_DELETE) {
 
-          }
+        /* Fluid temperature computation depending on the type of flow  */
+        cs_real_t tempf;
 
-          ter5x = p21 * vagaus[ip][id][0] + p22 * vagaus[ip][id][1];
-
-          /* --> integral for the flow-seen velocity  */
-          p11   = sqrt(gama2 * aux6);
-          ter3f = p11 * vagaus[ip][id][0];
-
-          /* --> integral for the particles velocity  */
-          aux9  = 0.5 * tlag[ip][id] * (1.0 - aux2 * aux2);
-          aux10 = 0.5 * taup[ip] * (1.0 - aux1 * aux1);
-          aux11 =   taup[ip] * tlag[ip][id]
-                  * (1.0 - aux1 * aux2)
-                  / (taup[ip] + tlag[ip][id]);
-
-          grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
-          gagam = (aux9 - aux11) * (aux8 / aux3);
-          gaome = ( (tlag[ip][id] - taup[ip]) * (aux5 - aa)
-                    - tlag[ip][id] * aux9
-                    - taup[ip] * aux10
-                    + (tlag[ip][id] + taup[ip]) * aux11)
-                  * aux8;
-
-          if (p11 > cs_math_epzero)
-            p31 = gagam / p11;
-          else
-            p31 = 0.0;
+        if (   cs_glob_physical_model_flag[CS_COMBUSTION_COAL] >= 0
+            || cs_glob_physical_model_flag[CS_COMBUSTION_PCLC] >= 0
+            || cs_glob_physical_model_flag[CS_COMBUSTION_FUEL] >= 0)
+          tempf = extra->t_gaz->val[cell_id];
 
-          if (p22 > cs_math_epzero)
-            p32 = (gaome - p31 * p21) / p22;
-          else
-            p32 = 0.0;
+        else if (   cs_glob_physical_model_flag[CS_COMBUSTION_3PT] >= 0
+                 || cs_glob_physical_model_flag[CS_COMBUSTION_EBU] >= 0
+                 || cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] >= 0
+                 || cs_glob_physical_model_flag[CS_JOULE_EFFECT] >= 0)
+          tempf = extra->temperature->val[cell_id];
 
-          p33 = grga2 - cs_math_sq(p31) - cs_math_sq(p32);
-          p33 = sqrt(CS_MAX(0.0, p33));
-          ter5p =   p31 * vagaus[ip][id][0]
-                  + p32 * vagaus[ip][id][1]
-                  + p33 * vagaus[ip][id][2];
+        else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
+                 && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS)
+          tempf = extra->scal_t->val[cell_id] + tkelvi;
 
-          /*  Update of the particle state-vector     */
+        else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
+                 && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_KELVIN)
+          tempf = extra->scal_t->val[cell_id];
 
-          part_coords[id] =   old_part_coords[id]
-                            + ter1x + ter2x + ter3x + ter4x + ter5x;
+        else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY){
 
-          part_vel_seen[id] =  ter1f + ter2f + ter3f;
+          cs_lnum_t mode  = 1;
+          CS_PROCF (usthht,USTHHT) (&mode, &(extra->scal_t->val[cell_id]), &tempf);
 
-          part_vel[id]      = ter1p + ter2p + ter3p + ter4p + ter5p;
+          tempf = tempf + tkelvi;
 
         }
 
-      }
-
-      /* Otherwise, the deposition submodel is applied
-       * ============================================= */
-
-      else if (cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG)
-          != CS_LAGR_PART_TO_DELETE) {
+        else
+          tempf = cs_glob_fluid_properties->t0;
 
         if (  cs_lagr_particle_get_real(particle, p_am,
                                         CS_LAGR_YPLUS)
@@ -2400,6 +2523,35 @@ _lagdep(cs_real_t           dtp,
     }
   }
 
+  /* Standard model for particles outside the near-wall region;
+     these do not use the random number generator, so may be
+     integrated by batches independently of the loop above. */
+
+  const cs_lnum_t n_batches =   (n_bulk + CS_LAGR_SDE_BATCH_SIZE - 1)
+                              / CS_LAGR_SDE_BATCH_SIZE;
+
+# pragma omp parallel for if (n_bulk > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_batches; b_id++) {
+
+    cs_lagr_sde_batch_t  b;
+
+    const cs_lnum_t s_id = b_id * CS_LAGR_SDE_BATCH_SIZE;
+    const cs_lnum_t e_id = CS_MIN(s_id + CS_LAGR_SDE_BATCH_SIZE, n_bulk);
+
+    b.n = e_id - s_id;
+    for (cs_lnum_t i = 0; i < b.n; i++)
+      b.p_id[i] = bulk_id[s_id + i];
+
+    _sde_batch_gather(p_set, taup, tlag, piil, bx, vagaus, gradpr, romp,
+                      (const cs_real_3_t *)fextla, false, &b);
+
+    _sde_batch_lagdep(dtp, &b);
+
+    _sde_batch_scatter(p_set, &b);
+
+  }
+
+  BFT_FREE(bulk_id);
 }
 
 /*============================================================================
@@ -2450,7 +2602,8 @@ cs_lagr_sde(cs_real_t           dt_p,
   cs_real_33_t *vagaus;
   BFT_MALLOC(vagaus, p_set->n_particles, cs_real_33_t);
 
-  /* Random values */
+  /* Random values (drawn for all particles at once; the generator is
+     buffered, so the sequence is the same as with per-particle draws) */
 
   if (cs_glob_lagr_time_scheme->idistu == 1) {
     if (cs_glob_lagr_time_step->nor > 1) {
@@ -2465,8 +2618,7 @@ cs_lagr_sde(cs_real_t           dt_p,
       }
     }
     else {
-      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
-        cs_random_normal(9, &(vagaus[ip][0][0]));
+      cs_random_normal(p_set->n_particles*9, &(vagaus[0][0][0]));
     }
   }
 
@@ -2494,8 +2646,7 @@ cs_lagr_sde(cs_real_t           dt_p,
       }
     }
     else {
-      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
-        cs_random_normal(6, &(brgaus[6 * ip]));
+      cs_random_normal(p_set->n_particles*6, brgaus);
     }
   }
 
@@ -227,6 +227,9 @@ static double _t_prev_iter = 0.;
 
 static const cs_real_t *_p_dt = NULL; /* Mapped cell time step */
 
+static cs_real_t *_dt_acc = NULL;     /* Accumulated time step between
+                                         reduced-frequency updates */
+
 /* Names associated with moment types */
 
 const char  *cs_lagr_moment_type_name[] = {N_("MEAN"),
@@ -238,7 +241,8 @@ static cs_lagr_stat_options_t _lagr_stat_options
   = {.isuist = 0,
      .idstnt = 0,
      .nstist = 0,
-     .threshold = 1e-12};
+     .threshold = 1e-12,
+     .update_interval = 1};
 
 cs_lagr_stat_options_t *cs_glob_lagr_stat_options = &_lagr_stat_options;
 
@@ -1799,262 +1803,322 @@ _cs_lagr_stat_update_mesh_moment(cs_lagr_moment_t           *mt,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Update all moment accumulators.
+ * \brief Update particle-based moments sharing a weight accumulator.
+ *
+ * All moments are updated in a single pass over cells, using the index
+ * of particles by cell. Each cell being handled by a single thread,
+ * no atomic operations are needed, and for each cell, moments and
+ * particles are processed in the same order as with a loop on moments
+ * and particles.
+ *
+ * Particle data functions may be called from several threads.
+ *
+ * \param[in]       p_set       pointer to particle set
+ * \param[in]       mwa         pointer to weight accumulator
+ * \param[in]       n_moments   number of moments to update
+ * \param[in]       moment_id   ids of moments to update, in update order
+ * \param[in]       n_cells     number of cells
+ * \param[in]       cell_idx    index of particles in each cell
+ * \param[in]       p_ids       ids of particles, by cell
+ * \param[in]       dt          cell time step (or time since last update)
+ * \param[in, out]  wa_sum      accumulated weight for each cell
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_cs_lagr_stat_update_all(void)
+_update_particle_moments(const cs_lagr_particle_set_t  *p_set,
+                         const cs_lagr_moment_wa_t     *mwa,
+                         int                            n_moments,
+                         const int                      moment_id[],
+                         cs_lnum_t                      n_cells,
+                         const cs_lnum_t                cell_idx[],
+                         const cs_lnum_t                p_ids[],
+                         const cs_real_t               *restrict dt,
+                         cs_real_t                     *restrict wa_sum)
 {
-  const cs_time_step_t  *ts = cs_glob_time_step;
-  cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
-  const cs_real_t *dt_val = _dt_val();
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  const cs_lnum_t n_b_particles = cell_idx[n_cells];
+
+  /* Particle weights and classes, shared by all moments */
+
+  int *p_class;
+  cs_real_t *p_w;
+  BFT_MALLOC(p_class, n_b_particles, int);
+  BFT_MALLOC(p_w, n_b_particles, cs_real_t);
+
+  const bool have_class = (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
+      const unsigned char *particle
+        = p_set->p_buffer + p_am->extents * p_ids[j];
+      p_class[j] = 0;
+      if (have_class)
+        p_class[j] = cs_lagr_particle_get_lnum(particle, p_am,
+                                               CS_LAGR_STAT_CLASS);
+      if (mwa->p_data_func == NULL)
+        p_w[j] = cs_lagr_particle_get_real(particle, p_am,
+                                           CS_LAGR_STAT_WEIGHT);
+      else
+        mwa->p_data_func(mwa->data_input, particle, p_am, p_w + j);
+      p_w[j] *= dt[c_id];
+    }
+  }
 
-  _t_prev_iter = ts->t_prev;
+  /* Values of moments and associated means */
 
-  /* Outer loop in weight accumulators, to avoid recomputing weights
-     too many times */
+  cs_real_t **m_val, **m_mean;
+  BFT_MALLOC(m_val, n_moments, cs_real_t *);
+  BFT_MALLOC(m_mean, n_moments, cs_real_t *);
 
-  for (int wa_id = 0; wa_id < _n_lagr_stats_wa; wa_id++) {
+  int max_data_dim = 1;
 
-    cs_lagr_moment_wa_t *mwa = _lagr_stats_wa + wa_id;
+  for (int i = 0; i < n_moments; i++) {
 
-    /* Check if accumulator and associated moments are active */
+    const cs_lagr_moment_t *mt = _lagr_stats + moment_id[i];
 
-    if (mwa->nt_start == 0 && cs_glob_lagr_stat_options->idstnt <= ts->nt_cur) {
-      mwa->nt_start = ts->nt_cur;
-      mwa->t_start = _t_prev_iter;
+    m_val[i] = mt->val;
+    if (mt->f_id > -1)
+      m_val[i] = cs_field_by_id(mt->f_id)->val;
+
+    m_mean[i] = NULL;
+    if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+      const cs_lagr_moment_t *mt_mean = _lagr_stats + mt->l_id;
+      m_mean[i] = mt_mean->val;
+      if (mt_mean->f_id > -1)
+        m_mean[i] = cs_field_by_id(mt_mean->f_id)->val;
     }
-    else if (mwa->t_start < 0. && mwa->nt_start <= ts->nt_cur)
-      mwa->t_start = _t_prev_iter;
-    else if (mwa->nt_start < 0 && mwa->t_start <= ts->t_cur)
-      mwa->nt_start = ts->nt_cur;
 
-    if (mwa->nt_start > ts->nt_cur)
-      continue;
+    max_data_dim = CS_MAX(max_data_dim, mt->data_dim);
 
-    /* Here, only active accumulators are considered */
+  }
 
-    _ensure_init_wa(mwa);
-    cs_real_t *g_wa_sum = _mwa_val(mwa);
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+    cs_real_t *p_vals;
+    BFT_MALLOC(p_vals, max_data_dim, cs_real_t);
 
-    const cs_lnum_t n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
+#   pragma omp for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
-    /* Local weight array allocation */
+      const cs_lnum_t s_id = cell_idx[c_id];
+      const cs_lnum_t e_id = cell_idx[c_id+1];
 
-    cs_real_t *restrict l_wa_sum = NULL;
+      if (s_id == e_id)
+        continue;
 
-    /* Compute mesh-based weight now if applicable
-       (possibly sharing it across moments) */
+      cs_real_t wa_c = wa_sum[c_id];
 
-    cs_real_t m_w0[1];
-    cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
+      for (int i = 0; i < n_moments; i++) {
 
-    if (m_weight == NULL)
-      BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
+        const cs_lagr_moment_t *mt = _lagr_stats + moment_id[i];
+        const int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
+        const cs_lnum_t dim = mt->dim;
 
-    /* Loop on variances first, then means */
+        cs_real_t *restrict val = m_val[i] + c_id*dim;
 
-    for (int m_type = CS_LAGR_MOMENT_VARIANCE;
-         m_type >= (int)CS_LAGR_MOMENT_MEAN;
-         m_type--) {
+        wa_c = wa_sum[c_id];
 
-      for (int i = 0; i < _n_lagr_stats; i++) {
+        for (cs_lnum_t j = s_id; j < e_id; j++) {
 
-        cs_lagr_moment_t *mt = _lagr_stats + i;
+          if (p_class[j] != mt->class && mt->class != 0)
+            continue;
 
-        if (   (int)mt->m_type == m_type
-            && mt->wa_id == wa_id
-            && mwa->nt_start > -1
-            && mwa->nt_start <= ts->nt_cur
-            && mt->nt_cur < ts->nt_cur) {
+          const unsigned char *particle
+            = p_set->p_buffer + p_am->extents * p_ids[j];
 
-          int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
+          const cs_real_t p_weight = p_w[j];
+          const cs_real_t *pval = p_vals;
 
-          _ensure_init_moment(mt);
+          if (mt->p_data_func == NULL)
+            pval = cs_lagr_particle_attr_const(particle, p_am, attr_id);
+          else
+            mt->p_data_func(mt->data_input, particle, p_am, p_vals);
 
-          /* Copy weight sum content to a local array
-             for every new moment inside the current class */
+          /* update weight sum with new particle weight */
+          const cs_real_t wa_sum_n = p_weight + wa_c;
 
-          for (cs_lnum_t j = 0; j < n_w_elts; j++)
-            l_wa_sum[j]= g_wa_sum[j];
+          if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
 
-          /* Case where data is particle-based */
-          /*-----------------------------------*/
+            if (dim == 6) { /* variance-covariance matrix */
 
-          if (mt->m_data_func == NULL) {
+              cs_real_t *restrict mean_val = m_mean[i] + c_id*3;
 
-            cs_real_t *restrict val = mt->val;
+              double delta[3], delta_n[3], r[3], m_n[3];
 
-            if (mt->f_id > -1) {
-              cs_field_t *f = cs_field_by_id(mt->f_id);
-              val = f->val;
-            }
+              for (int l = 0; l < 3; l++) {
+                delta[l]   = pval[l] - mean_val[l];
+                r[l] = delta[l] * (p_weight / (fmax(wa_sum_n, 1e-100)));
+                m_n[l] = mean_val[l] + r[l];
+                delta_n[l] = pval[l] - m_n[l];
+                val[l] = (  val[l]*wa_c
+                          + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+              }
 
-            /* prepare submoment definition */
+              /* Covariance terms (see _cs_lagr_stat_update_mesh_moment) */
 
-            cs_lagr_moment_t *mt_mean = NULL;
-            cs_real_t *restrict mean_val = NULL;
+              val[3] = (val[3]*wa_c + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+              val[4] = (val[4]*wa_c + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+              val[5] = (val[5]*wa_c + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
 
-            /* Check if lower moment is defined and attached */
+              /* update mean value */
 
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+              for (int l = 0; l < 3; l++)
+                mean_val[l] += r[l];
 
-              assert(mt->l_id > -1);
-              mt_mean = _lagr_stats + mt->l_id;
-              _ensure_init_moment(mt_mean);
+            }
 
-              mean_val = mt_mean->val;
+            else { /* simple variance */
 
-              if (mt_mean->f_id > -1) {
-                cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-                mean_val = f_mean->val;
-              }
+              cs_real_t *restrict mean_val = m_mean[i] + c_id*dim;
 
-            }
+              for (cs_lnum_t l = 0; l < dim; l++) {
 
-            cs_real_t *pval = NULL;
-            if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
+                double delta = pval[l] - mean_val[l];
+                double r = delta * (p_weight / (fmax(wa_sum_n, 1e-100)));
+                double m_n = mean_val[l] + r;
 
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+                val[l] = (  val[l]*wa_c
+                          + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
 
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
+                /* update mean value */
 
-              cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle,
-                                                               p_set->p_am);
+                mean_val[l] += r;
 
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
+              }
 
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
+            }
 
-                /* weight associated to current particle */
+          }
 
-                cs_real_t p_weight;
+          else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
 
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id];
+            for (cs_lnum_t l = 0; l < dim; l++)
+              val[l] +=   (pval[l] - val[l])
+                        * p_weight / (fmax(wa_sum_n, 1e-100));
 
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
+          } /* End of test if moment is a variance or a mean */
 
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = p_weight + l_wa_sum[cell_id];
+          /* update local weight associated to current moment and class */
 
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+          wa_c += p_weight;
 
-                  if (mt->dim == 6) { /* variance-covariance matrix */
+        } /* End of loop on cell's particles */
 
-                    assert(mt->data_dim == 3);
+      } /* End of loop on moments */
 
-                    double delta[3], delta_n[3], r[3], m_n[3];
+      wa_sum[c_id] = wa_c;
 
-                    for (int l = 0; l < 3; l++) {
+    } /* End of loop on cells */
+
+    BFT_FREE(p_vals);
+  }
+
+  BFT_FREE(m_mean);
+  BFT_FREE(m_val);
+  BFT_FREE(p_w);
+  BFT_FREE(p_class);
+}
 
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / (fmax(wa_sum_n, 1e-100)));
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update all moment accumulators.
+ *
+ * \param[in]  dt_val  cell time step values, or time since previous update
+ *                     with reduced update frequency
+ */
+/*----------------------------------------------------------------------------*/
 
-                    }
+static void
+_cs_lagr_stat_update_all(const cs_real_t  *dt_val)
+{
+  const cs_time_step_t  *ts = cs_glob_time_step;
+  cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
 
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
+  /* Index of particles by cell, shared by all particle-based moments,
+     and built on first use */
 
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+  cs_lnum_t *cell_idx = NULL, *p_ids = NULL;
 
-                    /* update mean value */
+  int *moment_id = NULL;
+  BFT_MALLOC(moment_id, _n_lagr_stats, int);
 
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
+  _t_prev_iter = ts->t_prev;
 
-                  }
+  /* Outer loop in weight accumulators, to avoid recomputing weights
+     too many times */
 
-                  else { /* simple variance */
+  for (int wa_id = 0; wa_id < _n_lagr_stats_wa; wa_id++) {
 
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
+    cs_lagr_moment_wa_t *mwa = _lagr_stats_wa + wa_id;
 
-                    const cs_lnum_t dim = mt->dim;
+    /* Check if accumulator and associated moments are active */
 
-                    for (cs_lnum_t l = 0; l < dim; l++) {
+    if (mwa->nt_start == 0 && cs_glob_lagr_stat_options->idstnt <= ts->nt_cur) {
+      mwa->nt_start = ts->nt_cur;
+      mwa->t_start = _t_prev_iter;
+    }
+    else if (mwa->t_start < 0. && mwa->nt_start <= ts->nt_cur)
+      mwa->t_start = _t_prev_iter;
+    else if (mwa->nt_start < 0 && mwa->t_start <= ts->t_cur)
+      mwa->nt_start = ts->nt_cur;
 
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / (fmax(wa_sum_n, 1e-100)));
-                      double m_n = mean_val[cell_id*dim+l] + r;
+    if (mwa->nt_start > ts->nt_cur)
+      continue;
 
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+    /* Here, only active accumulators are considered */
 
-                      /* update mean value */
+    _ensure_init_wa(mwa);
+    cs_real_t *g_wa_sum = _mwa_val(mwa);
 
-                      mean_val[cell_id*dim+l] += r;
+    /* Compute mesh-based weight now if applicable
+       (possibly sharing it across moments) */
 
-                    }
+    cs_real_t m_w0[1];
+    cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
 
-                  }
+    /* Loop on variances first, then means; mesh-based moments are updated
+       immediately, particle-based moments are gathered for a single
+       update pass */
 
-                }
+    int n_p_moments = 0;
 
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+    for (int m_type = CS_LAGR_MOMENT_VARIANCE;
+         m_type >= (int)CS_LAGR_MOMENT_MEAN;
+         m_type--) {
 
-                  const cs_lnum_t dim = mt->dim;
+      for (int i = 0; i < _n_lagr_stats; i++) {
 
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / (fmax(wa_sum_n, 1e-100));
+        cs_lagr_moment_t *mt = _lagr_stats + i;
 
-                } /* End of test if moment is a variance or a mean */
+        if (   (int)mt->m_type == m_type
+            && mt->wa_id == wa_id
+            && mwa->nt_start > -1
+            && mwa->nt_start <= ts->nt_cur
+            && mt->nt_cur < ts->nt_cur) {
 
-                /* update local weight associated to current moment and class */
+          _ensure_init_moment(mt);
 
-                l_wa_sum[cell_id] += p_weight;
+          /* Case where data is particle-based */
+          /*-----------------------------------*/
 
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
+          if (mt->m_data_func == NULL) {
 
-            } /* end of loop on particles */
+            moment_id[n_p_moments++] = i;
 
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
+            /* Variances also update the associated mean */
 
             mt->nt_cur = ts->nt_cur;
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
+            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+              assert(mt->l_id > -1);
+              cs_lagr_moment_t *mt_mean = _lagr_stats + mt->l_id;
+              _ensure_init_moment(mt_mean);
               mt_mean->nt_cur = ts->nt_cur;
+            }
+
           }
 
           /* Case where data is mesh-based */
@@ -2068,27 +2132,41 @@ _cs_lagr_stat_update_all(void)
 
         } /* end of test if moment is for the current class */
 
-      } /* End of loop on moment types */
+      } /* End of loop on moments */
+
+    } /* End of loop on moment types */
+
+    /* Update particle-based moments and the global class weight array */
+
+    if (n_p_moments > 0) {
 
-    } /* End of loop on moments */
+      if (cell_idx == NULL)
+        cs_lagr_particle_set_index_by_cell(p_set, n_cells, &cell_idx, &p_ids);
 
-    /* At end of loop on moments inside a class, update
-       global class weight array */
+      _update_particle_moments(p_set,
+                               mwa,
+                               n_p_moments,
+                               moment_id,
+                               n_cells,
+                               cell_idx,
+                               p_ids,
+                               dt_val,
+                               g_wa_sum);
 
-    if (l_wa_sum != NULL) {
-      for (cs_lnum_t i = 0; i < n_w_elts; i++)
-        g_wa_sum[i] = l_wa_sum[i];
-      BFT_FREE(l_wa_sum);
     }
-    else if (m_weight != NULL) {
+
+    if (m_weight != NULL) {
       _update_wa_m(mwa, m_weight);
       if (m_weight != m_w0)
         BFT_FREE(m_weight);
     }
 
   } /* End of loop on active weigh accumulators */
-}
 
+  BFT_FREE(moment_id);
+  BFT_FREE(p_ids);
+  BFT_FREE(cell_idx);
+}
 
 /*----------------------------------------------------------------------------
  * Free all moments
@@ -2893,13 +2971,62 @@ cs_lagr_stat_update(void)
     _restart_info_free();
   }
 
+  const cs_lagr_stat_options_t *options = cs_glob_lagr_stat_options;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
   /* if unsteady statistics, reset stats, wa, and durations */
+  bool unsteady = false;
   if (   cs_glob_lagr_time_scheme->isttio == 0
       || (   cs_glob_lagr_time_scheme->isttio == 1
-          && cs_glob_time_step->nt_cur <= cs_glob_lagr_stat_options->nstist))
+          && nt_cur <= options->nstist)) {
+    unsteady = true;
     _cs_lagr_moment_reset_unsteady_stats();
+  }
+
+  const cs_real_t *dt_val = _dt_val();
+
+  /* For steady statistics updated at reduced frequency, accumulate
+     time steps between updates, so that each update is weighted by the
+     time elapsed since the previous one */
+
+  if (options->update_interval > 1 && !unsteady) {
 
-  _cs_lagr_stat_update_all();
+    const int nt_start = CS_MAX(options->idstnt, options->nstist + 1);
+
+    if (nt_cur >= nt_start) {
+
+      const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+      if (_dt_acc == NULL) {
+        BFT_MALLOC(_dt_acc, n_cells, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          _dt_acc[i] = 0.;
+      }
+
+      if (dt_val == &(cs_glob_time_step_options->dtref)) {
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          _dt_acc[i] += dt_val[0];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          _dt_acc[i] += dt_val[i];
+      }
+
+      if ((nt_cur - nt_start) % options->update_interval != 0)
+        return;
+
+      dt_val = _dt_acc;
+
+    }
+
+  }
+
+  _cs_lagr_stat_update_all(dt_val);
+
+  if (dt_val == _dt_acc) {
+    for (cs_lnum_t i = 0; i < cs_glob_mesh->n_cells; i++)
+      _dt_acc[i] = 0.;
+  }
 
   return;
 }
@@ -2916,6 +3043,8 @@ cs_lagr_stat_finalize(void)
   _free_all_moments();
   _free_all_wa();
 
+  BFT_FREE(_dt_acc);
+
  _restart_info_checked = false;
 }
 
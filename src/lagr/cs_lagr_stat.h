@@ -93,6 +93,9 @@ typedef enum {
  * when the selection function is called, so that value or structure should
  * not be temporary (i.e. local);
  *
+ * Note: this function may be called concurrently from several threads
+ * (for particles in different cells), so it must not modify shared data.
+ *
  * parameters:
  *   input    <-- pointer to optional (untyped) value or structure.
  *   particle <-- pointer to particle data
@@ -157,6 +160,14 @@ typedef struct {
     features (such as the Poisson correction) */
   cs_real_t  threshold;
 
+  /*! number of time steps between updates of steady volume statistics
+    (1 by default). When > 1, the time steps elapsed since the previous
+    update are accumulated so that each sampled particle is weighted by
+    the matching time interval; statistics activated between updates
+    start at the next update.
+    Useful if \ref isttio=1 */
+  int  update_interval;
+
 } cs_lagr_stat_options_t;
 
 /*============================================================================
@@ -54,6 +54,8 @@
 
 #include "fvm_periodicity.h"
 
+#include "cs_ale.h"
+#include "cs_all_to_all.h"
 #include "cs_base.h"
 #include "cs_boundary_zone.h"
 #include "cs_physical_constants.h"
@@ -69,6 +71,7 @@
 #include "cs_random.h"
 #include "cs_rotation.h"
 #include "cs_search.h"
+#include "cs_timer.h"
 #include "cs_timer_stats.h"
 #include "cs_turbomachinery.h"
 
@@ -217,12 +220,52 @@ typedef struct {
   cs_lnum_t  *cell_face_idx;
   cs_lnum_t  *cell_face_lst;
 
+  /* Cached face geometry, in cell -> face connectivity order
+     (NULL if geometry cache not used) */
+
+  signed char  *cell_face_orient;       /* 1 if face normal points out of
+                                           the cell, -1 otherwise */
+  cs_real_3_t  *cell_face_cog;          /* face centers */
+  cs_real_3_t  *cell_face_normal;       /* face normals */
+  cs_lnum_t    *cell_face_vtx_idx;      /* index on packed vertices */
+  cs_real_3_t  *cell_face_vtx_coords;   /* packed vertex coordinates */
+  signed char  *cell_face_edge_orient;  /* 1 if edge i goes from lower
+                                           to higher vertex id, -1 otherwise */
+
   cs_lagr_halo_t      *halo;   /* Lagrangian halo structure */
 
   cs_interface_set_t  *face_ifs;
 
 } cs_lagr_track_builder_t;
 
+/* Per-thread accumulators used during particle tracking.
+   Contributions to shared arrays are stored in thread-local structures
+   and applied after each threaded loop, in thread order, so that
+   results are reproducible for a given number of threads. */
+
+typedef struct {
+
+  cs_lnum_t   n_part_dep;          /* number of deposited particles */
+  cs_lnum_t   n_part_fou;          /* number of fouled particles */
+  cs_real_t   weight_dep;          /* weight of deposited particles */
+  cs_real_t   weight_fou;          /* weight of fouled particles */
+
+  cs_real_t  *particle_flow_rate;  /* contribution to particle flow rate
+                                      per zone per statistical class */
+
+  cs_lnum_t   n_b_contribs;        /* number of boundary statistics
+                                      contributions */
+  cs_lnum_t   n_b_contribs_max;    /* allocated number of contributions */
+  cs_lnum_t  *b_contrib_id;        /* associated id in bound_stat, or
+                                      -(id+1) if value is reset to 0 */
+  cs_real_t  *b_contrib_val;       /* associated contribution */
+
+  cs_lnum_t   n_sync;              /* number of particles changing rank */
+  cs_lnum_t   n_sync_max;          /* allocated number of particle ids */
+  cs_lnum_t  *sync_id;             /* ids of particles changing rank */
+
+} cs_lagr_track_acc_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -233,6 +276,18 @@ static  cs_lagr_track_builder_t  *_particle_track_builder = NULL;
 
 static  int            _max_propagation_loops = 100;
 
+/* Migration mode for particles changing rank */
+
+static  cs_lagr_migration_mode_t  _migration_mode = CS_LAGR_MIGRATION_HALO;
+
+/* Time spent in particle set synchronization (including migration) */
+
+static  cs_timer_counter_t  _sync_timer;
+
+/* Use cached cell -> face geometry for tracking */
+
+static  bool  _use_geometry_cache = true;
+
 /* MPI datatype associated to each particle "structure" */
 
 #if defined(HAVE_MPI)
@@ -752,6 +807,172 @@ _define_cell_face_connect(cs_lagr_track_builder_t   *builder)
   BFT_FREE(counter);
 }
 
+/*----------------------------------------------------------------------------
+ * Update cached face geometry (centers, normals, and vertex coordinates)
+ * for a cell -> face connectivity.
+ *
+ * parameters:
+ *   builder   <->  pointer to a cs_lagr_track_builder_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_face_geom(cs_lagr_track_builder_t   *builder)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)(mesh->vtx_coord);
+
+  const cs_lnum_t  *cell_face_idx = builder->cell_face_idx;
+  const cs_lnum_t  *cell_face_lst = builder->cell_face_lst;
+
+  if (builder->cell_face_vtx_idx == NULL)
+    return;
+
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
+
+    for (cs_lnum_t i = cell_face_idx[c_id]; i < cell_face_idx[c_id+1]; i++) {
+
+      const cs_lnum_t face_num = cell_face_lst[i];
+      const cs_lnum_t *face_connect;
+      const cs_real_t *face_cog, *face_normal;
+
+      if (face_num > 0) {
+        cs_lnum_t face_id = face_num - 1;
+        face_connect = mesh->i_face_vtx_lst + mesh->i_face_vtx_idx[face_id];
+        face_cog = fvq->i_face_cog + (3*face_id);
+        face_normal = fvq->i_face_normal + (3*face_id);
+      }
+      else {
+        cs_lnum_t face_id = -face_num - 1;
+        face_connect = mesh->b_face_vtx_lst + mesh->b_face_vtx_idx[face_id];
+        face_cog = fvq->b_face_cog + (3*face_id);
+        face_normal = fvq->b_face_normal + (3*face_id);
+      }
+
+      for (int k = 0; k < 3; k++) {
+        builder->cell_face_cog[i][k] = face_cog[k];
+        builder->cell_face_normal[i][k] = face_normal[k];
+      }
+
+      const cs_lnum_t s_id = builder->cell_face_vtx_idx[i];
+      const cs_lnum_t n_vertices = builder->cell_face_vtx_idx[i+1] - s_id;
+
+      for (cs_lnum_t j = 0; j < n_vertices; j++) {
+        for (int k = 0; k < 3; k++)
+          builder->cell_face_vtx_coords[s_id + j][k]
+            = vtx_coord[face_connect[j]][k];
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Define cached face geometry for a cell -> face connectivity.
+ *
+ * Face geometry is packed in cell -> face connectivity order, so that
+ * all data needed to find the exit face of a particle from a given cell
+ * is contiguous. Vertex coordinates are duplicated for each face,
+ * and edge orientations (based on global vertex ids) are stored so that
+ * intersection tests are identical to those using the mesh connectivity.
+ *
+ * parameters:
+ *   builder   <->  pointer to a cs_lagr_track_builder_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_cell_face_geom(cs_lagr_track_builder_t   *builder)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+
+  builder->cell_face_orient = NULL;
+  builder->cell_face_cog = NULL;
+  builder->cell_face_normal = NULL;
+  builder->cell_face_vtx_idx = NULL;
+  builder->cell_face_vtx_coords = NULL;
+  builder->cell_face_edge_orient = NULL;
+
+  if (_use_geometry_cache == false)
+    return;
+
+  const cs_lnum_t  *cell_face_idx = builder->cell_face_idx;
+  const cs_lnum_t  *cell_face_lst = builder->cell_face_lst;
+
+  const cs_lnum_t n_cell_faces = cell_face_idx[mesh->n_cells];
+
+  BFT_MALLOC(builder->cell_face_orient, n_cell_faces, signed char);
+  BFT_MALLOC(builder->cell_face_cog, n_cell_faces, cs_real_3_t);
+  BFT_MALLOC(builder->cell_face_normal, n_cell_faces, cs_real_3_t);
+  BFT_MALLOC(builder->cell_face_vtx_idx, n_cell_faces + 1, cs_lnum_t);
+
+  /* Vertex index and face orientation */
+
+  cs_lnum_t *vtx_idx = builder->cell_face_vtx_idx;
+
+  vtx_idx[0] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
+    for (cs_lnum_t i = cell_face_idx[c_id]; i < cell_face_idx[c_id+1]; i++) {
+      const cs_lnum_t face_num = cell_face_lst[i];
+      if (face_num > 0) {
+        cs_lnum_t face_id = face_num - 1;
+        vtx_idx[i+1] =   mesh->i_face_vtx_idx[face_id+1]
+                       - mesh->i_face_vtx_idx[face_id];
+        builder->cell_face_orient[i]
+          = (c_id == mesh->i_face_cells[face_id][1]) ? -1 : 1;
+      }
+      else {
+        cs_lnum_t face_id = -face_num - 1;
+        vtx_idx[i+1] =   mesh->b_face_vtx_idx[face_id+1]
+                       - mesh->b_face_vtx_idx[face_id];
+        builder->cell_face_orient[i] = 1;
+      }
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_cell_faces; i++)
+    vtx_idx[i+1] += vtx_idx[i];
+
+  BFT_MALLOC(builder->cell_face_vtx_coords, vtx_idx[n_cell_faces],
+             cs_real_3_t);
+  BFT_MALLOC(builder->cell_face_edge_orient, vtx_idx[n_cell_faces],
+             signed char);
+
+  /* Edge orientation */
+
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
+    for (cs_lnum_t i = cell_face_idx[c_id]; i < cell_face_idx[c_id+1]; i++) {
+
+      const cs_lnum_t face_num = cell_face_lst[i];
+      const cs_lnum_t *face_connect;
+
+      if (face_num > 0)
+        face_connect =   mesh->i_face_vtx_lst
+                       + mesh->i_face_vtx_idx[face_num - 1];
+      else
+        face_connect =   mesh->b_face_vtx_lst
+                       + mesh->b_face_vtx_idx[-face_num - 1];
+
+      const cs_lnum_t s_id = vtx_idx[i];
+      const cs_lnum_t n_vertices = vtx_idx[i+1] - s_id;
+
+      for (cs_lnum_t j = 0; j < n_vertices; j++) {
+        cs_lnum_t vtx_id_0 = face_connect[j];
+        cs_lnum_t vtx_id_1 = face_connect[(j+1)%n_vertices];
+        builder->cell_face_edge_orient[s_id + j]
+          = (vtx_id_0 < vtx_id_1) ? 1 : -1;
+      }
+
+    }
+  }
+
+  _update_cell_face_geom(builder);
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a cs_lagr_track_builder_t structure.
  *
@@ -780,6 +1001,10 @@ _init_track_builder(cs_lnum_t  n_particles_max,
 
   _define_cell_face_connect(builder);
 
+  /* Define associated face geometry cache */
+
+  _define_cell_face_geom(builder);
+
   /* Define a cs_lagr_halo_t structure to deal with parallelism and
      periodicity */
 
@@ -808,6 +1033,10 @@ _init_track_builder(cs_lnum_t  n_particles_max,
   }
 #endif
 
+  /* Refresh cached geometry when the mesh is deformed by ALE */
+
+  cs_ale_set_geometry_update_hook(cs_lagr_tracking_update_geometry);
+
   return builder;
 }
 
@@ -830,6 +1059,13 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   BFT_FREE(builder->cell_face_idx);
   BFT_FREE(builder->cell_face_lst);
 
+  BFT_FREE(builder->cell_face_orient);
+  BFT_FREE(builder->cell_face_cog);
+  BFT_FREE(builder->cell_face_normal);
+  BFT_FREE(builder->cell_face_vtx_idx);
+  BFT_FREE(builder->cell_face_vtx_coords);
+  BFT_FREE(builder->cell_face_edge_orient);
+
   /* Destroy the cs_lagr_halo_t structure */
 
   _delete_lagr_halo(&(builder->halo));
@@ -842,6 +1078,244 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if particle tracking may be distributed over threads.
+ *
+ * Models using the global random number generator (roughness, fouling)
+ * or modifying particles other than the tracked one (clogging) require
+ * particles to be tracked in sequence.
+ *
+ * returns:
+ *   true if particles may be tracked by multiple threads
+ *----------------------------------------------------------------------------*/
+
+static bool
+_threaded_tracking(void)
+{
+  const cs_lagr_model_t *lagr_model = cs_glob_lagr_model;
+
+  if (cs_glob_n_threads < 2)
+    return false;
+
+  if (lagr_model->clogging > 0 || lagr_model->roughness > 0)
+    return false;
+
+  const cs_lagr_zone_data_t *bdy_conditions
+    = cs_lagr_get_boundary_conditions();
+
+  for (int z_id = 0; z_id < bdy_conditions->n_zones; z_id++) {
+    if (bdy_conditions->zone_type[z_id] == CS_LAGR_FOULING)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Create per-thread tracking accumulators.
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *
+ * returns:
+ *   array of accumulators (one per thread)
+ *----------------------------------------------------------------------------*/
+
+static cs_lagr_track_acc_t *
+_create_track_acc(int  n_threads)
+{
+  cs_lagr_track_acc_t  *acc = NULL;
+
+  const cs_lagr_zone_data_t *bdy_conditions
+    = cs_lagr_get_boundary_conditions();
+
+  const int n_fr = bdy_conditions->n_zones
+                   * (cs_glob_lagr_model->n_stat_classes + 1);
+
+  BFT_MALLOC(acc, n_threads, cs_lagr_track_acc_t);
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+
+    cs_lagr_track_acc_t  *t_acc = acc + t_id;
+
+    t_acc->n_part_dep = 0;
+    t_acc->n_part_fou = 0;
+    t_acc->weight_dep = 0.;
+    t_acc->weight_fou = 0.;
+
+    BFT_MALLOC(t_acc->particle_flow_rate, n_fr, cs_real_t);
+    for (int i = 0; i < n_fr; i++)
+      t_acc->particle_flow_rate[i] = 0.;
+
+    t_acc->n_b_contribs = 0;
+    t_acc->n_b_contribs_max = 0;
+    t_acc->b_contrib_id = NULL;
+    t_acc->b_contrib_val = NULL;
+
+    t_acc->n_sync = 0;
+    t_acc->n_sync_max = 0;
+    t_acc->sync_id = NULL;
+
+  }
+
+  return acc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy per-thread tracking accumulators.
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *   acc       <-> pointer to array of accumulators
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_track_acc(int                    n_threads,
+                   cs_lagr_track_acc_t  **acc)
+{
+  cs_lagr_track_acc_t  *_acc = *acc;
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    BFT_FREE(_acc[t_id].particle_flow_rate);
+    BFT_FREE(_acc[t_id].b_contrib_id);
+    BFT_FREE(_acc[t_id].b_contrib_val);
+    BFT_FREE(_acc[t_id].sync_id);
+  }
+
+  BFT_FREE(*acc);
+}
+
+/*----------------------------------------------------------------------------
+ * Return accumulator associated with the current thread.
+ *
+ * parameters:
+ *   acc <-- array of accumulators (one per thread)
+ *
+ * returns:
+ *   pointer to accumulator for the current thread
+ *----------------------------------------------------------------------------*/
+
+inline static cs_lagr_track_acc_t *
+_get_track_acc(cs_lagr_track_acc_t  *acc)
+{
+  int t_id = 0;
+
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+  assert(t_id < cs_glob_n_threads);
+#endif
+
+  return acc + t_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a contribution to a boundary statistic.
+ *
+ * parameters:
+ *   acc    <-> accumulator for the current thread
+ *   id     <-- id in bound_stat array, or -(id+1) to reset value to 0
+ *   val    <-- value to add
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_track_acc_b_stat(cs_lagr_track_acc_t  *acc,
+                  cs_lnum_t             id,
+                  cs_real_t             val)
+{
+  if (acc->n_b_contribs >= acc->n_b_contribs_max) {
+    acc->n_b_contribs_max = CS_MAX(64, acc->n_b_contribs_max*2);
+    BFT_REALLOC(acc->b_contrib_id, acc->n_b_contribs_max, cs_lnum_t);
+    BFT_REALLOC(acc->b_contrib_val, acc->n_b_contribs_max, cs_real_t);
+  }
+
+  acc->b_contrib_id[acc->n_b_contribs] = id;
+  acc->b_contrib_val[acc->n_b_contribs] = val;
+  acc->n_b_contribs += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Mark a particle as changing rank.
+ *
+ * parameters:
+ *   acc         <-> accumulator for the current thread
+ *   particle_id <-- particle id
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_track_acc_sync(cs_lagr_track_acc_t  *acc,
+                cs_lnum_t             particle_id)
+{
+  if (acc->n_sync >= acc->n_sync_max) {
+    acc->n_sync_max = CS_MAX(64, acc->n_sync_max*2);
+    BFT_REALLOC(acc->sync_id, acc->n_sync_max, cs_lnum_t);
+  }
+
+  acc->sync_id[acc->n_sync] = particle_id;
+  acc->n_sync += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply and reset contributions from per-thread accumulators.
+ *
+ * Counters are added to those of the particle set, boundary statistics
+ * and flow rate contributions are applied to the matching arrays, and
+ * lists of particles changing rank are appended to that of the first
+ * accumulator (in thread order).
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *   acc       <-> array of accumulators (one per thread)
+ *   particles <-> pointer to particle set
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_track_acc(int                      n_threads,
+                 cs_lagr_track_acc_t     *acc,
+                 cs_lagr_particle_set_t  *particles)
+{
+  cs_lagr_zone_data_t *bdy_conditions = cs_lagr_get_boundary_conditions();
+
+  const int n_fr = bdy_conditions->n_zones
+                   * (cs_glob_lagr_model->n_stat_classes + 1);
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+
+    cs_lagr_track_acc_t  *t_acc = acc + t_id;
+
+    particles->n_part_dep += t_acc->n_part_dep;
+    particles->n_part_fou += t_acc->n_part_fou;
+    particles->weight_dep += t_acc->weight_dep;
+    particles->weight_fou += t_acc->weight_fou;
+
+    t_acc->n_part_dep = 0;
+    t_acc->n_part_fou = 0;
+    t_acc->weight_dep = 0.;
+    t_acc->weight_fou = 0.;
+
+    for (int i = 0; i < n_fr; i++) {
+      bdy_conditions->particle_flow_rate[i] += t_acc->particle_flow_rate[i];
+      t_acc->particle_flow_rate[i] = 0.;
+    }
+
+    for (cs_lnum_t i = 0; i < t_acc->n_b_contribs; i++) {
+      cs_lnum_t id = t_acc->b_contrib_id[i];
+      if (id > -1)
+        bound_stat[id] += t_acc->b_contrib_val[i];
+      else
+        bound_stat[-id - 1] = 0.;
+    }
+
+    t_acc->n_b_contribs = 0;
+
+    if (t_id > 0) {
+      for (cs_lnum_t i = 0; i < t_acc->n_sync; i++)
+        _track_acc_sync(acc, t_acc->sync_id[i]);
+      t_acc->n_sync = 0;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Manage detected errors
  *
@@ -901,7 +1375,8 @@ _manage_error(cs_lnum_t                       failsafe_mode,
  *   particle_id      <-- pointer to particle id
  *   sign             <-- -1 to remove contribution, 1 to add it
  *   b_face_surf      <-- boundary face surface
- *   part_b_mass_flux <-> particle mass flux array
+ *   b_flux_shift     <-- start of particle mass flux in bound_stat array
+ *   acc              <-> accumulator for the current thread
  *----------------------------------------------------------------------------*/
 
 static void
@@ -909,7 +1384,8 @@ _b_mass_contribution(const cs_lagr_particle_set_t   *particles,
                      cs_lnum_t                       particle_id,
                      const cs_real_t                 sign,
                      const cs_real_t                 b_face_surf[],
-                     cs_real_t                       part_b_mass_flux[])
+                     cs_lnum_t                       b_flux_shift,
+                     cs_lagr_track_acc_t            *acc)
 {
   const cs_lagr_attribute_map_t  *p_am = particles->p_am;
   const unsigned char *particle
@@ -933,8 +1409,9 @@ _b_mass_contribution(const cs_lagr_particle_set_t   *particles,
       = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
     cs_real_t face_area = b_face_surf[neighbor_face_id];
 
-    part_b_mass_flux[neighbor_face_id]
-      += sign * cur_stat_weight * cur_mass / face_area;
+    _track_acc_b_stat(acc,
+                      b_flux_shift + neighbor_face_id,
+                      sign * cur_stat_weight * cur_mass / face_area);
 
   }
 }
@@ -948,6 +1425,7 @@ _b_mass_contribution(const cs_lagr_particle_set_t   *particles,
  *   face_id         <-- index of the treated face
  *   t_intersect     <-- used to compute the intersection of the trajectory and
  *                       the face
+ *   acc             <-> accumulator for the current thread
  *   p_move_particle <-- particle moves?
  *
  * returns:
@@ -959,6 +1437,7 @@ _internal_treatment(cs_lagr_particle_set_t    *particles,
                     void                      *particle,
                     cs_lnum_t                  face_id,
                     double                     t_intersect,
+                    cs_lagr_track_acc_t       *acc,
                     cs_lnum_t                 *p_move_particle)
 {
   const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
@@ -1071,8 +1550,8 @@ _internal_treatment(cs_lagr_particle_set_t    *particles,
 
       particle_state = CS_LAGR_PART_TREATED;
 
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      acc->n_part_dep += 1;
+      acc->weight_dep += particle_stat_weight;
 
     }
   }
@@ -1098,6 +1577,7 @@ _internal_treatment(cs_lagr_particle_set_t    *particles,
  * parameters:
  *   particles  <-- pointer to particle set
  *   particle   <-> particle data for current particle
+ *   acc        <-> accumulator for the current thread
  *   ...        <-> pointer to an error indicator
  *
  * returns:
@@ -1110,6 +1590,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
                     cs_lnum_t                  face_num,
                     double                     t_intersect,
                     int                        boundary_zone,
+                    cs_lagr_track_acc_t       *acc,
                     cs_lnum_t                 *p_move_particle)
 {
   const cs_mesh_t  *mesh = cs_glob_mesh;
@@ -1132,8 +1613,6 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
   cs_lnum_t  face_id = face_num - 1;
   cs_lagr_tracking_state_t  particle_state = CS_LAGR_PART_TO_SYNC;
 
-  cs_lagr_zone_data_t  *bdy_conditions = cs_lagr_get_boundary_conditions();
-
   cs_real_t  energt = 0.;
   cs_lnum_t  contact_number = 0;
   cs_real_t  *surface_coverage = NULL;
@@ -1159,8 +1638,6 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
   const char b_type = cs_glob_lagr_boundary_conditions->elt_type[face_id];
 
-  assert(bdy_conditions != NULL);
-
   for (k = 0; k < 3; k++)
     disp[k] = particle_coord[k] - p_info->start_coords[k];
 
@@ -1201,8 +1678,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     particle_state = CS_LAGR_PART_OUT;
 
     if (b_type == CS_LAGR_DEPO1) {
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      acc->n_part_dep += 1;
+      acc->weight_dep += particle_stat_weight;
       if (cs_glob_lagr_model->deposition == 1)
         cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG,
                                   CS_LAGR_PART_DEPOSITED);
@@ -1226,8 +1703,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
     }
 
-    particles->n_part_dep += 1;
-    particles->weight_dep += particle_stat_weight;
+    acc->n_part_dep += 1;
+    acc->weight_dep += particle_stat_weight;
 
     /* Specific treatment in case of particle resuspension modeling */
 
@@ -1278,6 +1755,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       /* If the clogging modeling is activated,                 */
       /* computation of the number of particles in contact with */
       /* the depositing particle                                */
+      /* (particles are tracked in sequence with this model, so */
+      /* statistics may be accessed directly)                   */
 
       surface_coverage = &bound_stat[cs_glob_lagr_boundary_interactions->iscovc * n_b_faces + face_id];
       deposit_height_mean = &bound_stat[cs_glob_lagr_boundary_interactions->ihdepm * n_b_faces + face_id];
@@ -1337,8 +1816,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           (particle, p_am, CS_LAGR_CELL_NUM,
            - cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_NUM));
 
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        acc->n_part_dep += 1;
+        acc->weight_dep += particle_stat_weight;
 
         particle_state = CS_LAGR_PART_STUCK;
       }
@@ -1359,8 +1838,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           particle_velocity[k] = 0.0;
           particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
         }
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        acc->n_part_dep += 1;
+        acc->weight_dep += particle_stat_weight;
         particle_state = CS_LAGR_PART_TREATED;
 
       }
@@ -1411,8 +1890,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           cs_lagr_particle_set_lnum(particle, p_am,CS_LAGR_NEIGHBOR_FACE_ID ,
                                     face_id);
 
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          acc->n_part_dep += 1;
+          acc->weight_dep += particle_stat_weight;
           particle_state = CS_LAGR_PART_TREATED;
         }
         else {
@@ -1556,8 +2035,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
           move_particle = CS_LAGR_PART_MOVE_OFF;
           particle_state = CS_LAGR_PART_OUT;
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          acc->n_part_dep += 1;
+          acc->weight_dep += particle_stat_weight;
 
           cur_part_height   = cs_lagr_particle_get_real(cur_part, p_am,
                                                         CS_LAGR_HEIGHT);
@@ -1757,26 +2236,29 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
         particle_state = CS_LAGR_PART_OUT;
 
         /* Recording for listing/listla*/
-        particles->n_part_fou += 1;
-        particles->weight_fou += particle_stat_weight;
+        acc->n_part_fou += 1;
+        acc->weight_fou += particle_stat_weight;
 
         /* Recording for statistics*/
         if (cs_glob_lagr_boundary_interactions->iencnbbd > 0) {
-          bound_stat[  cs_glob_lagr_boundary_interactions->iencnb
-                     * n_b_faces + face_id]
-            += particle_stat_weight;
+          _track_acc_b_stat(acc,
+                              cs_glob_lagr_boundary_interactions->iencnb
+                            * n_b_faces + face_id,
+                            particle_stat_weight);
         }
         if (cs_glob_lagr_boundary_interactions->iencmabd > 0) {
-          bound_stat[  cs_glob_lagr_boundary_interactions->iencma
-                     * n_b_faces + face_id]
-            += particle_stat_weight * particle_mass / face_area;
+          _track_acc_b_stat(acc,
+                              cs_glob_lagr_boundary_interactions->iencma
+                            * n_b_faces + face_id,
+                            particle_stat_weight * particle_mass / face_area);
         }
         if (cs_glob_lagr_boundary_interactions->iencdibd > 0) {
-          bound_stat[  cs_glob_lagr_boundary_interactions->iencdi
-                     * n_b_faces + face_id]
-            +=   particle_stat_weight
-               * cs_lagr_particle_get_real(particle, p_am,
-                                           CS_LAGR_SHRINKING_DIAMETER);
+          _track_acc_b_stat(acc,
+                              cs_glob_lagr_boundary_interactions->iencdi
+                            * n_b_faces + face_id,
+                              particle_stat_weight
+                            * cs_lagr_particle_get_real
+                                (particle, p_am, CS_LAGR_SHRINKING_DIAMETER));
         }
         if (cs_glob_lagr_boundary_interactions->iencckbd > 0) {
           if (particle_mass > 0) {
@@ -1787,11 +2269,12 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
               = cs_lagr_particle_attr_const(particle, p_am,
                                             CS_LAGR_COKE_MASS);
             for (k = 0; k < n_layers; k++) {
-              bound_stat[  cs_glob_lagr_boundary_interactions->iencck
-                         * n_b_faces + face_id]
-                +=   particle_stat_weight
-                   * (particle_coal_mass[k] + particle_coke_mass[k])
-                   / particle_mass;
+              _track_acc_b_stat(acc,
+                                  cs_glob_lagr_boundary_interactions->iencck
+                                * n_b_faces + face_id,
+                                  particle_stat_weight
+                                * (particle_coal_mass[k] + particle_coke_mass[k])
+                                / particle_mass);
             }
           }
         }
@@ -1888,14 +2371,13 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     cs_real_t fr =   particle_stat_weight
                    * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
 
-    bdy_conditions->particle_flow_rate[boundary_zone*n_stats] -= fr;
+    acc->particle_flow_rate[boundary_zone*n_stats] -= fr;
 
     if (n_stats > 1) {
       int class_id
         = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
       if (class_id > 0 && class_id < n_stats)
-        bdy_conditions->particle_flow_rate[  boundary_zone*n_stats
-                                           + class_id] -= fr;
+        acc->particle_flow_rate[boundary_zone*n_stats + class_id] -= fr;
     }
 
   }
@@ -1910,25 +2392,34 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
     /* Number of particle-boundary interactions  */
     if (cs_glob_lagr_boundary_interactions->inbrbd > 0)
-      bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
-        += particle_stat_weight;
+      _track_acc_b_stat(acc,
+                        cs_glob_lagr_boundary_interactions->inbr * n_b_faces
+                        + face_id,
+                        particle_stat_weight);
 
     /* Particle impact angle and velocity*/
     if (cs_glob_lagr_boundary_interactions->iangbd > 0) {
       cs_real_t imp_ang = acos(cs_math_3_dot_product(compo_vel, face_normal)
                                / (face_area * norm_vel));
-      bound_stat[cs_glob_lagr_boundary_interactions->iang * n_b_faces + face_id]
-        += imp_ang * particle_stat_weight;
+      _track_acc_b_stat(acc,
+                        cs_glob_lagr_boundary_interactions->iang * n_b_faces
+                        + face_id,
+                        imp_ang * particle_stat_weight);
     }
 
     if (cs_glob_lagr_boundary_interactions->ivitbd > 0)
-      bound_stat[cs_glob_lagr_boundary_interactions->ivit * n_b_faces + face_id]
-        += norm_vel * particle_stat_weight;
+      _track_acc_b_stat(acc,
+                        cs_glob_lagr_boundary_interactions->ivit * n_b_faces
+                        + face_id,
+                        norm_vel * particle_stat_weight);
 
     /* User statistics management. By defaut, set to zero */
     if (cs_glob_lagr_boundary_interactions->nusbor > 0)
       for (int n1 = 0; n1 < cs_glob_lagr_boundary_interactions->nusbor; n1++)
-        bound_stat[cs_glob_lagr_boundary_interactions->iusb[n1] * n_b_faces + face_id] = 0.0;
+        _track_acc_b_stat(acc,
+                          - (  cs_glob_lagr_boundary_interactions->iusb[n1]
+                             * n_b_faces + face_id) - 1,
+                          0.);
   }
 
   return particle_state;
@@ -1944,6 +2435,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
  *   failsafe_mode            <-- with (0) / without (1) failure capability
  *   b_face_zone_id           <-- boundary face zone id
  *   visc_length              <-- viscous layer thickness
+ *   u                        <-- pointer to velocity field
+ *   acc                      <-> accumulator for the current thread
  *
  * returns:
  *   a state associated to the status of the particle (treated, to be deleted,
@@ -1957,7 +2450,8 @@ _local_propagation(void                           *particle,
                    int                             failsafe_mode,
                    const int                       b_face_zone_id[],
                    const cs_real_t                 visc_length[],
-                   const cs_field_t               *u)
+                   const cs_field_t               *u,
+                   cs_lagr_track_acc_t            *acc)
 {
   cs_lnum_t  i, k;
   cs_real_t  disp[3];
@@ -2137,65 +2631,90 @@ _local_propagation(void                           *particle,
          i < cell_face_idx[cur_cell_id+1] && move_particle == CS_LAGR_PART_MOVE_ON;
          i++) {
 
-      cs_lnum_t face_id, vtx_start, vtx_end, n_vertices;
-      const cs_lnum_t  *face_connect;
-      const cs_real_t *face_cog, *face_normal;
+      cs_lnum_t face_num = cell_face_lst[i];
+
+      /*
+        adimensional distance estimation of face intersection
+        (1 if no chance of intersection)
+      */
 
-      /* Outward normal: always well oriented for external faces, depend on the
-       * connectivity for internal faces */
-      int reorient_face = 1;
+      int n_crossings[2] = {0, 0};
 
-      cs_lnum_t face_num = cell_face_lst[i];
+      double t;
 
-      if (face_num > 0) {
+      if (builder->cell_face_vtx_idx != NULL) {
 
-        /* Interior face */
+        /* Use cached geometry */
 
-        face_id = face_num - 1;
-        if (cur_cell_id == mesh->i_face_cells[face_id][1])
-          reorient_face = -1;
-        vtx_start = mesh->i_face_vtx_idx[face_id];
-        vtx_end = mesh->i_face_vtx_idx[face_id+1];
-        n_vertices = vtx_end - vtx_start;
+        const cs_lnum_t s_id = builder->cell_face_vtx_idx[i];
+        const cs_lnum_t n_vertices = builder->cell_face_vtx_idx[i+1] - s_id;
 
-        face_connect = mesh->i_face_vtx_lst + vtx_start;
-        face_cog = fvq->i_face_cog + (3*face_id);
-        face_normal = fvq->i_face_normal + (3*face_id);
+        t = cs_geom_segment_intersect_packed_face
+              (builder->cell_face_orient[i],
+               n_vertices,
+               (const cs_real_3_t *)(builder->cell_face_vtx_coords + s_id),
+               builder->cell_face_edge_orient + s_id,
+               builder->cell_face_cog[i],
+               builder->cell_face_normal[i],
+               prev_location,
+               next_location,
+               n_crossings);
 
       }
       else {
 
-        assert(face_num < 0);
+        cs_lnum_t face_id, vtx_start, vtx_end, n_vertices;
+        const cs_lnum_t  *face_connect;
+        const cs_real_t *face_cog, *face_normal;
 
-        /* Boundary faces */
+        /* Outward normal: always well oriented for external faces, depend
+         * on the connectivity for internal faces */
+        int reorient_face = 1;
 
-        face_id = -face_num - 1;
-        vtx_start = mesh->b_face_vtx_idx[face_id];
-        vtx_end = mesh->b_face_vtx_idx[face_id+1];
-        n_vertices = vtx_end - vtx_start;
+        if (face_num > 0) {
 
-        face_connect = mesh->b_face_vtx_lst + vtx_start;
-        face_cog = fvq->b_face_cog + (3*face_id);
-        face_normal = fvq->b_face_normal + (3*face_id);
+          /* Interior face */
 
-      }
+          face_id = face_num - 1;
+          if (cur_cell_id == mesh->i_face_cells[face_id][1])
+            reorient_face = -1;
+          vtx_start = mesh->i_face_vtx_idx[face_id];
+          vtx_end = mesh->i_face_vtx_idx[face_id+1];
+          n_vertices = vtx_end - vtx_start;
 
-      /*
-        adimensional distance estimation of face intersection
-        (1 if no chance of intersection)
-      */
+          face_connect = mesh->i_face_vtx_lst + vtx_start;
+          face_cog = fvq->i_face_cog + (3*face_id);
+          face_normal = fvq->i_face_normal + (3*face_id);
 
-      int n_crossings[2] = {0, 0};
+        }
+        else {
+
+          assert(face_num < 0);
 
-      double t = cs_geom_segment_intersect_face(reorient_face,
-                                                n_vertices,
-                                                face_connect,
-                                                vtx_coord,
-                                                face_cog,
-                                                face_normal,
-                                                prev_location,
-                                                next_location,
-                                                n_crossings);
+          /* Boundary faces */
+
+          face_id = -face_num - 1;
+          vtx_start = mesh->b_face_vtx_idx[face_id];
+          vtx_end = mesh->b_face_vtx_idx[face_id+1];
+          n_vertices = vtx_end - vtx_start;
+
+          face_connect = mesh->b_face_vtx_lst + vtx_start;
+          face_cog = fvq->b_face_cog + (3*face_id);
+          face_normal = fvq->b_face_normal + (3*face_id);
+
+        }
+
+        t = cs_geom_segment_intersect_face(reorient_face,
+                                           n_vertices,
+                                           face_connect,
+                                           vtx_coord,
+                                           face_cog,
+                                           face_normal,
+                                           prev_location,
+                                           next_location,
+                                           n_crossings);
+
+      }
 
       n_in += n_crossings[0];
       n_out += n_crossings[1];
@@ -2278,6 +2797,7 @@ _local_propagation(void                           *particle,
                               particle,
                               face_id,
                               t_intersect,
+                              acc,
                               &move_particle);
 
       if (move_particle != CS_LAGR_PART_MOVE_OFF) {
@@ -2444,6 +2964,7 @@ _local_propagation(void                           *particle,
                               face_num,
                               t_intersect,
                               b_face_zone_id[face_num-1],
+                              acc,
                               &move_particle);
 
       if (cs_glob_lagr_time_scheme->t_order == 2)
@@ -2541,6 +3062,36 @@ _exchange_counter(const cs_halo_t  *halo,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Update particle count and weight after reception of particles,
+ * appended to the particle set.
+ *
+ * parameters:
+ *  particles        <-> set of particles to update
+ *  n_recv_particles <-- number of received particles
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_received_particles(cs_lagr_particle_set_t  *particles,
+                        cs_lnum_t                n_recv_particles)
+{
+  cs_real_t tot_weight = 0.;
+
+  for (cs_lnum_t i = 0; i < n_recv_particles; i++) {
+
+    cs_real_t cur_part_stat_weight
+      = cs_lagr_particles_get_real(particles,
+                                   particles->n_particles + i,
+                                   CS_LAGR_STAT_WEIGHT);
+
+    tot_weight += cur_part_stat_weight;
+
+  }
+
+  particles->n_particles += n_recv_particles;
+  particles->weight += tot_weight;
+}
+
 /*----------------------------------------------------------------------------
  * Exchange particles
  *
@@ -2654,25 +3205,60 @@ _exchange_particles(const cs_halo_t         *halo,
     }
   }
 
-  /* Update particle count and weight */
+  _add_received_particles(particles, n_recv_particles);
+}
 
-  cs_real_t tot_weight = 0.;
+#if defined(HAVE_MPI)
 
-  for (cs_lnum_t i = 0; i < n_recv_particles; i++) {
+/*----------------------------------------------------------------------------
+ * Exchange particles changing rank using an all-to-all distributor.
+ *
+ * Particles are sent as packed bytes in a single sparse exchange, using
+ * the current cs_all_to_all algorithm (MPI_Alltoall or crystal router).
+ * This is a collective operation.
+ *
+ * parameters:
+ *   particles <-> set of particles to update
+ *   n_send    <-- number of particles to send
+ *   send_buf  <-- packed particles to send
+ *   dest_rank <-> destination rank of each particle to send (freed here)
+ *----------------------------------------------------------------------------*/
 
-    cs_real_t cur_part_stat_weight
-      = cs_lagr_particles_get_real(particles,
-                                   particles->n_particles + i,
-                                   CS_LAGR_STAT_WEIGHT);
+static void
+_exchange_particles_all_to_all(cs_lagr_particle_set_t  *particles,
+                               cs_lnum_t                n_send,
+                               const unsigned char      send_buf[],
+                               int                    **dest_rank)
+{
+  const size_t extents = particles->p_am->extents;
 
-    tot_weight += cur_part_stat_weight;
+  cs_all_to_all_t *d = cs_all_to_all_create(n_send,
+                                            0,     /* flags */
+                                            NULL,  /* dest_id */
+                                            *dest_rank,
+                                            cs_glob_mpi_comm);
 
-  }
+  cs_all_to_all_transfer_dest_rank(d, dest_rank);
 
-  particles->n_particles += n_recv_particles;
-  particles->weight += tot_weight;
+  cs_lnum_t n_recv_particles = cs_all_to_all_n_elts_dest(d);
+
+  cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
+
+  cs_all_to_all_copy_array(d,
+                           CS_CHAR,
+                           extents,
+                           false,  /* reverse */
+                           send_buf,
+                           particles->p_buffer
+                           + extents*particles->n_particles);
+
+  cs_all_to_all_destroy(&d);
+
+  _add_received_particles(particles, n_recv_particles);
 }
 
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Determine particle halo sizes
  *
@@ -2680,12 +3266,16 @@ _exchange_particles(const cs_halo_t         *halo,
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
  *   particles <-- set of particles to update
+ *   n_sync    <-- number of particles changing rank
+ *   sync_id   <-- ids of particles changing rank
  *----------------------------------------------------------------------------*/
 
 static void
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
-                 const cs_lagr_particle_set_t  *particles)
+                 const cs_lagr_particle_set_t  *particles,
+                 cs_lnum_t                      n_sync,
+                 const cs_lnum_t                sync_id[])
 {
   cs_lnum_t  i, ghost_id;
 
@@ -2702,17 +3292,17 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   /* Loop on particles to count number of particles to send on each rank */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (i = 0; i < n_sync; i++) {
 
-    if (_get_tracking_info(particles, i)->state == CS_LAGR_PART_TO_SYNC) {
+    cs_lnum_t p_id = sync_id[i];
 
-      ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_NUM)
-                 - mesh->n_cells - 1;
+    assert(_get_tracking_info(particles, p_id)->state == CS_LAGR_PART_TO_SYNC);
 
-      assert(ghost_id >= 0);
-      lag_halo->send_count[lag_halo->rank[ghost_id]] += 1;
+    ghost_id =   cs_lagr_particles_get_lnum(particles, p_id, CS_LAGR_CELL_NUM)
+               - mesh->n_cells - 1;
 
-    }
+    assert(ghost_id >= 0);
+    lag_halo->send_count[lag_halo->rank[ghost_id]] += 1;
 
   } /* End of loop on particles */
 
@@ -2749,13 +3339,17 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
  *
  * parameters:
  *   particles <-> set of particles to update
+ *   n_sync    <-- number of particles changing rank
+ *   sync_id   <-- ids of particles changing rank
  *
  * returns:
  *   1 if displacement needs to continue, 0 if finished
  *----------------------------------------------------------------------------*/
 
 static int
-_sync_particle_set(cs_lagr_particle_set_t  *particles)
+_sync_particle_set(cs_lagr_particle_set_t  *particles,
+                   cs_lnum_t                n_sync,
+                   const cs_lnum_t          sync_id[])
 {
   cs_lnum_t  i, k, tr_id, rank, shift, ghost_id;
   cs_real_t matrix[3][4];
@@ -2781,11 +3375,27 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   const fvm_periodicity_t *periodicity = mesh->periodicity;
   const cs_interface_set_t  *face_ifs = builder->face_ifs;
 
-  int continue_displacement = 0;
+  int continue_displacement = (n_sync > 0) ? 1 : 0;
+
+  /* With the all-to-all migration mode, the global check is done first,
+     so that no exchange is required when no particle changes rank */
+
+  bool all_to_all = false;
+  cs_lnum_t n_send = 0;
+  int *dest_rank = NULL;
+
+  if (_migration_mode == CS_LAGR_MIGRATION_ALL_TO_ALL && cs_glob_n_ranks > 1) {
+    all_to_all = true;
+    cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
+    if (continue_displacement && lag_halo != NULL) {
+      _resize_lagr_halo(lag_halo, n_sync);
+      BFT_MALLOC(dest_rank, n_sync, int);
+    }
+  }
 
-  if (halo != NULL) {
+  else if (halo != NULL) {
 
-    _lagr_halo_count(mesh, lag_halo, particles);
+    _lagr_halo_count(mesh, lag_halo, particles, n_sync, sync_id);
 
     for (i = 0; i < halo->n_c_domains; i++) {
       n_recv_particles += lag_halo->recv_count[i];
@@ -2808,8 +3418,6 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
     if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
-      continue_displacement = 1;
-
       ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_NUM)
                  - halo->n_local_elts - 1;
       rank = lag_halo->rank[ghost_id];
@@ -2818,7 +3426,10 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
       cs_lagr_particles_set_lnum(particles, i, CS_LAGR_CELL_NUM,
                                  lag_halo->dist_cell_num[ghost_id]);
 
-      shift = lag_halo->send_shift[rank] + lag_halo->send_count[rank];
+      if (all_to_all)
+        shift = n_send;
+      else
+        shift = lag_halo->send_shift[rank] + lag_halo->send_count[rank];
 
       /* Update if needed last_face_num */
 
@@ -2943,7 +3554,12 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
              particles->p_buffer + extents*i,
              extents);
 
-      lag_halo->send_count[rank] += 1;
+      if (all_to_all)
+        dest_rank[n_send] = halo->c_domain_rank[rank];
+      else
+        lag_halo->send_count[rank] += 1;
+
+      n_send++;
 
       /* Remove the particle from the local set (do not copy it) */
 
@@ -2988,6 +3604,18 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   /* Exchange particles, then update set */
 
+#if defined(HAVE_MPI)
+  if (all_to_all) {
+    if (continue_displacement)
+      _exchange_particles_all_to_all(particles,
+                                     n_send,
+                                     (lag_halo != NULL) ?
+                                     lag_halo->send_buf : NULL,
+                                     &dest_rank);
+    return continue_displacement;
+  }
+#endif
+
   if (halo != NULL)
     _exchange_particles(halo, lag_halo, particles);
 
@@ -3000,16 +3628,17 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
  * Prepare for particle movement phase
  *
  * parameters:
- *   particles        <-> pointer to particle set structure
- *   part_b_mass_flux <-> particle mass flux array, or NULL
+ *   particles    <-> pointer to particle set structure
+ *   b_flux_shift <-- start of particle mass flux in bound_stat array,
+ *                    or -1
+ *   acc          <-> array of accumulators (one per thread)
  *----------------------------------------------------------------------------*/
 
 static void
 _initialize_displacement(cs_lagr_particle_set_t  *particles,
-                         cs_real_t                part_b_mass_flux[])
+                         cs_lnum_t                b_flux_shift,
+                         cs_lagr_track_acc_t     *acc)
 {
-  cs_lnum_t  i;
-
   const cs_lagr_model_t *lagr_model = cs_glob_lagr_model;
 
   const cs_lagr_attribute_map_t  *am = particles->p_am;
@@ -3042,7 +3671,9 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
 
   /* Prepare tracking info */
 
-  for (i = 0; i < particles->n_particles; i++) {
+# pragma omp parallel for schedule(static) \
+                           if (particles->n_particles > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
     cs_lnum_t cur_part_cell_num
       = cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_NUM);
@@ -3118,12 +3749,13 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
     /* Remove contribution from deposited or rolling particles
        to boundary mass flux at the beginning of their movement. */
 
-    else if (lagr_model->deposition > 0 && part_b_mass_flux != NULL)
+    else if (lagr_model->deposition > 0 && b_flux_shift > -1)
       _b_mass_contribution(particles,
                            i,
                            -1.0,
                            b_face_surf,
-                           part_b_mass_flux);
+                           b_flux_shift,
+                           _get_track_acc(acc));
 
   }
 
@@ -3139,107 +3771,50 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
  * Update particle set structures: compact array.
  *
  * parameters:
- *   particles        <-> pointer to particle set structure
- *   part_b_mass_flux <-> particle mass flux array, or NULL
+ *   particles    <-> pointer to particle set structure
+ *   b_flux_shift <-- start of particle mass flux in bound_stat array,
+ *                    or -1
+ *   acc          <-> array of accumulators (one per thread)
  *----------------------------------------------------------------------------*/
 
 static void
 _finalize_displacement(cs_lagr_particle_set_t  *particles,
-                       cs_real_t                part_b_mass_flux[])
+                       cs_lnum_t                b_flux_shift,
+                       cs_lagr_track_acc_t     *acc)
 {
   const cs_lagr_model_t *lagr_model = cs_glob_lagr_model;
-  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
-  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
   const cs_real_t  *b_face_surf = cs_glob_mesh_quantities->b_face_surf;
 
   const cs_lnum_t n_particles = particles->n_particles;
 
-  cs_lnum_t *cell_idx;
-  unsigned char *swap_buffer;
-  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
-
-  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
-  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
-
-  /* Cell index (count first) */
-
-  for (cs_lnum_t i = 0; i < n_cells+1; i++)
-    cell_idx[i] = 0;
-
-  /* Copy unordered particle data to buffer */
-
+#if defined(DEBUG) && !defined(NDEBUG)
   for (cs_lnum_t i = 0; i < n_particles; i++) {
-
     cs_lnum_t cur_part_state = _get_tracking_info(particles, i)->state;
-
     assert(   cur_part_state < CS_LAGR_PART_OUT
            && cur_part_state != CS_LAGR_PART_TO_SYNC);
-
-    cs_lnum_t cell_num = cs_lagr_particles_get_lnum(particles, i,
-                                                    CS_LAGR_CELL_NUM);
-
-    assert(cell_num != 0);
-
-    if (cell_num < 0)
-      cell_num = - cell_num;
-
-    cs_lnum_t cell_id = cell_num - 1;
-
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
-
-    cell_idx[cell_id+1] += 1;
-
   }
+#endif
 
-  /* Convert count to index */
-
-  for (cs_lnum_t i = 1; i < n_cells; i++)
-    cell_idx[i+1] += cell_idx[i];
-
-  assert(n_particles == cell_idx[n_cells]);
-
-  /* Now copy particle data and update some statistics */
-
-  const cs_lnum_t p_extents = particles->p_am->extents;
-  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_NUM];
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
-    cs_lnum_t cell_num
-      = *((const cs_lnum_t *)(swap_buffer + p_extents*i + cell_num_displ));
-
-    assert(cell_num != 0);
-
-    if (cell_num < 0)
-      cell_num = - cell_num;
-
-    cs_lnum_t cell_id = cell_num - 1;
-
-    cs_lnum_t particle_id = cell_idx[cell_id];
+  /* Reorder particles by cell */
 
-    cell_idx[cell_id] += 1;
+  cs_lagr_particle_set_sort_by_cell(particles, cs_glob_mesh->n_cells, NULL);
 
-    memcpy(particles->p_buffer + p_am->extents*particle_id,
-           swap_buffer + p_am->extents*i,
-           p_am->extents);
+  /* Add contribution from deposited or rolling particles
+     to boundary mass flux at the end of their movement. */
 
-    /* Add contribution from deposited or rolling particles
-       to boundary mass flux at the end of their movement. */
+  if (lagr_model->deposition > 0 && b_flux_shift > -1) {
 
-    if (lagr_model->deposition > 0 && part_b_mass_flux != NULL)
+#   pragma omp parallel for schedule(static) if (n_particles > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_particles; i++)
       _b_mass_contribution(particles,
-                           particle_id,
+                           i,
                            1.0,
                            b_face_surf,
-                           part_b_mass_flux);
+                           b_flux_shift,
+                           _get_track_acc(acc));
 
   }
 
-  BFT_FREE(swap_buffer);
-  BFT_FREE(cell_idx);
-
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("\n Particle set after %s\n", __func__);
   cs_lagr_particle_set_dump(particles);
@@ -3318,7 +3893,7 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
 
-  cs_real_t *part_b_mass_flux = NULL;
+  cs_lnum_t b_flux_shift = -1;
 
   int t_stat_id = cs_timer_stats_id_by_name("particle_displacement_stage");
 
@@ -3326,14 +3901,20 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   if (cs_glob_lagr_boundary_interactions->iflmbd) {
     assert(cs_glob_lagr_boundary_interactions->iflm >= 0);
-    part_b_mass_flux = bound_stat
-      + (cs_glob_lagr_boundary_interactions->iflm * mesh->n_b_faces);
+    b_flux_shift = cs_glob_lagr_boundary_interactions->iflm * mesh->n_b_faces;
   }
 
   assert(particles != NULL);
 
   const int *b_face_zone_id = cs_boundary_zone_face_class_id();
 
+  /* Thread-local accumulators */
+
+  const bool threaded_tracking = _threaded_tracking();
+  const int n_threads = cs_glob_n_threads;
+
+  cs_lagr_track_acc_t *acc = _create_track_acc(n_threads);
+
   /* particles->n_part_new: handled in injection step */
 
   particles->weight = 0.0;
@@ -3346,16 +3927,21 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
   particles->n_failed_part = 0;
   particles->weight_failed = 0.0;
 
-  _initialize_displacement(particles,
-                           part_b_mass_flux);
+  _initialize_displacement(particles, b_flux_shift, acc);
+
+  _merge_track_acc(n_threads, acc, particles);
 
   /* Main loop on  particles: global propagation */
 
   while (continue_displacement) {
 
+    const cs_lnum_t n_particles = particles->n_particles;
+
     /* Local propagation */
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+#   pragma omp parallel for schedule(static) \
+                             if (threaded_tracking && n_particles > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
 
       unsigned char *particle = particles->p_buffer + p_am->extents * i;
 
@@ -3367,6 +3953,8 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
       if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
+        cs_lagr_track_acc_t *t_acc = _get_track_acc(acc);
+
         /* Main particle displacement stage */
 
         cur_part_state = _local_propagation(particle,
@@ -3375,18 +3963,33 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
                                             failsafe_mode,
                                             b_face_zone_id,
                                             visc_length,
-                                            u);
+                                            u,
+                                            t_acc);
 
         _tracking_info(particles, i)->state = cur_part_state;
 
+        if (cur_part_state == CS_LAGR_PART_TO_SYNC)
+          _track_acc_sync(t_acc, i);
+
       }
 
     } /* End of loop on particles */
 
+    _merge_track_acc(n_threads, acc, particles);
+
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
-    continue_displacement = _sync_particle_set(particles);
+    cs_timer_t t0 = cs_timer_time();
+
+    continue_displacement = _sync_particle_set(particles,
+                                               acc[0].n_sync,
+                                               acc[0].sync_id);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_sync_timer, &t0, &t1);
+
+    acc[0].n_sync = 0;
 
 #if 0
     bft_printf("\n Particle set after sync\n");
@@ -3404,6 +4007,8 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   if (lagr_model->deposition > 0) {
 
+#   pragma omp parallel for schedule(static) \
+    if (particles->n_particles > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
       unsigned char *particle = particles->p_buffer + p_am->extents * i;
@@ -3525,11 +4130,111 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
     BFT_FREE(covered_surface);
   }
 
-  _finalize_displacement(particles, part_b_mass_flux);
+  _finalize_displacement(particles, b_flux_shift, acc);
+
+  _merge_track_acc(n_threads, acc, particles);
+
+  _destroy_track_acc(n_threads, &acc);
 
   cs_timer_stats_switch(t_top_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the migration mode for particles changing rank.
+ *
+ * With \ref CS_LAGR_MIGRATION_ALL_TO_ALL, particles reaching a ghost cell
+ * are packed and sent to the rank owning that cell in a single sparse
+ * exchange (see \ref cs_all_to_all_set_type for the algorithm used).
+ * A global check precedes the exchange, so that propagation loops in
+ * which no particle changes rank require a single reduction.
+ *
+ * In both modes, particles crossing several partitions during a time step
+ * are still tracked in successive passes, as each rank can only track
+ * particles through its own cells.
+ *
+ * \param[in]  mode  migration mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_migration_mode(cs_lagr_migration_mode_t  mode)
+{
+  _migration_mode = mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the migration mode for particles changing rank.
+ *
+ * \return  migration mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_migration_mode_t
+cs_lagr_tracking_get_migration_mode(void)
+{
+  return _migration_mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the accumulated time spent synchronizing the particle set
+ *        between local propagation stages.
+ *
+ * This includes the removal of particles which left the domain and the
+ * migration of particles changing rank.
+ *
+ * \return  associated time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_timer_counter_t
+cs_lagr_tracking_get_sync_timer(void)
+{
+  return _sync_timer;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether cached face geometry is used for particle tracking.
+ *
+ * By default, face centers, normals and vertex coordinates are packed
+ * in cell -> face order when the tracking structures are built, so that
+ * finding the exit face of a particle from a cell only requires access
+ * to contiguous data. This requires additional memory (about twice the
+ * size of the face -> vertex connectivity, in coordinates), so this cache
+ * may be disabled. Tracking results are the same in both cases.
+ *
+ * This setting is applied when the tracking structures are next built.
+ *
+ * \param[in]  use_cache  true to use cached geometry, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_geometry_cache(bool  use_cache)
+{
+  _use_geometry_cache = use_cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update cached tracking geometry after mesh deformation.
+ *
+ * This function should be called when vertex coordinates and mesh
+ * quantities are modified without changing the mesh connectivity
+ * (such as with ALE).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_update_geometry(void)
+{
+  if (_particle_track_builder != NULL)
+    _update_cell_face_geom(_particle_track_builder);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
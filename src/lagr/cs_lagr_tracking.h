@@ -33,6 +33,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_timer.h"
+
 #include "cs_lagr_particle.h"
 
 /*----------------------------------------------------------------------------*/
@@ -47,6 +49,18 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*! Migration mode for particles changing rank */
+
+typedef enum {
+
+  CS_LAGR_MIGRATION_HALO,        /*!< point-to-point exchange with
+                                      neighboring ranks through the halo,
+                                      using an MPI datatype */
+  CS_LAGR_MIGRATION_ALL_TO_ALL   /*!< sparse exchange of packed particles
+                                      using \ref cs_all_to_all */
+
+} cs_lagr_migration_mode_t;
+
 /*=============================================================================
  * Global variables
  *============================================================================*/
@@ -75,6 +89,86 @@ cs_lagr_tracking_initialize(void);
 void
 cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the migration mode for particles changing rank.
+ *
+ * With \ref CS_LAGR_MIGRATION_ALL_TO_ALL, particles reaching a ghost cell
+ * are packed and sent to the rank owning that cell in a single sparse
+ * exchange (see \ref cs_all_to_all_set_type for the algorithm used).
+ * A global check precedes the exchange, so that propagation loops in
+ * which no particle changes rank require a single reduction.
+ *
+ * In both modes, particles crossing several partitions during a time step
+ * are still tracked in successive passes, as each rank can only track
+ * particles through its own cells.
+ *
+ * \param[in]  mode  migration mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_migration_mode(cs_lagr_migration_mode_t  mode);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the migration mode for particles changing rank.
+ *
+ * \return  migration mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_migration_mode_t
+cs_lagr_tracking_get_migration_mode(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the accumulated time spent synchronizing the particle set
+ *        between local propagation stages.
+ *
+ * This includes the removal of particles which left the domain and the
+ * migration of particles changing rank.
+ *
+ * \return  associated time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_timer_counter_t
+cs_lagr_tracking_get_sync_timer(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether cached face geometry is used for particle tracking.
+ *
+ * By default, face centers, normals and vertex coordinates are packed
+ * in cell -> face order when the tracking structures are built, so that
+ * finding the exit face of a particle from a cell only requires access
+ * to contiguous data. This requires additional memory (about twice the
+ * size of the face -> vertex connectivity, in coordinates), so this cache
+ * may be disabled. Tracking results are the same in both cases.
+ *
+ * This setting is applied when the tracking structures are next built.
+ *
+ * \param[in]  use_cache  true to use cached geometry, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_geometry_cache(bool  use_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update cached tracking geometry after mesh deformation.
+ *
+ * This function should be called when vertex coordinates and mesh
+ * quantities are modified without changing the mesh connectivity
+ * (such as with ALE).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_update_geometry(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
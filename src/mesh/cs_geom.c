@@ -129,94 +129,44 @@ _test_edge(const cs_real_t  sx0[3],
   return (cs_math_3_dot_product(disp, p) > 0 ? 1 : -1);
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions
- *===========================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief find the closest point of a set to a given point in space.
- *
- * If the orient parameter is set to -1 or 1, intersection is only
- * considered when (sx1-sx0).normal.orient > 0.
- * If set to 0, intersection is considered in both cases.
- *
- * \param[in]   n_points      number of points
- * \param[in]   point_coords  point coordinates
- * \param[in]   query_coords  coordinates searched for
- * \param[out]  point_id      id of closest point if on the same rank,
- *                            -1 otherwise
- * \param[out]  rank_id       id of rank containing closest point
- */
-/*----------------------------------------------------------------------------*/
-
-void
-cs_geom_closest_point(cs_lnum_t         n_points,
-                      const cs_real_t   point_coords[][3],
-                      const cs_real_t   query_coords[3],
-                      cs_lnum_t        *point_id,
-                      int              *rank_id)
-{
-  cs_lnum_t id_min = -1;
-  cs_real_t d2_min = HUGE_VAL;
-
-  for (cs_lnum_t i = 0; i < n_points; i++) {
-    cs_real_t d2 = cs_math_3_square_distance(point_coords[i], query_coords);
-    if (d2 < d2_min) {
-      d2_min = d2;
-      id_min = i;
-    }
-  }
-
-  *rank_id = cs_glob_rank_id;
-
-  cs_parall_min_id_rank_r(&id_min, rank_id, d2_min);
-
-  if (*rank_id != cs_glob_rank_id)
-    *point_id = -1;
-  else
-    *point_id = id_min;
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Test if a line segment intersects a face.
+/*----------------------------------------------------------------------------
+ * Test if a line segment intersects a face.
  *
- * If the orient parameter is set to -1 or 1, intersection is only
- * considered when (sx1-sx0).normal.orient > 0.
- * If set to 0, intersection is considered in both cases.
+ * Face vertices are either given by their ids in a global coordinates
+ * array, or packed in face order, with associated edge orientations.
  *
- * \param[in]   orient         if -1 or 1, multiplies face_normal to check
- *                             for segment
- * \param[in]   n_vertices     number of face vertices
- * \param[in]   vertex_ids     ids of face vertices
- * \param[in]   vertex_coords  vertex coordinates
- * \param[in]   face_center    coordinates of face center
- * \param[in]   face_normal    face normal vector
- * \param[in]   sx0            segment start coordinates
- * \param[in]   sx1            segment end coordinates
- * \param[out]  n_crossings    number sub_face crossings
- *                             [0: in; 1: out]
+ * parameters:
+ *   orient        <-- if -1 or 1, multiplies face_normal to check
+ *                     for segment
+ *   n_vertices    <-- number of face vertices
+ *   vertex_ids    <-- ids of face vertices, or NULL if packed
+ *   vertex_coords <-- vertex coordinates
+ *   edge_orient   <-- if vertex_ids is NULL, orientation of edge i
+ *                     (1 if the id of vertex i is smaller than that of
+ *                     vertex i+1, -1 otherwise)
+ *   face_center   <-- coordinates of face center
+ *   face_normal   <-- face normal vector
+ *   sx0           <-- segment start coordinates
+ *   sx1           <-- segment end coordinates
+ *   n_crossings   --> number sub_face crossings [0: in; 1: out]
  *
- * \return
+ * returns:
  *   2 if the segment does not go through the face's plane, or minimum
  *   relative distance (in terms of barycentric coordinates)
  *   of intersection point to face.
- */
-/*----------------------------------------------------------------------------*/
+ *----------------------------------------------------------------------------*/
 
-double
-cs_geom_segment_intersect_face(int              orient,
-                               cs_lnum_t        n_vertices,
-                               const cs_lnum_t  vertex_ids[],
-                               const cs_real_t  vertex_coords[][3],
-                               const cs_real_t  face_center[3],
-                               const cs_real_t  face_normal[3],
-                               const cs_real_t  sx0[3],
-                               const cs_real_t  sx1[3],
-                               int              n_crossings[2])
+static inline double
+_segment_intersect_face(int                orient,
+                        cs_lnum_t          n_vertices,
+                        const cs_lnum_t    vertex_ids[],
+                        const cs_real_t    vertex_coords[][3],
+                        const signed char  edge_orient[],
+                        const cs_real_t    face_center[3],
+                        const cs_real_t    face_normal[3],
+                        const cs_real_t    sx0[3],
+                        const cs_real_t    sx1[3],
+                        int                n_crossings[2])
 {
   const double epsilon = 1.e-15;
 
@@ -264,8 +214,8 @@ cs_geom_segment_intersect_face(int              orient,
   int pi, pip1, p0;
 
   /* 1st vertex: vector e0, p0 = e0 ^ vgo  */
-  cs_lnum_t vtx_id_0 = vertex_ids[0];
-  const cs_real_t *vtx_0 = vertex_coords[vtx_id_0];
+  const cs_real_t *vtx_0
+    = (vertex_ids != NULL) ? vertex_coords[vertex_ids[0]] : vertex_coords[0];
 
   p0 = _test_edge(sx0, sx1, face_center, vtx_0);
   pi = p0;
@@ -274,11 +224,24 @@ cs_geom_segment_intersect_face(int              orient,
   /* Loop on vertices of the face */
   for (cs_lnum_t i = 0; i < n_vertices; i++) {
 
-    vtx_id_0 = vertex_ids[i];
-    cs_lnum_t vtx_id_1 = vertex_ids[(i+1)%n_vertices];
+    const cs_real_t *vtx_1;
 
-    vtx_0 = vertex_coords[vtx_id_0];
-    const cs_real_t *vtx_1 = vertex_coords[vtx_id_1];
+    /* Check the orientation of the edge (based on vertex ids, so that
+       it is the same for all faces sharing that edge) */
+    int reorient_edge;
+
+    if (vertex_ids != NULL) {
+      cs_lnum_t vtx_id_0 = vertex_ids[i];
+      cs_lnum_t vtx_id_1 = vertex_ids[(i+1)%n_vertices];
+      vtx_0 = vertex_coords[vtx_id_0];
+      vtx_1 = vertex_coords[vtx_id_1];
+      reorient_edge = (vtx_id_0 < vtx_id_1 ? 1 : -1);
+    }
+    else {
+      vtx_0 = vertex_coords[i];
+      vtx_1 = vertex_coords[(i+1)%n_vertices];
+      reorient_edge = edge_orient[i];
+    }
     for (int j = 0; j < 3; j++) {
       e0[j] = vtx_0[j] - face_center[j];
       e1[j] = vtx_1[j] - face_center[j];
@@ -316,19 +279,13 @@ cs_geom_segment_intersect_face(int              orient,
 
     /* 3rd edge: vector e_out */
 
-    /* Check the orientation of the edge */
-    int reorient_edge = (vtx_id_0 < vtx_id_1 ? 1 : -1);
-
     /* Sort the vertices of the edges so that it is easier to find it after */
-    cs_lnum_2_t edge_id = {vtx_id_0, vtx_id_1};
     if (reorient_edge == -1) {
-      edge_id[0] = vtx_id_1;
-      edge_id[1] = vtx_id_0;
+      const cs_real_t *vtx_s = vtx_0;
+      vtx_0 = vtx_1;
+      vtx_1 = vtx_s;
     }
 
-    vtx_0 = vertex_coords[edge_id[0]];
-    vtx_1 = vertex_coords[edge_id[1]];
-
     int w_sign = _test_edge(sx0, sx1, vtx_0, vtx_1)
                  * reorient_edge * sign_det;
 
@@ -412,6 +369,159 @@ cs_geom_segment_intersect_face(int              orient,
   return retval;
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *===========================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief find the closest point of a set to a given point in space.
+ *
+ * If the orient parameter is set to -1 or 1, intersection is only
+ * considered when (sx1-sx0).normal.orient > 0.
+ * If set to 0, intersection is considered in both cases.
+ *
+ * \param[in]   n_points      number of points
+ * \param[in]   point_coords  point coordinates
+ * \param[in]   query_coords  coordinates searched for
+ * \param[out]  point_id      id of closest point if on the same rank,
+ *                            -1 otherwise
+ * \param[out]  rank_id       id of rank containing closest point
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_geom_closest_point(cs_lnum_t         n_points,
+                      const cs_real_t   point_coords[][3],
+                      const cs_real_t   query_coords[3],
+                      cs_lnum_t        *point_id,
+                      int              *rank_id)
+{
+  cs_lnum_t id_min = -1;
+  cs_real_t d2_min = HUGE_VAL;
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    cs_real_t d2 = cs_math_3_square_distance(point_coords[i], query_coords);
+    if (d2 < d2_min) {
+      d2_min = d2;
+      id_min = i;
+    }
+  }
+
+  *rank_id = cs_glob_rank_id;
+
+  cs_parall_min_id_rank_r(&id_min, rank_id, d2_min);
+
+  if (*rank_id != cs_glob_rank_id)
+    *point_id = -1;
+  else
+    *point_id = id_min;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a line segment intersects a face.
+ *
+ * If the orient parameter is set to -1 or 1, intersection is only
+ * considered when (sx1-sx0).normal.orient > 0.
+ * If set to 0, intersection is considered in both cases.
+ *
+ * \param[in]   orient         if -1 or 1, multiplies face_normal to check
+ *                             for segment
+ * \param[in]   n_vertices     number of face vertices
+ * \param[in]   vertex_ids     ids of face vertices
+ * \param[in]   vertex_coords  vertex coordinates
+ * \param[in]   face_center    coordinates of face center
+ * \param[in]   face_normal    face normal vector
+ * \param[in]   sx0            segment start coordinates
+ * \param[in]   sx1            segment end coordinates
+ * \param[out]  n_crossings    number sub_face crossings
+ *                             [0: in; 1: out]
+ *
+ * \return
+ *   2 if the segment does not go through the face's plane, or minimum
+ *   relative distance (in terms of barycentric coordinates)
+ *   of intersection point to face.
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_geom_segment_intersect_face(int              orient,
+                               cs_lnum_t        n_vertices,
+                               const cs_lnum_t  vertex_ids[],
+                               const cs_real_t  vertex_coords[][3],
+                               const cs_real_t  face_center[3],
+                               const cs_real_t  face_normal[3],
+                               const cs_real_t  sx0[3],
+                               const cs_real_t  sx1[3],
+                               int              n_crossings[2])
+{
+  return _segment_intersect_face(orient,
+                                 n_vertices,
+                                 vertex_ids,
+                                 vertex_coords,
+                                 NULL,
+                                 face_center,
+                                 face_normal,
+                                 sx0,
+                                 sx1,
+                                 n_crossings);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a line segment intersects a face whose vertex coordinates
+ *        are packed in face order.
+ *
+ * This variant of \ref cs_geom_segment_intersect_face is intended for
+ * cached face geometry; given edge orientations matching those based
+ * on the global vertex ids, it returns the same results.
+ *
+ * \param[in]   orient         if -1 or 1, multiplies face_normal to check
+ *                             for segment
+ * \param[in]   n_vertices     number of face vertices
+ * \param[in]   vertex_coords  coordinates of face vertices, in face order
+ * \param[in]   edge_orient    orientation of edge i: 1 if the id of vertex i
+ *                             is smaller than that of vertex i+1, -1 otherwise
+ * \param[in]   face_center    coordinates of face center
+ * \param[in]   face_normal    face normal vector
+ * \param[in]   sx0            segment start coordinates
+ * \param[in]   sx1            segment end coordinates
+ * \param[out]  n_crossings    number sub_face crossings
+ *                             [0: in; 1: out]
+ *
+ * \return
+ *   2 if the segment does not go through the face's plane, or minimum
+ *   relative distance (in terms of barycentric coordinates)
+ *   of intersection point to face.
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_geom_segment_intersect_packed_face(int                orient,
+                                      cs_lnum_t          n_vertices,
+                                      const cs_real_t    vertex_coords[][3],
+                                      const signed char  edge_orient[],
+                                      const cs_real_t    face_center[3],
+                                      const cs_real_t    face_normal[3],
+                                      const cs_real_t    sx0[3],
+                                      const cs_real_t    sx1[3],
+                                      int                n_crossings[2])
+{
+  return _segment_intersect_face(orient,
+                                 n_vertices,
+                                 NULL,
+                                 vertex_coords,
+                                 edge_orient,
+                                 face_center,
+                                 face_normal,
+                                 sx0,
+                                 sx1,
+                                 n_crossings);
+}
+
 /*---------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -115,6 +115,46 @@ cs_geom_segment_intersect_face(int              orient,
                                const cs_real_t  sx1[3],
                                int              n_crossings[2]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a line segment intersects a face whose vertex coordinates
+ *        are packed in face order.
+ *
+ * This variant of \ref cs_geom_segment_intersect_face is intended for
+ * cached face geometry; given edge orientations matching those based
+ * on the global vertex ids, it returns the same results.
+ *
+ * \param[in]   orient         if -1 or 1, multiplies face_normal to check
+ *                             for segment
+ * \param[in]   n_vertices     number of face vertices
+ * \param[in]   vertex_coords  coordinates of face vertices, in face order
+ * \param[in]   edge_orient    orientation of edge i: 1 if the id of vertex i
+ *                             is smaller than that of vertex i+1, -1 otherwise
+ * \param[in]   face_center    coordinates of face center
+ * \param[in]   face_normal    face normal vector
+ * \param[in]   sx0            segment start coordinates
+ * \param[in]   sx1            segment end coordinates
+ * \param[out]  n_crossings    number sub_face crossings
+ *                             [0: in; 1: out]
+ *
+ * \return
+ *   2 if the segment does not go through the face's plane, or minimum
+ *   relative distance (in terms of barycentric coordinates)
+ *   of intersection point to face.
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_geom_segment_intersect_packed_face(int                orient,
+                                      cs_lnum_t          n_vertices,
+                                      const cs_real_t    vertex_coords[][3],
+                                      const signed char  edge_orient[],
+                                      const cs_real_t    face_center[3],
+                                      const cs_real_t    face_normal[3],
+                                      const cs_real_t    sx0[3],
+                                      const cs_real_t    sx1[3],
+                                      int                n_crossings[2]);
+
 /*---------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -0,0 +1,1399 @@
+/*============================================================================
+ * Built-in multilevel graph partitioner.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_search.h"
+#include "cs_sort.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_graph_partition.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Maximum number of coarsening levels (distributed and serial) */
+
+#define _MAX_LEVELS  64
+
+/* Target number of vertices per part for the coarsest serial graph,
+   and for the coarsest distributed graph (prior to gathering) */
+
+#define _SERIAL_VTX_PER_PART   30
+#define _GATHER_VTX_PER_PART  100
+
+/* Minimum size of gathered graph */
+
+#define _GATHER_MIN_VTX     10000
+
+/* Allowed load imbalance and number of refinement passes per level */
+
+#define _IMBALANCE_TOL       1.05
+#define _N_REFINE_PASSES     8
+
+/*============================================================================
+ * Local Type definitions
+ *============================================================================*/
+
+/* Graph level structure.
+   Adjacency ids are local vertex ids if < n_vtx,
+   and n_vtx + ghost vertex id otherwise */
+
+typedef struct {
+
+  cs_lnum_t     n_vtx;        /* Number of local vertices */
+  cs_lnum_t     n_ghosts;     /* Number of distant adjacent vertices */
+  cs_gnum_t     g_start;      /* Global id of first local vertex */
+  cs_gnum_t     n_g_vtx;      /* Global number of vertices */
+
+  cs_lnum_t    *adj_idx;      /* Adjacency index (size: n_vtx + 1) */
+  cs_lnum_t    *adj;          /* Adjacent vertex ids */
+  cs_lnum_t    *adj_wgt;      /* Edge weights */
+  double       *vtx_wgt;      /* Vertex weights */
+
+  cs_gnum_t    *ghost_g_id;   /* Ordered global ids of ghost vertices */
+  cs_lnum_t    *coarse_id;    /* Vertex id in next coarser graph, or NULL */
+
+#if defined(HAVE_MPI)
+  MPI_Comm          comm;        /* Associated communicator, or
+                                    MPI_COMM_NULL for a local graph */
+  int               n_ranks;     /* Number of ranks in communicator */
+  cs_all_to_all_t  *d;           /* Ghost value request distributor */
+  cs_lnum_t         n_requests;  /* Number of local values requested
+                                    by other ranks */
+  cs_lnum_t        *request_id;  /* Local ids of requested values */
+#endif
+
+} _graph_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute global id of first local element and global number of elements.
+ *
+ * parameters:
+ *   n_elts   <-- local number of elements
+ *   comm     <-- associated communicator, or MPI_COMM_NULL
+ *   g_start  --> global id of first local element
+ *   n_g_elts --> global number of elements
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_global_range(cs_lnum_t    n_elts,
+              MPI_Comm     comm,
+              cs_gnum_t   *g_start,
+              cs_gnum_t   *n_g_elts)
+{
+  cs_gnum_t _n_elts = n_elts;
+
+  *g_start = 0;
+  *n_g_elts = _n_elts;
+
+  if (comm != MPI_COMM_NULL) {
+    cs_gnum_t _g_end = 0;
+    MPI_Scan(&_n_elts, &_g_end, 1, CS_MPI_GNUM, MPI_SUM, comm);
+    *g_start = _g_end - _n_elts;
+    MPI_Allreduce(&_n_elts, n_g_elts, 1, CS_MPI_GNUM, MPI_SUM, comm);
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Initialize exchange of ghost vertex values for a distributed graph.
+ *
+ * parameters:
+ *   g <-> pointer to graph structure
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_graph_ghosts_init(_graph_t  *g)
+{
+  cs_gnum_t _n_vtx = g->n_vtx;
+  cs_gnum_t *rank_start = NULL;
+  int *dest_rank = NULL;
+
+  /* Ranges are contiguous and ordered by rank, so the owner of a given
+     global id is the last rank whose range starts before that id */
+
+  BFT_MALLOC(rank_start, g->n_ranks + 1, cs_gnum_t);
+
+  MPI_Allgather(&(g->g_start), 1, CS_MPI_GNUM, rank_start, 1, CS_MPI_GNUM,
+                g->comm);
+  MPI_Allreduce(&_n_vtx, rank_start + g->n_ranks, 1, CS_MPI_GNUM, MPI_SUM,
+                g->comm);
+
+  BFT_MALLOC(dest_rank, g->n_ghosts, int);
+
+  for (cs_lnum_t i = 0; i < g->n_ghosts; i++) {
+    int start_id = 0, end_id = g->n_ranks;
+    while (end_id - start_id > 1) {
+      int mid_id = (start_id + end_id) / 2;
+      if (rank_start[mid_id] <= g->ghost_g_id[i])
+        start_id = mid_id;
+      else
+        end_id = mid_id;
+    }
+    dest_rank[i] = start_id;
+  }
+
+  BFT_FREE(rank_start);
+
+  g->d = cs_all_to_all_create(g->n_ghosts,
+                              0, /* flags */
+                              NULL,
+                              dest_rank,
+                              g->comm);
+
+  cs_all_to_all_transfer_dest_rank(g->d, &dest_rank);
+
+  cs_gnum_t *recv_g_id = cs_all_to_all_copy_array(g->d,
+                                                  CS_GNUM_TYPE,
+                                                  1,
+                                                  false, /* reverse */
+                                                  g->ghost_g_id,
+                                                  NULL);
+
+  g->n_requests = cs_all_to_all_n_elts_dest(g->d);
+
+  BFT_MALLOC(g->request_id, g->n_requests, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < g->n_requests; i++) {
+    assert(recv_g_id[i] >= g->g_start);
+    g->request_id[i] = recv_g_id[i] - g->g_start;
+  }
+
+  BFT_FREE(recv_g_id);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Update ghost vertex values of a distributed graph.
+ *
+ * parameters:
+ *   g        <-- pointer to graph structure
+ *   datatype <-- associated data type
+ *   val      <-> values (size: n_vtx + n_ghosts); ghost values are updated
+ *----------------------------------------------------------------------------*/
+
+static void
+_ghost_sync(const _graph_t  *g,
+            cs_datatype_t    datatype,
+            void            *val)
+{
+#if defined(HAVE_MPI)
+
+  if (g->comm == MPI_COMM_NULL)
+    return;
+
+  size_t elt_size = cs_datatype_size[datatype];
+
+  unsigned char *_val = val;
+  unsigned char *send_val = NULL;
+
+  BFT_MALLOC(send_val, g->n_requests*elt_size, unsigned char);
+
+  for (cs_lnum_t i = 0; i < g->n_requests; i++)
+    memcpy(send_val + i*elt_size,
+           _val + (size_t)(g->request_id[i])*elt_size,
+           elt_size);
+
+  cs_all_to_all_copy_array(g->d,
+                           datatype,
+                           1,
+                           true, /* reverse */
+                           send_val,
+                           _val + (size_t)(g->n_vtx)*elt_size);
+
+  BFT_FREE(send_val);
+
+#else
+
+  CS_UNUSED(g);
+  CS_UNUSED(datatype);
+  CS_UNUSED(val);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Create a graph level structure.
+ *
+ * Duplicate edges are merged (summing their weights), and self-loops
+ * are removed.
+ *
+ * parameters:
+ *   n_vtx    <-- number of local vertices
+ *   g_start  <-- global id of first local vertex
+ *   n_g_vtx  <-- global number of vertices
+ *   adj_idx  <-- vertex -> adjacent vertices index
+ *   adj      <-- adjacent vertex global ids
+ *   adj_wgt  <-- edge weights, or NULL for unit weights
+ *   vtx_wgt  <-- vertex weights, or NULL for unit weights
+ *   comm     <-- associated communicator, or MPI_COMM_NULL
+ *
+ * returns:
+ *   pointer to new graph structure
+ *----------------------------------------------------------------------------*/
+
+static _graph_t *
+_graph_create(cs_lnum_t         n_vtx,
+              cs_gnum_t         g_start,
+              cs_gnum_t         n_g_vtx,
+              const cs_lnum_t   adj_idx[],
+              const cs_gnum_t   adj[],
+              const cs_lnum_t   adj_wgt[],
+              const double      vtx_wgt[]
+#if defined(HAVE_MPI)
+              , MPI_Comm        comm
+#endif
+              )
+{
+  _graph_t  *g = NULL;
+
+  BFT_MALLOC(g, 1, _graph_t);
+
+  g->n_vtx = n_vtx;
+  g->g_start = g_start;
+  g->n_g_vtx = n_g_vtx;
+  g->coarse_id = NULL;
+
+  const cs_gnum_t g_end = g_start + n_vtx;
+  const cs_lnum_t n_adj = adj_idx[n_vtx];
+
+  /* Ghost vertices */
+
+  cs_lnum_t n_ext = 0;
+
+  BFT_MALLOC(g->ghost_g_id, n_adj, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_adj; i++) {
+    if (adj[i] < g_start || adj[i] >= g_end)
+      g->ghost_g_id[n_ext++] = adj[i];
+  }
+
+  g->n_ghosts = cs_sort_and_compact_gnum(n_ext, g->ghost_g_id);
+  BFT_REALLOC(g->ghost_g_id, g->n_ghosts, cs_gnum_t);
+
+  /* Adjacency, merging duplicates */
+
+  cs_lnum_t *adj_pos = NULL;
+  BFT_MALLOC(adj_pos, n_vtx + g->n_ghosts, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_vtx + g->n_ghosts; i++)
+    adj_pos[i] = -1;
+
+  BFT_MALLOC(g->adj_idx, n_vtx + 1, cs_lnum_t);
+  BFT_MALLOC(g->adj, n_adj, cs_lnum_t);
+  BFT_MALLOC(g->adj_wgt, n_adj, cs_lnum_t);
+
+  cs_lnum_t k = 0;
+  g->adj_idx[0] = 0;
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    const cs_lnum_t s_id = k;
+    for (cs_lnum_t j = adj_idx[i]; j < adj_idx[i+1]; j++) {
+      cs_lnum_t v_id;
+      if (adj[j] >= g_start && adj[j] < g_end) {
+        v_id = adj[j] - g_start;
+        if (v_id == i)
+          continue;
+      }
+      else
+        v_id = n_vtx + cs_search_g_binary(g->n_ghosts, adj[j], g->ghost_g_id);
+      cs_lnum_t w = (adj_wgt != NULL) ? adj_wgt[j] : 1;
+      if (adj_pos[v_id] >= s_id)
+        g->adj_wgt[adj_pos[v_id]] += w;
+      else {
+        adj_pos[v_id] = k;
+        g->adj[k] = v_id;
+        g->adj_wgt[k] = w;
+        k++;
+      }
+    }
+    g->adj_idx[i+1] = k;
+  }
+
+  BFT_FREE(adj_pos);
+
+  BFT_REALLOC(g->adj, k, cs_lnum_t);
+  BFT_REALLOC(g->adj_wgt, k, cs_lnum_t);
+
+  /* Vertex weights */
+
+  BFT_MALLOC(g->vtx_wgt, n_vtx, double);
+
+  if (vtx_wgt != NULL)
+    memcpy(g->vtx_wgt, vtx_wgt, n_vtx*sizeof(double));
+  else {
+    for (cs_lnum_t i = 0; i < n_vtx; i++)
+      g->vtx_wgt[i] = 1.;
+  }
+
+  /* Ghost values exchange */
+
+#if defined(HAVE_MPI)
+
+  g->comm = comm;
+  g->n_ranks = 1;
+  g->d = NULL;
+  g->n_requests = 0;
+  g->request_id = NULL;
+
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_size(comm, &(g->n_ranks));
+    _graph_ghosts_init(g);
+  }
+
+#endif
+
+  return g;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a graph level structure.
+ *
+ * parameters:
+ *   g <-> pointer to graph structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_graph_destroy(_graph_t  **g)
+{
+  _graph_t *_g = *g;
+
+  if (_g == NULL)
+    return;
+
+#if defined(HAVE_MPI)
+  if (_g->d != NULL)
+    cs_all_to_all_destroy(&(_g->d));
+  BFT_FREE(_g->request_id);
+#endif
+
+  BFT_FREE(_g->coarse_id);
+  BFT_FREE(_g->ghost_g_id);
+  BFT_FREE(_g->vtx_wgt);
+  BFT_FREE(_g->adj_wgt);
+  BFT_FREE(_g->adj);
+  BFT_FREE(_g->adj_idx);
+
+  BFT_FREE(*g);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the communicator associated with a graph.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static inline MPI_Comm
+_graph_comm(const _graph_t  *g)
+{
+  return g->comm;
+}
+
+#endif
+
+/*----------------------------------------------------------------------------
+ * Sum a double array over a graph's communicator.
+ *
+ * parameters:
+ *   g   <-- pointer to graph structure
+ *   n   <-- array size
+ *   val <-> values to sum
+ *----------------------------------------------------------------------------*/
+
+static void
+_graph_sum(const _graph_t  *g,
+           int              n,
+           double           val[])
+{
+#if defined(HAVE_MPI)
+  if (g->comm != MPI_COMM_NULL)
+    MPI_Allreduce(MPI_IN_PLACE, val, n, MPI_DOUBLE, MPI_SUM, g->comm);
+#else
+  CS_UNUSED(g);
+  CS_UNUSED(n);
+  CS_UNUSED(val);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Coarsen a graph using heavy edge matching.
+ *
+ * Only local vertices are matched, so the coarsening does not require
+ * any communication other than that of coarse ids of ghost vertices.
+ *
+ * parameters:
+ *   g        <-> pointer to graph structure (coarse_id is defined here)
+ *   max_wgt  <-- maximum weight of a coarse vertex
+ *   seed     <-- seed for vertex visit order
+ *
+ * returns:
+ *   pointer to coarse graph
+ *----------------------------------------------------------------------------*/
+
+static _graph_t *
+_coarsen(_graph_t  *g,
+         double     max_wgt,
+         unsigned   seed)
+{
+  const cs_lnum_t n_vtx = g->n_vtx;
+
+  cs_lnum_t *order = NULL;
+
+  BFT_MALLOC(g->coarse_id, n_vtx, cs_lnum_t);
+  BFT_MALLOC(order, n_vtx, cs_lnum_t);
+
+  /* Visit vertices in pseudo-random order (linear congruential generator,
+     enough for this purpose and reproducible) */
+
+  unsigned r = seed;
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    g->coarse_id[i] = -1;
+    order[i] = i;
+  }
+
+  for (cs_lnum_t i = n_vtx - 1; i > 0; i--) {
+    r = r*1103515245u + 12345u;
+    cs_lnum_t j = (r >> 8) % (unsigned)(i + 1);
+    cs_lnum_t tmp = order[i];
+    order[i] = order[j];
+    order[j] = tmp;
+  }
+
+  /* Heavy edge matching */
+
+  cs_lnum_t n_c_vtx = 0;
+
+  for (cs_lnum_t k = 0; k < n_vtx; k++) {
+
+    cs_lnum_t i = order[k];
+
+    if (g->coarse_id[i] > -1)
+      continue;
+
+    cs_lnum_t m_id = -1;
+    cs_lnum_t m_wgt = 0;
+
+    for (cs_lnum_t j = g->adj_idx[i]; j < g->adj_idx[i+1]; j++) {
+      cs_lnum_t v_id = g->adj[j];
+      if (v_id >= n_vtx || g->coarse_id[v_id] > -1)
+        continue;
+      if (g->vtx_wgt[i] + g->vtx_wgt[v_id] > max_wgt)
+        continue;
+      if (g->adj_wgt[j] > m_wgt) {
+        m_id = v_id;
+        m_wgt = g->adj_wgt[j];
+      }
+    }
+
+    g->coarse_id[i] = n_c_vtx;
+    if (m_id > -1)
+      g->coarse_id[m_id] = n_c_vtx;
+    n_c_vtx++;
+  }
+
+  BFT_FREE(order);
+
+  /* Global coarse ids, including those of ghost vertices */
+
+  cs_gnum_t c_start = 0, n_g_c_vtx = n_c_vtx;
+
+#if defined(HAVE_MPI)
+  _global_range(n_c_vtx, _graph_comm(g), &c_start, &n_g_c_vtx);
+#endif
+
+  cs_gnum_t *c_g_id = NULL;
+  BFT_MALLOC(c_g_id, n_vtx + g->n_ghosts, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++)
+    c_g_id[i] = c_start + g->coarse_id[i];
+
+  _ghost_sync(g, CS_GNUM_TYPE, c_g_id);
+
+  /* Coarse vertex -> fine vertices index */
+
+  cs_lnum_t *c_f_idx = NULL, *c_f = NULL;
+
+  BFT_MALLOC(c_f_idx, n_c_vtx + 1, cs_lnum_t);
+  BFT_MALLOC(c_f, n_vtx, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_c_vtx + 1; i++)
+    c_f_idx[i] = 0;
+  for (cs_lnum_t i = 0; i < n_vtx; i++)
+    c_f_idx[g->coarse_id[i] + 1] += 1;
+  for (cs_lnum_t i = 0; i < n_c_vtx; i++)
+    c_f_idx[i+1] += c_f_idx[i];
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    cs_lnum_t c_id = g->coarse_id[i];
+    c_f[c_f_idx[c_id]] = i;
+    c_f_idx[c_id] += 1;
+  }
+  for (cs_lnum_t i = n_c_vtx; i > 0; i--)
+    c_f_idx[i] = c_f_idx[i-1];
+  c_f_idx[0] = 0;
+
+  /* Coarse adjacency (duplicates are merged on graph creation) */
+
+  cs_lnum_t *c_adj_idx = NULL, *c_adj_wgt = NULL;
+  cs_gnum_t *c_adj = NULL;
+  double *c_vtx_wgt = NULL;
+
+  BFT_MALLOC(c_adj_idx, n_c_vtx + 1, cs_lnum_t);
+  BFT_MALLOC(c_adj, g->adj_idx[n_vtx], cs_gnum_t);
+  BFT_MALLOC(c_adj_wgt, g->adj_idx[n_vtx], cs_lnum_t);
+  BFT_MALLOC(c_vtx_wgt, n_c_vtx, double);
+
+  cs_lnum_t k = 0;
+  c_adj_idx[0] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_c_vtx; c_id++) {
+    c_vtx_wgt[c_id] = 0;
+    for (cs_lnum_t l = c_f_idx[c_id]; l < c_f_idx[c_id+1]; l++) {
+      cs_lnum_t i = c_f[l];
+      c_vtx_wgt[c_id] += g->vtx_wgt[i];
+      for (cs_lnum_t j = g->adj_idx[i]; j < g->adj_idx[i+1]; j++) {
+        c_adj[k] = c_g_id[g->adj[j]];
+        c_adj_wgt[k] = g->adj_wgt[j];
+        k++;
+      }
+    }
+    c_adj_idx[c_id + 1] = k;
+  }
+
+  BFT_FREE(c_f);
+  BFT_FREE(c_f_idx);
+  BFT_FREE(c_g_id);
+
+  _graph_t *c = _graph_create(n_c_vtx,
+                              c_start,
+                              n_g_c_vtx,
+                              c_adj_idx,
+                              c_adj,
+                              c_adj_wgt,
+                              c_vtx_wgt
+#if defined(HAVE_MPI)
+                              , _graph_comm(g)
+#endif
+                              );
+
+  BFT_FREE(c_vtx_wgt);
+  BFT_FREE(c_adj_wgt);
+  BFT_FREE(c_adj);
+  BFT_FREE(c_adj_idx);
+
+  return c;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Gather a distributed graph on rank 0.
+ *
+ * parameters:
+ *   g <-- pointer to distributed graph structure
+ *
+ * returns:
+ *   pointer to local graph structure on rank 0, NULL on other ranks
+ *----------------------------------------------------------------------------*/
+
+static _graph_t *
+_graph_gather(const _graph_t  *g)
+{
+  _graph_t *s = NULL;
+
+  int rank_id, n_ranks;
+  MPI_Comm_rank(g->comm, &rank_id);
+  n_ranks = g->n_ranks;
+
+  const cs_lnum_t n_vtx = g->n_vtx;
+  const cs_lnum_t n_adj = g->adj_idx[n_vtx];
+
+  /* Local arrays, with global adjacency ids */
+
+  cs_lnum_t *degree = NULL;
+  cs_gnum_t *adj_g_id = NULL;
+
+  BFT_MALLOC(degree, n_vtx, cs_lnum_t);
+  BFT_MALLOC(adj_g_id, n_adj, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++)
+    degree[i] = g->adj_idx[i+1] - g->adj_idx[i];
+
+  for (cs_lnum_t j = 0; j < n_adj; j++) {
+    cs_lnum_t v_id = g->adj[j];
+    if (v_id < n_vtx)
+      adj_g_id[j] = g->g_start + v_id;
+    else
+      adj_g_id[j] = g->ghost_g_id[v_id - n_vtx];
+  }
+
+  /* Gather counts */
+
+  int counts[2] = {n_vtx, n_adj};
+  int *r_counts = NULL, *r_vtx_count = NULL, *r_vtx_displ = NULL;
+  int *r_adj_count = NULL, *r_adj_displ = NULL;
+
+  if (rank_id == 0) {
+    BFT_MALLOC(r_counts, n_ranks*2, int);
+    BFT_MALLOC(r_vtx_count, n_ranks, int);
+    BFT_MALLOC(r_vtx_displ, n_ranks, int);
+    BFT_MALLOC(r_adj_count, n_ranks, int);
+    BFT_MALLOC(r_adj_displ, n_ranks, int);
+  }
+
+  MPI_Gather(counts, 2, MPI_INT, r_counts, 2, MPI_INT, 0, g->comm);
+
+  cs_lnum_t s_n_vtx = 0, s_n_adj = 0;
+  cs_lnum_t *s_adj_idx = NULL, *s_adj_wgt = NULL;
+  cs_gnum_t *s_adj = NULL;
+  double *s_vtx_wgt = NULL;
+
+  if (rank_id == 0) {
+    for (int i = 0; i < n_ranks; i++) {
+      r_vtx_count[i] = r_counts[i*2];
+      r_adj_count[i] = r_counts[i*2 + 1];
+      r_vtx_displ[i] = s_n_vtx;
+      r_adj_displ[i] = s_n_adj;
+      s_n_vtx += r_vtx_count[i];
+      s_n_adj += r_adj_count[i];
+    }
+    BFT_FREE(r_counts);
+    BFT_MALLOC(s_adj_idx, s_n_vtx + 1, cs_lnum_t);
+    BFT_MALLOC(s_adj, s_n_adj, cs_gnum_t);
+    BFT_MALLOC(s_adj_wgt, s_n_adj, cs_lnum_t);
+    BFT_MALLOC(s_vtx_wgt, s_n_vtx, double);
+  }
+
+  MPI_Gatherv(degree, n_vtx, CS_MPI_LNUM,
+              s_adj_idx, r_vtx_count, r_vtx_displ, CS_MPI_LNUM,
+              0, g->comm);
+  MPI_Gatherv(g->vtx_wgt, n_vtx, MPI_DOUBLE,
+              s_vtx_wgt, r_vtx_count, r_vtx_displ, MPI_DOUBLE,
+              0, g->comm);
+  MPI_Gatherv(adj_g_id, n_adj, CS_MPI_GNUM,
+              s_adj, r_adj_count, r_adj_displ, CS_MPI_GNUM,
+              0, g->comm);
+  MPI_Gatherv(g->adj_wgt, n_adj, CS_MPI_LNUM,
+              s_adj_wgt, r_adj_count, r_adj_displ, CS_MPI_LNUM,
+              0, g->comm);
+
+  BFT_FREE(adj_g_id);
+  BFT_FREE(degree);
+
+  if (rank_id == 0) {
+
+    BFT_FREE(r_adj_displ);
+    BFT_FREE(r_adj_count);
+    BFT_FREE(r_vtx_displ);
+    BFT_FREE(r_vtx_count);
+
+    /* Degrees to index */
+
+    for (cs_lnum_t i = s_n_vtx; i > 0; i--)
+      s_adj_idx[i] = s_adj_idx[i-1];
+    s_adj_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < s_n_vtx; i++)
+      s_adj_idx[i+1] += s_adj_idx[i];
+
+    s = _graph_create(s_n_vtx, 0, s_n_vtx,
+                      s_adj_idx, s_adj, s_adj_wgt, s_vtx_wgt,
+                      MPI_COMM_NULL);
+
+    BFT_FREE(s_vtx_wgt);
+    BFT_FREE(s_adj_wgt);
+    BFT_FREE(s_adj);
+    BFT_FREE(s_adj_idx);
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Scatter part ids of a graph gathered on rank 0.
+ *
+ * parameters:
+ *   g      <-- pointer to distributed graph structure
+ *   s_part <-- part ids of gathered graph on rank 0
+ *   part   --> part ids of distributed graph (size: n_vtx + n_ghosts)
+ *----------------------------------------------------------------------------*/
+
+static void
+_part_scatter(const _graph_t  *g,
+              const int        s_part[],
+              int              part[])
+{
+  int rank_id;
+  int n_vtx = g->n_vtx;
+  int *r_count = NULL, *r_displ = NULL;
+
+  MPI_Comm_rank(g->comm, &rank_id);
+
+  if (rank_id == 0) {
+    BFT_MALLOC(r_count, g->n_ranks, int);
+    BFT_MALLOC(r_displ, g->n_ranks, int);
+  }
+
+  MPI_Gather(&n_vtx, 1, MPI_INT, r_count, 1, MPI_INT, 0, g->comm);
+
+  if (rank_id == 0) {
+    r_displ[0] = 0;
+    for (int i = 1; i < g->n_ranks; i++)
+      r_displ[i] = r_displ[i-1] + r_count[i-1];
+  }
+
+  MPI_Scatterv(s_part, r_count, r_displ, MPI_INT,
+               part, n_vtx, MPI_INT, 0, g->comm);
+
+  BFT_FREE(r_displ);
+  BFT_FREE(r_count);
+
+  _ghost_sync(g, CS_INT_TYPE, part);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Bisect a subset of a local graph's vertices by graph growing, and
+ * recursively bisect each half until the requested number of parts
+ * is reached.
+ *
+ * Vertices outside the subset must not have a part id in
+ * [part_start, part_start + n_sub_parts[.
+ *
+ * parameters:
+ *   g           <-- pointer to local graph structure
+ *   n_sub       <-- number of vertices in subset
+ *   sub         <-> subset vertex ids (reordered)
+ *   part_start  <-- first part id for this subset
+ *   n_sub_parts <-- number of parts for this subset
+ *   queue       <-> work array for breadth-first traversals
+ *   tag         <-> last traversal id for each vertex
+ *   n_tags      <-> number of traversals
+ *   part        <-> part id of each vertex
+ *----------------------------------------------------------------------------*/
+
+static void
+_bisect(const _graph_t  *g,
+        cs_lnum_t        n_sub,
+        cs_lnum_t        sub[],
+        int              part_start,
+        int              n_sub_parts,
+        cs_lnum_t        queue[],
+        cs_lnum_t        tag[],
+        cs_lnum_t       *n_tags,
+        int              part[])
+{
+  if (n_sub_parts < 2 || n_sub < 1) {
+    for (cs_lnum_t i = 0; i < n_sub; i++)
+      part[sub[i]] = part_start;
+    return;
+  }
+
+  const int n_l_parts = n_sub_parts / 2;
+  const int l_part = part_start, r_part = part_start + n_l_parts;
+
+  double sub_wgt = 0;
+  for (cs_lnum_t i = 0; i < n_sub; i++) {
+    part[sub[i]] = r_part;
+    sub_wgt += g->vtx_wgt[sub[i]];
+  }
+
+  const double l_wgt_target = sub_wgt * n_l_parts / n_sub_parts;
+
+  /* Select a pseudo-peripheral seed: last vertex reached by a
+     breadth-first traversal of the subset */
+
+  cs_lnum_t seed = sub[0];
+
+  {
+    cs_lnum_t t = *n_tags;
+    cs_lnum_t q_s = 0, q_e = 0;
+    *n_tags += 1;
+    queue[q_e++] = seed;
+    tag[seed] = t;
+    while (q_s < q_e) {
+      cs_lnum_t i = queue[q_s++];
+      seed = i;
+      for (cs_lnum_t j = g->adj_idx[i]; j < g->adj_idx[i+1]; j++) {
+        cs_lnum_t v_id = g->adj[j];
+        if (part[v_id] == r_part && tag[v_id] != t) {
+          tag[v_id] = t;
+          queue[q_e++] = v_id;
+        }
+      }
+    }
+  }
+
+  /* Grow left part from seed */
+
+  {
+    cs_lnum_t t = *n_tags;
+    cs_lnum_t q_s = 0, q_e = 0, next_id = 0;
+    double l_wgt = 0;
+    *n_tags += 1;
+    queue[q_e++] = seed;
+    tag[seed] = t;
+
+    while (l_wgt < l_wgt_target) {
+
+      /* Restart from another vertex in case of disconnected subsets */
+
+      if (q_s >= q_e) {
+        while (next_id < n_sub && tag[sub[next_id]] == t)
+          next_id++;
+        if (next_id >= n_sub)
+          break;
+        q_s = 0; q_e = 0;
+        queue[q_e++] = sub[next_id];
+        tag[sub[next_id]] = t;
+      }
+
+      cs_lnum_t i = queue[q_s++];
+      part[i] = l_part;
+      l_wgt += g->vtx_wgt[i];
+
+      for (cs_lnum_t j = g->adj_idx[i]; j < g->adj_idx[i+1]; j++) {
+        cs_lnum_t v_id = g->adj[j];
+        if (part[v_id] == r_part && tag[v_id] != t) {
+          tag[v_id] = t;
+          queue[q_e++] = v_id;
+        }
+      }
+    }
+  }
+
+  /* Split subset and recurse */
+
+  cs_lnum_t n_l = 0;
+  for (cs_lnum_t i = 0; i < n_sub; i++) {
+    if (part[sub[i]] == l_part) {
+      cs_lnum_t tmp = sub[n_l];
+      sub[n_l] = sub[i];
+      sub[i] = tmp;
+      n_l++;
+    }
+  }
+
+  _bisect(g, n_l, sub, l_part, n_l_parts,
+          queue, tag, n_tags, part);
+  _bisect(g, n_sub - n_l, sub + n_l, r_part, n_sub_parts - n_l_parts,
+          queue, tag, n_tags, part);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute an initial partition of a local graph by recursive bisection.
+ *
+ * parameters:
+ *   g       <-- pointer to local graph structure
+ *   n_parts <-- number of parts
+ *   part    --> part id of each vertex
+ *----------------------------------------------------------------------------*/
+
+static void
+_initial_partition(const _graph_t  *g,
+                   int              n_parts,
+                   int              part[])
+{
+  const cs_lnum_t n_vtx = g->n_vtx;
+
+  cs_lnum_t n_tags = 0;
+  cs_lnum_t *sub = NULL, *queue = NULL, *tag = NULL;
+
+  BFT_MALLOC(sub, n_vtx, cs_lnum_t);
+  BFT_MALLOC(queue, n_vtx, cs_lnum_t);
+  BFT_MALLOC(tag, n_vtx, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    sub[i] = i;
+    tag[i] = -1;
+    part[i] = -1;
+  }
+
+  _bisect(g, n_vtx, sub, 0, n_parts, queue, tag, &n_tags, part);
+
+  BFT_FREE(tag);
+  BFT_FREE(queue);
+  BFT_FREE(sub);
+}
+
+/*----------------------------------------------------------------------------
+ * Refine a partition using greedy k-way boundary vertex moves.
+ *
+ * A vertex is moved to the adjacent part to which it is most connected
+ * if this reduces the edge cut, or maintains it while improving balance,
+ * or if its current part is overloaded. On distributed graphs, each
+ * pass is split in 2 sub-passes, allowing only moves to higher
+ * and lower part ids respectively, so that simultaneous moves of adjacent
+ * vertices on different ranks may not cancel each other, and the remaining
+ * capacity of each part is shared among ranks.
+ *
+ * parameters:
+ *   g       <-- pointer to graph structure
+ *   n_parts <-- number of parts
+ *   part    <-> part id of each vertex (size: n_vtx + n_ghosts,
+ *               with up-to-date ghost values)
+ *----------------------------------------------------------------------------*/
+
+static void
+_refine(const _graph_t  *g,
+        int              n_parts,
+        int              part[])
+{
+  const cs_lnum_t n_vtx = g->n_vtx;
+
+  int n_ranks = 1;
+  int n_sub_passes = 1;
+
+#if defined(HAVE_MPI)
+  if (g->comm != MPI_COMM_NULL) {
+    n_ranks = g->n_ranks;
+    n_sub_passes = 2;
+  }
+#endif
+
+  double *p_wgt = NULL, *p_wgt_0 = NULL, *p_avail = NULL, *conn = NULL;
+  int *touched = NULL;
+
+  BFT_MALLOC(p_wgt, n_parts + 2, double);
+  BFT_MALLOC(p_wgt_0, n_parts + 2, double);
+  BFT_MALLOC(p_avail, n_parts, double);
+  BFT_MALLOC(conn, n_parts, double);
+  BFT_MALLOC(touched, n_parts, int);
+
+  /* Part weights; the 2 last values are used to compute the
+     maximum vertex weight and number of moves */
+
+  for (int i = 0; i < n_parts + 2; i++)
+    p_wgt[i] = 0;
+  for (int i = 0; i < n_parts; i++)
+    conn[i] = 0;
+
+  double max_v_wgt = 0;
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    p_wgt[part[i]] += g->vtx_wgt[i];
+    if (g->vtx_wgt[i] > max_v_wgt)
+      max_v_wgt = g->vtx_wgt[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (g->comm != MPI_COMM_NULL) {
+    MPI_Allreduce(MPI_IN_PLACE, &max_v_wgt, 1, MPI_DOUBLE, MPI_MAX, g->comm);
+    MPI_Allreduce(MPI_IN_PLACE, p_wgt, n_parts, MPI_DOUBLE, MPI_SUM, g->comm);
+  }
+#endif
+
+  double tot_wgt = 0;
+  for (int i = 0; i < n_parts; i++)
+    tot_wgt += p_wgt[i];
+
+  const double mean_wgt = tot_wgt / n_parts;
+  const double max_p_wgt = CS_MAX(mean_wgt*_IMBALANCE_TOL,
+                                  mean_wgt + max_v_wgt);
+
+  for (int pass = 0; pass < _N_REFINE_PASSES; pass++) {
+
+    double n_pass_moves = 0;
+
+    for (int sub_pass = 0; sub_pass < n_sub_passes; sub_pass++) {
+
+      cs_lnum_t n_moves = 0;
+
+      for (int i = 0; i < n_parts; i++) {
+        p_wgt_0[i] = p_wgt[i];
+        p_avail[i] = (max_p_wgt - p_wgt[i]) / n_ranks;
+      }
+
+      for (cs_lnum_t i = 0; i < n_vtx; i++) {
+
+        const int p_id = part[i];
+        const double v_wgt = g->vtx_wgt[i];
+
+        int n_touched = 0;
+        double i_conn = 0;
+
+        for (cs_lnum_t j = g->adj_idx[i]; j < g->adj_idx[i+1]; j++) {
+          int q_id = part[g->adj[j]];
+          if (q_id == p_id)
+            i_conn += g->adj_wgt[j];
+          else {
+            if (conn[q_id] <= 0)
+              touched[n_touched++] = q_id;
+            conn[q_id] += g->adj_wgt[j];
+          }
+        }
+
+        if (n_touched == 0)
+          continue;
+
+        int m_id = -1;
+        double m_gain = -DBL_MAX;
+
+        for (int k = 0; k < n_touched; k++) {
+          int q_id = touched[k];
+          double gain = conn[q_id] - i_conn;
+          conn[q_id] = 0;
+          if (n_sub_passes > 1) {
+            if (   (sub_pass == 0 && q_id < p_id)
+                || (sub_pass == 1 && q_id > p_id))
+              continue;
+          }
+          if (v_wgt > p_avail[q_id])
+            continue;
+          if (   gain > m_gain
+              || (gain >= m_gain && p_wgt[q_id] < p_wgt[m_id])) {
+            m_id = q_id;
+            m_gain = gain;
+          }
+        }
+
+        if (m_id < 0)
+          continue;
+
+        if (   m_gain > 0
+            || (m_gain >= 0 && p_wgt[m_id] + v_wgt < p_wgt[p_id])
+            || p_wgt[p_id] > max_p_wgt) {
+          part[i] = m_id;
+          p_avail[m_id] -= v_wgt;
+          p_wgt[m_id] += v_wgt;
+          p_wgt[p_id] -= v_wgt;
+          n_moves++;
+        }
+
+      }
+
+      /* Update global part weights and ghost values */
+
+      p_wgt[n_parts] = n_moves;
+
+      if (n_ranks > 1) {
+        for (int i = 0; i < n_parts; i++)
+          p_wgt[i] -= p_wgt_0[i];
+        _graph_sum(g, n_parts + 1, p_wgt);
+        for (int i = 0; i < n_parts; i++)
+          p_wgt[i] += p_wgt_0[i];
+        _ghost_sync(g, CS_INT_TYPE, part);
+      }
+
+      n_pass_moves += p_wgt[n_parts];
+    }
+
+    if (n_pass_moves < 1)
+      break;
+  }
+
+  BFT_FREE(touched);
+  BFT_FREE(conn);
+  BFT_FREE(p_avail);
+  BFT_FREE(p_wgt_0);
+  BFT_FREE(p_wgt);
+}
+
+/*----------------------------------------------------------------------------
+ * Project part ids from a coarse graph to the matching finer graph.
+ *
+ * parameters:
+ *   g      <-- pointer to fine graph structure
+ *   c_part <-- part ids of coarse graph vertices
+ *   part   --> part ids of fine graph vertices (size: n_vtx + n_ghosts)
+ *----------------------------------------------------------------------------*/
+
+static void
+_project(const _graph_t  *g,
+         const int        c_part[],
+         int              part[])
+{
+  for (cs_lnum_t i = 0; i < g->n_vtx; i++)
+    part[i] = c_part[g->coarse_id[i]];
+
+  _ghost_sync(g, CS_INT_TYPE, part);
+}
+
+/*----------------------------------------------------------------------------
+ * Partition a local graph (serial multilevel algorithm).
+ *
+ * parameters:
+ *   g       <-> pointer to local graph structure
+ *   n_parts <-- number of parts
+ *   max_wgt <-- maximum weight of a coarse vertex
+ *   part    --> part id of each vertex
+ *----------------------------------------------------------------------------*/
+
+static void
+_partition_local(_graph_t  *g,
+                 int        n_parts,
+                 double     max_wgt,
+                 int        part[])
+{
+  int n_levels = 1;
+  _graph_t *levels[_MAX_LEVELS];
+  int *l_part[_MAX_LEVELS];
+
+  const cs_gnum_t n_target = (cs_gnum_t)n_parts * _SERIAL_VTX_PER_PART;
+
+  levels[0] = g;
+
+  while (n_levels < _MAX_LEVELS && levels[n_levels-1]->n_g_vtx > n_target) {
+    _graph_t *f = levels[n_levels-1];
+    _graph_t *c = _coarsen(f, max_wgt, n_levels);
+    if (c->n_g_vtx > 0.95*f->n_g_vtx) {
+      _graph_destroy(&c);
+      BFT_FREE(f->coarse_id);
+      break;
+    }
+    levels[n_levels++] = c;
+  }
+
+  l_part[0] = part;
+  for (int i = 1; i < n_levels; i++)
+    BFT_MALLOC(l_part[i], levels[i]->n_vtx, int);
+
+  _initial_partition(levels[n_levels-1], n_parts, l_part[n_levels-1]);
+
+  for (int i = n_levels - 1; i > -1; i--) {
+    if (i < n_levels - 1) {
+      _project(levels[i], l_part[i+1], l_part[i]);
+      BFT_FREE(l_part[i+1]);
+      _graph_destroy(&(levels[i+1]));
+    }
+    _refine(levels[i], n_parts, l_part[i]);
+  }
+
+  BFT_FREE(g->coarse_id);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Partition a distributed graph using the built-in multilevel algorithm.
+ *
+ * Graph vertices are distributed over all ranks of the main communicator
+ * by contiguous ranges of global ids, ordered by rank: the first local
+ * vertex on a given rank has a global id equal to the total number of
+ * vertices on preceding ranks.
+ *
+ * The graph is coarsened by heavy edge matching (matching being restricted
+ * to rank-local vertices in parallel), then the coarsest distributed graph
+ * is gathered on rank 0, which continues coarsening, computes an initial
+ * partition by recursive graph-growing bisection, and refines it while
+ * uncoarsening. The resulting partition is then scattered and refined
+ * level by level on the distributed graphs, using a greedy k-way boundary
+ * refinement balancing edge cut and load.
+ *
+ * parameters:
+ *   n_vtx    <-- number of local vertices
+ *   adj_idx  <-- vertex -> adjacent vertices index (size: n_vtx + 1)
+ *   adj      <-- adjacent vertex global ids (0 to n - 1)
+ *   vtx_wgt  <-- vertex weights, or NULL for unit weights
+ *   n_parts  <-- number of requested parts
+ *   part     --> part id (0 to n_parts - 1) of each local vertex
+ *
+ * returns:
+ *   global sum of cut edge weights (edge weights being the number of
+ *   adjacency instances between 2 vertices)
+ *----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_graph_partition_ml(cs_lnum_t         n_vtx,
+                      const cs_lnum_t   adj_idx[],
+                      const cs_gnum_t   adj[],
+                      const double      vtx_wgt[],
+                      int               n_parts,
+                      int               part[])
+{
+  bool distributed = false;
+  cs_gnum_t g_start = 0, n_g_vtx = n_vtx;
+
+#if defined(HAVE_MPI)
+  MPI_Comm comm = (cs_glob_n_ranks > 1) ? cs_glob_mpi_comm : MPI_COMM_NULL;
+  _global_range(n_vtx, comm, &g_start, &n_g_vtx);
+  if (comm != MPI_COMM_NULL)
+    distributed = true;
+#endif
+
+  if (n_parts < 2 || n_g_vtx < 1) {
+    for (cs_lnum_t i = 0; i < n_vtx; i++)
+      part[i] = 0;
+    return 0;
+  }
+
+  int n_levels = 1;
+  _graph_t *levels[_MAX_LEVELS];
+  int *l_part[_MAX_LEVELS];
+
+  levels[0] = _graph_create(n_vtx, g_start, n_g_vtx,
+                            adj_idx, adj, NULL, vtx_wgt
+#if defined(HAVE_MPI)
+                            , comm
+#endif
+                            );
+
+  /* Limit coarse vertex weights so that the coarsest serial graph
+     has enough vertices for a balanced initial partition */
+
+  double tot_wgt = 0;
+  for (cs_lnum_t i = 0; i < n_vtx; i++)
+    tot_wgt += levels[0]->vtx_wgt[i];
+  _graph_sum(levels[0], 1, &tot_wgt);
+
+  const double max_wgt = 1.5 * tot_wgt / (n_parts*_SERIAL_VTX_PER_PART);
+
+  /* Distributed coarsening */
+
+#if defined(HAVE_MPI)
+
+  if (distributed) {
+
+    cs_gnum_t n_target = CS_MAX((cs_gnum_t)n_parts*_GATHER_VTX_PER_PART,
+                                _GATHER_MIN_VTX);
+
+    while (   n_levels < _MAX_LEVELS
+           && levels[n_levels-1]->n_g_vtx > n_target) {
+      _graph_t *f = levels[n_levels-1];
+      _graph_t *c = _coarsen(f, max_wgt, cs_glob_rank_id + n_levels);
+      if (c->n_g_vtx > 0.9*f->n_g_vtx) {
+        _graph_destroy(&c);
+        BFT_FREE(f->coarse_id);
+        break;
+      }
+      levels[n_levels++] = c;
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  for (int i = 0; i < n_levels; i++)
+    BFT_MALLOC(l_part[i], levels[i]->n_vtx + levels[i]->n_ghosts, int);
+
+  /* Partition coarsest graph */
+
+#if defined(HAVE_MPI)
+
+  if (distributed) {
+
+    _graph_t *s = _graph_gather(levels[n_levels-1]);
+    int *s_part = NULL;
+
+    if (s != NULL) {
+      BFT_MALLOC(s_part, s->n_vtx, int);
+      _partition_local(s, n_parts, max_wgt, s_part);
+      _graph_destroy(&s);
+    }
+
+    _part_scatter(levels[n_levels-1], s_part, l_part[n_levels-1]);
+
+    BFT_FREE(s_part);
+
+    _refine(levels[n_levels-1], n_parts, l_part[n_levels-1]);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (distributed == false)
+    _partition_local(levels[0], n_parts, max_wgt, l_part[0]);
+
+  /* Distributed uncoarsening */
+
+  for (int i = n_levels - 2; i > -1; i--) {
+    _project(levels[i], l_part[i+1], l_part[i]);
+    BFT_FREE(l_part[i+1]);
+    _graph_destroy(&(levels[i+1]));
+    _refine(levels[i], n_parts, l_part[i]);
+  }
+
+  /* Edge cut */
+
+  double e_cut = 0;
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    for (cs_lnum_t j = levels[0]->adj_idx[i]; j < levels[0]->adj_idx[i+1]; j++)
+      if (l_part[0][levels[0]->adj[j]] != l_part[0][i])
+        e_cut += levels[0]->adj_wgt[j];
+  }
+
+  _graph_sum(levels[0], 1, &e_cut);
+
+  memcpy(part, l_part[0], n_vtx*sizeof(int));
+
+  BFT_FREE(l_part[0]);
+  _graph_destroy(&(levels[0]));
+
+  return (cs_gnum_t)(e_cut/2 + 0.5);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
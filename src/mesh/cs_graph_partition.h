@@ -0,0 +1,97 @@
+#ifndef __CS_GRAPH_PARTITION_H__
+#define __CS_GRAPH_PARTITION_H__
+
+/*============================================================================
+ * Built-in multilevel graph partitioner.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Partition a distributed graph using the built-in multilevel algorithm.
+ *
+ * Graph vertices are distributed over all ranks of the main communicator
+ * by contiguous ranges of global ids, ordered by rank: the first local
+ * vertex on a given rank has a global id equal to the total number of
+ * vertices on preceding ranks.
+ *
+ * The graph is coarsened by heavy edge matching (matching being restricted
+ * to rank-local vertices in parallel), then the coarsest distributed graph
+ * is gathered on rank 0, which continues coarsening, computes an initial
+ * partition by recursive graph-growing bisection, and refines it while
+ * uncoarsening. The resulting partition is then scattered and refined
+ * level by level on the distributed graphs, using a greedy k-way boundary
+ * refinement balancing edge cut and load.
+ *
+ * parameters:
+ *   n_vtx    <-- number of local vertices
+ *   adj_idx  <-- vertex -> adjacent vertices index (size: n_vtx + 1)
+ *   adj      <-- adjacent vertex global ids (0 to n - 1)
+ *   vtx_wgt  <-- vertex weights, or NULL for unit weights
+ *   n_parts  <-- number of requested parts
+ *   part     --> part id (0 to n_parts - 1) of each local vertex
+ *
+ * returns:
+ *   global sum of cut edge weights (edge weights being the number of
+ *   adjacency instances between 2 vertices)
+ *----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_graph_partition_ml(cs_lnum_t         n_vtx,
+                      const cs_lnum_t   adj_idx[],
+                      const cs_gnum_t   adj[],
+                      const double      vtx_wgt[],
+                      int               n_parts,
+                      int               part[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_GRAPH_PARTITION_H__ */
@@ -93,6 +93,8 @@ extern "C" {
 #include "cs_block_dist.h"
 #include "cs_block_to_part.h"
 #include "cs_file.h"
+#include "cs_graph_partition.h"
+#include "cs_halo.h"
 #include "cs_io.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
@@ -169,6 +171,7 @@ BEGIN_C_DECLS
  * \var CS_PARTITION_SCOTCH            PT-SCOTCH or SCOTCH
  * \var CS_PARTITION_METIS             ParMETIS or METIS
  * \var CS_PARTITION_BLOCK             Unoptimized (naive) block partitioning
+ * \var CS_PARTITION_MULTILEVEL        Built-in multilevel graph partitioner
  * \var CS_PARTITION_NONE              No repartitioning (for computation
  *                                     stage after preprocessing)
  */
@@ -2054,6 +2057,147 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
 #endif /* defined(HAVE_PTSCOTCH) */
 
+/*----------------------------------------------------------------------------
+ * Build cell -> cell connectivity for the built-in multilevel partitioner.
+ *
+ * Adjacent cells are defined by their global id (0 to n-1); cells sharing
+ * multiple faces appear multiple times.
+ *
+ * parameters:
+ *   n_cells        <-- number of cells in mesh
+ *   n_faces        <-- number of faces in mesh
+ *   start_cell     <-- number of first cell for the curent rank
+ *   face_cells     <-- face->cells connectivity
+ *   cell_idx       --> cell->cells index
+ *   cell_neighbors --> cell->cells connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_ml_cell_cells(cs_lnum_t     n_cells,
+               cs_lnum_t     n_faces,
+               cs_gnum_t     start_cell,
+               cs_gnum_t    *face_cells,
+               cs_lnum_t   **cell_idx,
+               cs_gnum_t   **cell_neighbors)
+{
+  cs_lnum_t i;
+  cs_gnum_t c_num[2];
+
+  cs_lnum_t  *n_neighbors;
+  cs_lnum_t  *_cell_idx;
+  cs_gnum_t  *_cell_neighbors;
+
+  const cs_gnum_t _n_cells = n_cells;
+
+  /* Count and allocate arrays */
+
+  BFT_MALLOC(n_neighbors, n_cells, cs_lnum_t);
+
+  for (i = 0; i < n_cells; i++)
+    n_neighbors[i] = 0;
+
+  for (i = 0; i < n_faces; i++) {
+
+    c_num[0] = face_cells[i*2];
+    c_num[1] = face_cells[i*2 + 1];
+
+    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
+      continue;
+
+    if (c_num[0] >= start_cell && c_num[0] - start_cell < _n_cells)
+      n_neighbors[c_num[0] - start_cell] += 1;
+    if (c_num[1] >= start_cell && c_num[1] - start_cell < _n_cells)
+      n_neighbors[c_num[1] - start_cell] += 1;
+  }
+
+  BFT_MALLOC(_cell_idx, n_cells + 1, cs_lnum_t);
+
+  _cell_idx[0] = 0;
+
+  for (i = 0; i < n_cells; i++)
+    _cell_idx[i + 1] = _cell_idx[i] + n_neighbors[i];
+
+  BFT_MALLOC(_cell_neighbors, _cell_idx[n_cells], cs_gnum_t);
+
+  for (i = 0; i < n_cells; i++)
+    n_neighbors[i] = 0;
+
+  for (i = 0; i < n_faces; i++) {
+
+    c_num[0] = face_cells[i*2];
+    c_num[1] = face_cells[i*2 + 1];
+
+    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
+      continue;
+
+    if (c_num[0] >= start_cell && c_num[0] - start_cell < _n_cells) {
+      cs_lnum_t id_0 = c_num[0] - start_cell;
+      _cell_neighbors[_cell_idx[id_0] + n_neighbors[id_0]] = c_num[1] - 1;
+      n_neighbors[id_0] += 1;
+    }
+
+    if (c_num[1] >= start_cell && c_num[1] - start_cell < _n_cells) {
+      cs_lnum_t id_1 = c_num[1] - start_cell;
+      _cell_neighbors[_cell_idx[id_1] + n_neighbors[id_1]] = c_num[0] - 1;
+      n_neighbors[id_1] += 1;
+    }
+  }
+
+  BFT_FREE(n_neighbors);
+
+  *cell_idx = _cell_idx;
+  *cell_neighbors = _cell_neighbors;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute partition using the built-in multilevel partitioner
+ *
+ * parameters:
+ *   n_g_cells      <-- global number of cells
+ *   n_cells        <-- number of local cells
+ *   n_parts        <-- number of partitions
+ *   cell_idx       <-- cell->cells index
+ *   cell_neighbors <-- cell->cells connectivity
+ *   cell_part      --> cell partition
+ *----------------------------------------------------------------------------*/
+
+static void
+_part_multilevel(cs_gnum_t         n_g_cells,
+                 cs_lnum_t         n_cells,
+                 int               n_parts,
+                 const cs_lnum_t   cell_idx[],
+                 const cs_gnum_t   cell_neighbors[],
+                 int               cell_part[])
+{
+  double  start_time, end_time;
+
+  start_time = cs_timer_wtime();
+
+  bft_printf(_("\n"
+               " Partitioning %llu cells to %d domains\n"
+               "  (built-in multilevel partitioner).\n"),
+             (unsigned long long)n_g_cells, n_parts);
+
+  cs_gnum_t edgecut = cs_graph_partition_ml(n_cells,
+                                            cell_idx,
+                                            cell_neighbors,
+                                            NULL, /* cell weights */
+                                            n_parts,
+                                            cell_part);
+
+  end_time = cs_timer_wtime();
+
+  bft_printf(_("\n"
+               "  Total number of faces on parallel boundaries: %llu\n"
+               "  wall-clock time: %f s\n\n"),
+             (unsigned long long)edgecut,
+             (double)(end_time - start_time));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  multilevel partitioning:    %.3g s\n",
+                (double)(end_time - start_time));
+}
+
 /*----------------------------------------------------------------------------
  * Prepare input from mesh builder for use by partitioner.
  *
@@ -2225,9 +2369,6 @@ _prepare_input(const cs_mesh_t           *mesh,
   cell_range[1] = cell_bi.gnum_range[1];
 }
 
-#if   defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
-   || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
-
 /*----------------------------------------------------------------------------
  * Distribute partitioning info so as to match mesh builder block info.
  *
@@ -2297,9 +2438,6 @@ _distribute_output(const cs_mesh_builder_t   *mb,
 #endif /* defined(HAVE_MPI) */
 }
 
-#endif /*    defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
-          || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
-
 /*----------------------------------------------------------------------------
  * Write output file.
  *
@@ -2695,7 +2833,8 @@ _have_usable_graph_partitioning(cs_partition_stage_t  stage)
   if (n_part_ranks < 1)
     n_part_ranks = 1;
 
-  if (a >= CS_PARTITION_SCOTCH && a <= CS_PARTITION_METIS)
+  if (   (a >= CS_PARTITION_SCOTCH && a <= CS_PARTITION_METIS)
+      || a == CS_PARTITION_MULTILEVEL)
     retval = true;
 
 #if defined(HAVE_PTSCOTCH)
@@ -3078,7 +3217,8 @@ cs_partition(cs_mesh_t             *mesh,
 
   if (stage == CS_PARTITION_MAIN) {
     if (   (   _algorithm == CS_PARTITION_METIS
-            || _algorithm == CS_PARTITION_SCOTCH)
+            || _algorithm == CS_PARTITION_SCOTCH
+            || _algorithm == CS_PARTITION_MULTILEVEL)
         && _part_write_output > 0)
       write_output = true;
     else if (_part_write_output > 1)
@@ -3125,7 +3265,9 @@ cs_partition(cs_mesh_t             *mesh,
 
   /* Adapt builder data for partitioning */
 
-  if (_algorithm == CS_PARTITION_METIS || _algorithm == CS_PARTITION_SCOTCH) {
+  if (   _algorithm == CS_PARTITION_METIS
+      || _algorithm == CS_PARTITION_SCOTCH
+      || _algorithm == CS_PARTITION_MULTILEVEL) {
 
     _prepare_input(mesh,
                    mb,
@@ -3401,6 +3543,72 @@ cs_partition(cs_mesh_t             *mesh,
 
 #endif /* defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
 
+  if (_algorithm == CS_PARTITION_MULTILEVEL) {
+
+    int  i;
+    cs_timer_t  t2;
+    cs_lnum_t  *cell_idx = NULL;
+    cs_gnum_t  *cell_neighbors = NULL;
+
+    _ml_cell_cells(n_cells,
+                   n_faces,
+                   cell_range[0],
+                   face_cells,
+                   &cell_idx,
+                   &cell_neighbors);
+
+    if (face_cells != mb->face_cells)
+      BFT_FREE(face_cells);
+
+    t2 = cs_timer_time();
+    dt = cs_timer_diff(&t0, &t2);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  preparing graph:            %.3g s\n"),
+                  (double)(dt.wall_nsec)/1.e9);
+
+    for (i = 0; i < n_extra_partitions + 1; i++) {
+
+      int  n_ranks = cs_glob_n_ranks;
+
+      if (i < n_extra_partitions) {
+        n_ranks = _part_extra_partitions_list[i];
+        if (n_ranks == cs_glob_n_ranks) {
+          write_output = true;
+          continue;
+        }
+      }
+
+      if (n_ranks < 2)
+        continue;
+
+      BFT_REALLOC(cell_part, n_cells, int);
+
+      _part_multilevel(mesh->n_g_cells,
+                       n_cells,
+                       n_ranks,
+                       cell_idx,
+                       cell_neighbors,
+                       cell_part);
+
+      _distribute_output(mb,
+                         _part_rank_step[stage],
+                         cell_range,
+                         &cell_part);
+
+      _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
+
+      if (write_output || i < n_extra_partitions)
+        _write_output(mesh->n_g_cells,
+                      mb->cell_bi.gnum_range,
+                      n_ranks,
+                      cell_part);
+    }
+
+    BFT_FREE(cell_idx);
+    BFT_FREE(cell_neighbors);
+  }
+
   if (   _algorithm >= CS_PARTITION_SFC_MORTON_BOX
       && _algorithm <= CS_PARTITION_SFC_HILBERT_CUBE) {
 
@@ -3488,6 +3696,179 @@ cs_partition(cs_mesh_t             *mesh,
   cs_log_separator(CS_LOG_PERFORMANCE);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a weighted partitioning of the current (distributed) mesh
+ *        and write it to file.
+ *
+ * This is intended for rebalancing a computation at runtime: the
+ * partitioning is computed by the built-in multilevel graph partitioner,
+ * based on the cell -> cell adjacency of the current mesh and the given
+ * cell weights, and written to "partition_output/domain_number_<n_parts>",
+ * so that a computation restarted with this file as partitioning input
+ * will use it.
+ *
+ * \param[in]   mesh         pointer to mesh structure
+ * \param[in]   cell_weight  cell weights (size: n_cells)
+ * \param[in]   n_parts      number of requested parts
+ * \param[out]  cell_part    part id for each cell, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_write_weighted(const cs_mesh_t  *mesh,
+                            const double      cell_weight[],
+                            int               n_parts,
+                            int              *cell_part)
+{
+  cs_timer_t t0 = cs_timer_time();
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+
+  /* Contiguous global ids based on current distribution, also
+     defined for ghost cells */
+
+  cs_gnum_t g_start = 0;
+  cs_gnum_t *cell_g_id = NULL;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_cells = n_cells;
+    MPI_Scan(&_n_cells, &g_start, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    g_start -= _n_cells;
+  }
+#endif
+
+  BFT_MALLOC(cell_g_id, n_cells_ext, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_g_id[i] = g_start + i;
+
+  if (mesh->halo != NULL)
+    cs_halo_sync_untyped(mesh->halo,
+                         CS_HALO_STANDARD,
+                         sizeof(cs_gnum_t),
+                         cell_g_id);
+
+  /* Cell -> cells adjacency */
+
+  cs_lnum_t *cell_idx = NULL;
+  cs_gnum_t *cell_neighbors = NULL;
+
+  BFT_MALLOC(cell_idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    cell_idx[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    for (int j = 0; j < 2; j++) {
+      if (i_face_cells[f_id][j] < n_cells)
+        cell_idx[i_face_cells[f_id][j] + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_idx[i+1] += cell_idx[i];
+
+  BFT_MALLOC(cell_neighbors, cell_idx[n_cells], cs_gnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    for (int j = 0; j < 2; j++) {
+      cs_lnum_t c_id = i_face_cells[f_id][j];
+      if (c_id < n_cells) {
+        cell_neighbors[cell_idx[c_id]] = cell_g_id[i_face_cells[f_id][(j+1)%2]];
+        cell_idx[c_id] += 1;
+      }
+    }
+  }
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    cell_idx[i] = cell_idx[i-1];
+  cell_idx[0] = 0;
+
+  BFT_FREE(cell_g_id);
+
+  /* Partition */
+
+  int *_cell_part = cell_part;
+  if (_cell_part == NULL)
+    BFT_MALLOC(_cell_part, n_cells, int);
+
+  cs_gnum_t edgecut = cs_graph_partition_ml(n_cells,
+                                            cell_idx,
+                                            cell_neighbors,
+                                            cell_weight,
+                                            n_parts,
+                                            _cell_part);
+
+  BFT_FREE(cell_neighbors);
+  BFT_FREE(cell_idx);
+
+  /* Distribute to global cell number blocks and write */
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        mesh->n_g_cells);
+
+  int *b_cell_part = _cell_part;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_datatype_t int_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+    cs_lnum_t n_b_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+    BFT_MALLOC(b_cell_part, n_b_cells, int);
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        n_cells,
+                                        mesh->global_cell_num);
+
+    cs_part_to_block_copy_array(d,
+                                int_type,
+                                1,
+                                _cell_part,
+                                b_cell_part);
+
+    cs_part_to_block_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1 && mesh->global_cell_num != NULL) {
+    BFT_MALLOC(b_cell_part, n_cells, int);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      b_cell_part[mesh->global_cell_num[i] - 1] = _cell_part[i];
+  }
+
+  _cell_part_histogram(bi.gnum_range, n_parts, b_cell_part);
+
+  _write_output(mesh->n_g_cells, bi.gnum_range, n_parts, b_cell_part);
+
+  if (b_cell_part != _cell_part)
+    BFT_FREE(b_cell_part);
+  if (_cell_part != cell_part)
+    BFT_FREE(_cell_part);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  bft_printf(_("\n"
+               " Weighted partitioning for %d domains written\n"
+               "  (faces on parallel boundaries: %llu; %.3g s)\n"),
+             n_parts, (unsigned long long)edgecut,
+             (double)(dt.wall_nsec)/1.e9);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
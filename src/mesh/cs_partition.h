@@ -111,7 +111,8 @@ typedef enum {
   CS_PARTITION_SFC_HILBERT_CUBE,  /* Peano-Hilbert curve in bounding cube */
   CS_PARTITION_SCOTCH,            /* PT-SCOTCH or SCOTCH */
   CS_PARTITION_METIS,             /* ParMETIS or METIS */
-  CS_PARTITION_BLOCK              /* Unoptimized (naive) block partitioning */
+  CS_PARTITION_BLOCK,             /* Unoptimized (naive) block partitioning */
+  CS_PARTITION_MULTILEVEL         /* Built-in multilevel graph partitioner */
 
 } cs_partition_algorithm_t;
 
@@ -238,6 +239,30 @@ cs_partition(cs_mesh_t             *mesh,
              cs_mesh_builder_t     *mesh_builder,
              cs_partition_stage_t   stage);
 
+/*----------------------------------------------------------------------------
+ * Compute a weighted partitioning of the current (distributed) mesh
+ * and write it to file.
+ *
+ * This is intended for rebalancing a computation at runtime: the
+ * partitioning is computed by the built-in multilevel graph partitioner,
+ * based on the cell -> cell adjacency of the current mesh and the given
+ * cell weights, and written to "partition_output/domain_number_<n_parts>",
+ * so that a computation restarted with this file as partitioning input
+ * will use it.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   cell_weight <-- cell weights (size: n_cells)
+ *   n_parts     <-- number of requested parts
+ *   cell_part   --> part id for each cell, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_write_weighted(const cs_mesh_t  *mesh,
+                            const double      cell_weight[],
+                            int               n_parts,
+                            int              *cell_part);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -127,6 +127,20 @@ cs_user_mesh_input(void)
   }
   /*! [mesh_input_2] */
 
+  /*! [mesh_input_3] */
+  {
+    /* Use preprocessed mesh cache when valid (same number of ranks and
+       unchanged inputs), write it otherwise */
+
+    cs_preprocessor_data_set_cache_mode(CS_PREPROCESSOR_DATA_CACHE_USE);
+
+    /* Optionally check whole input file contents instead of sampled
+       blocks (slower, as input files are read at each run) */
+
+    cs_preprocessor_data_set_cache_full_check(false);
+  }
+  /*! [mesh_input_3] */
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -50,6 +50,7 @@
 #include "cs_base.h"
 #include "cs_file.h"
 #include "cs_grid.h"
+#include "cs_load_balance.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_parall.h"
@@ -106,7 +107,8 @@ cs_user_partition(void)
        CS_PARTITION_SFC_HILBERT_CUBE  Peano-Hilbert curve in bounding cube
        CS_PARTITION_SCOTCH            PT-SCOTCH or SCOTCH
        CS_PARTITION_METIS             ParMETIS or METIS
-       CS_PARTITION_BLOCK             Unoptimized (naive) block partitioning */
+       CS_PARTITION_BLOCK             Unoptimized (naive) block partitioning
+       CS_PARTITION_MULTILEVEL        Built-in multilevel graph partitioner */
 
     cs_partition_set_algorithm(CS_PARTITION_FOR_PREPROCESS,
                                CS_PARTITION_SCOTCH,
@@ -162,6 +164,19 @@ cs_user_partition(void)
   }
   /*! [performance_tuning_partition_4] */
 
+  /*! [performance_tuning_partition_5] */
+  {
+    /* Example: check load balance every 50 time steps, based on
+     * cell and particle costs; if the estimated imbalance exceeds 20%,
+     * write a weighted partitioning to "partition_output" and stop
+     * (with a checkpoint), so as to restart with that partitioning. */
+
+    cs_load_balance_set_options(50,     /* interval */
+                                1.2,    /* imbalance tolerance */
+                                true);  /* stop for restart */
+  }
+  /*! [performance_tuning_partition_5] */
+
 }
 
 /*----------------------------------------------------------------------------*/
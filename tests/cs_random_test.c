@@ -284,6 +284,67 @@ _poisson_test(cs_lnum_t   n,
   }
 }
 
+static void
+_cb_test(cs_lnum_t   n,
+         cs_real_t  *a)
+{
+  int i, k;
+  int bin[20];
+  double b[4];
+  double x1 = 0., x2 = 0.;
+  cs_gnum_t ids[4] = {7, 3, 1000000007, 3};
+
+  /* Bulk values for ids 0 to n/4-1, 4 draws each */
+
+  cs_random_cb_normal(1, 5, n/4, NULL, 0, 4, a);
+
+  for (i = 0; i < (n/4)*4; ++i) {
+    x1 += a[i];
+    x2 += a[i]*a[i];
+  }
+  x1 /= (double)((n/4)*4);
+  x2 /= (double)((n/4)*4);
+
+  printf("\n    Counter-based normal law moments: \n");
+  printf("      Compare to (0.0)               (1.0) \n");
+  printf("              %e       %e \n", x1, x2);
+
+  /* Values must only depend on the keys, not on the call sequence */
+
+  double diff = 0.;
+  for (k = 0; k < 4; ++k) {
+    cs_gnum_t id = 11 + k;
+    cs_random_cb_normal(1, 5, 1, &id, 1, 3, b);
+    for (i = 0; i < 3; ++i)
+      diff += fabs(b[i] - a[(11+k)*4 + 1 + i]);
+  }
+
+  cs_random_cb_uniform(1, 5, 4, ids, 0, 3, a);
+  for (k = 0; k < 3; ++k)
+    diff += fabs(a[3 + k] - a[9 + k]);
+
+  if (diff > 0.)
+    printf("ERROR in counter-based generator: diff = %e\n", diff);
+  else
+    printf("    counter-based reproducibility test OK\n");
+
+  /* Uniform law histogram */
+
+  for (k = 0; k < 20; ++k)
+    bin[k] = 0;
+
+  cs_random_cb_uniform(1, 5, n, NULL, 0, 1, a);
+  for (i = 0; i < n; ++i)
+    ++bin[(int)(a[i] * 20.)];
+
+  printf("\n    Histogram of counter-based uniform distribution:\n");
+  printf("    --------- -- ------- ------------ \n");
+  for (k = 0; k < 20; ++k) {
+    if(k<9) printf("    bin[%d]  = %d\n",k+1,bin[k]);
+    else    printf("    bin[%d] = %d\n",k+1,bin[k]);
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 
 int
@@ -336,5 +397,14 @@ main (int argc, char *argv[])
   printf("Fischer distribution for %d values in %f seconds\n",
          NPTS, wt1 - wt0);
 
+  wt0 = cs_timer_wtime();
+
+  _cb_test(NPTS, a);
+
+  wt1 = cs_timer_wtime();
+
+  printf("Counter-based distributions for %d values in %f seconds\n",
+         NPTS, wt1 - wt0);
+
   exit(EXIT_SUCCESS);
 }